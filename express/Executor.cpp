@@ -159,6 +159,7 @@ std::shared_ptr<Executor> Executor::newExecutor(MNNForwardType type,
     Backend::Info info;
     info.type = type;
     info.numThread = numberThread;
+    info.user = (BackendConfig*)&config;
     std::shared_ptr<Runtime> bn(creator->onCreate(info));
     return std::shared_ptr<Executor>(new Executor(bn, type));
 }
@@ -271,7 +272,7 @@ void Executor::ComputeCache::setContentDirty() {
     mContentDirty = true;
 }
 
-Executor::ComputeCache::ComputeCache(std::shared_ptr<Backend> backend, std::shared_ptr<Backend> backupBackend) : mContext(backupBackend) {
+Executor::ComputeCache::ComputeCache(std::shared_ptr<Backend> backend, std::shared_ptr<Backend> backupBackend) : mContext(backupBackend, true, backend->type()) {
     mBackend = backend;
     mBackupBackend = backupBackend;
 }
@@ -423,6 +424,7 @@ ErrorCode Executor::ComputeCache::resize() {
         Timer autoTime;
 #endif
         GeometryComputerUtils::makeRaster(buffer, mCmdBuffer, mContext);
+        mBackend->onElideRasters(mCmdBuffer);
 #ifdef MNN_EXPR_ENABLE_PROFILER
         float costTime = (float)autoTime.durationInUs() / (float)1000;
         ExecutorScope::Current()->addOpCostTime((int)OpType_If, costTime);
@@ -489,6 +489,27 @@ VARP _Expm1(VARP x) {
     return _Unary(x, UnaryOpOperation_EXPM1);
 }
 
+/*Computes x * sigmoid(x) element-wise, also known as swish.
+Args:
+x: A variable. Must be one of the following types: Halide_Type_Float
+Returns:
+A variable. Has the same type as x.
+*/
+VARP _Silu(VARP x) {
+    return _Unary(x, UnaryOpOperation_SILU);
+}
+
+/*Computes Gaussian error linear unit of x element-wise, 0.5 * x * (1 + erf(x / sqrt(2))).
+Args:
+x: A variable. Must be one of the following types: Halide_Type_Float
+approximate: use 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))) instead.
+Returns:
+A variable. Has the same type as x.
+*/
+VARP _Gelu(VARP x, bool approximate) {
+    return _Unary(x, approximate ? UnaryOpOperation_GELU : UnaryOpOperation_GELU_STANDARD);
+}
+
 
 /*Returns x + y element-wise.
 Args:
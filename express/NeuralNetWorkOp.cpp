@@ -1569,5 +1569,50 @@ VARP _Select(VARP select, VARP input0, VARP input1) {
     return (Variable::create(Expr::create(std::move(selectOp), {select, input0, input1})));
 }
 
+/*Fused attention of softmax(query * key^T * scale + mask) * value.
+Args:
+query: [..., seqQ, depth]
+key: [..., seqK, depth], the leading dimensions are the same as query
+value: [..., seqK, depthV], the leading dimensions are the same as query
+mask: Optional, added to the scores before softmax, broadcast to [..., seqQ, seqK] except the last dimension
+scale: Scale of the scores, 0 means 1 / sqrt(depth)
+Returns:
+A variable of [..., seqQ, depthV]
+*/
+VARP _Attention(VARP query, VARP key, VARP value, VARP mask, float scale) {
+    std::unique_ptr<OpT> op(new OpT);
+    op->type       = OpType_Attention;
+    op->main.type  = OpParameter_AttentionParam;
+    op->main.value = new AttentionParamT;
+    op->main.AsAttentionParam()->scale = scale;
+    std::vector<VARP> inputs = {query, key, value};
+    if (nullptr != mask) {
+        inputs.emplace_back(mask);
+    }
+    return Variable::create(Expr::create(std::move(op), inputs));
+}
+
+/*Gathers rows of weight and pools each bag of them by sum or mean, without materializing the gathered rows.
+Args:
+weight: [rows, ...], float
+indices: int, [bags, bagSize] if offsets is nullptr, otherwise [N]
+offsets: Optional, [bags], bag b is indices[offsets[b], offsets[b + 1]), the last bag ends at N
+mean: Pools by mean if true, otherwise by sum. An empty bag is zeros
+Returns:
+A variable of [bags, ...]
+*/
+VARP _EmbeddingBag(VARP weight, VARP indices, VARP offsets, bool mean) {
+    std::unique_ptr<OpT> op(new OpT);
+    op->type       = OpType_EmbeddingBag;
+    op->main.type  = OpParameter_EmbeddingBagParam;
+    op->main.value = new EmbeddingBagParamT;
+    op->main.AsEmbeddingBagParam()->mode = mean ? ReductionType_MEAN : ReductionType_SUM;
+    std::vector<VARP> inputs = {weight, indices};
+    if (nullptr != offsets) {
+        inputs.emplace_back(offsets);
+    }
+    return Variable::create(Expr::create(std::move(op), inputs));
+}
+
 } // namespace Express
 } // namespace MNN
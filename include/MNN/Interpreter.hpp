@@ -123,6 +123,18 @@ public:
         Session_Input_Inside = 2,
         /** The input tensor is alloced by user, set input data before session resize*/
         Session_Input_User = 3,
+
+        /** About dynamic memory, Default Session_Memory_Greedy*/
+        /** The dynamic memory is alloced and reused op by op*/
+        Session_Memory_Greedy = 4,
+        /** The dynamic memory is planned by all tensors' lifetime, resize session costs about twice time*/
+        Session_Memory_Plan = 5,
+
+        /** About execution, Default Session_Execute_Serial*/
+        /** The ops run one by one, each op runs with multi-thread*/
+        Session_Execute_Serial = 6,
+        /** The independent ops run concurrently, only valid for the backend supports it, such as CPU*/
+        Session_Execute_Parallel = 7,
     };
     /**
      * @brief The API shoud be called before create session.
@@ -130,6 +142,18 @@ public:
      */
     void setSessionMode(SessionMode mode);
 
+    enum HintMode {
+        /** Max number of input shapes whose resize result is cached by session, default 0 (no cache).
+            Resize to a cached shape only switches to the cached result, each cached shape holds its own dynamic memory */
+        RESIZE_CACHE_NUMBER = 0,
+    };
+    /**
+     * @brief The API shoud be called before create session.
+     * @param mode      hint type
+     * @param value     hint value
+     */
+    void setSessionHint(HintMode mode, int value);
+
     /**
      * @brief The API shoud be called before create session.
      * If the cache exist, try to load cache from file.
@@ -175,6 +199,15 @@ public:
      */
     Session* createMultiPathSession(const std::vector<ScheduleConfig>& configs, const RuntimeInfo& runtime);
 
+    /**
+     * @brief create replica of given session for serving concurrent requests. created session will be managed in net.
+     *        the replica shares constant tensors and packed weights with given session, and owns its runtime,
+     *        dynamic memory and input / output tensors, so it can run in another thread concurrently.
+     * @param session   given session, must be created by this interpreter.
+     * @return created session if success, NULL otherwise.
+     */
+    Session* cloneSession(const Session* session);
+
     /**
      * @brief release session.
      * @param session   given session.
@@ -213,7 +246,8 @@ public:
     ErrorCode updateSessionToModel(Session* session);
 
     /**
-     * @brief run session.
+     * @brief run session. sessions created by createSession run one by one, the replicas created by
+     *        cloneSession own their runtime and can run concurrently in different threads.
      * @param session   given session.
      * @return result of running.
      */
@@ -266,6 +300,16 @@ public:
         /** Backends in session in M, int*, length >= the configs when create session */
         BACKENDS = 2,
 
+        /** dynamic memory of greedy alloc and the one alloced indeed in MB, float*, length = 2, they are the same
+         * without Session_Memory_Plan */
+        MEMORY_PLAN = 3,
+
+        /** hit and miss count of resize cache, int*, length = 2, see RESIZE_CACHE_NUMBER */
+        RESIZE_CACHE = 4,
+
+        /** memory on huge pages in MB, float*, see BackendConfig::page */
+        HUGE_PAGE = 5,
+
         ALL
     };
 
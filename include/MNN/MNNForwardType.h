@@ -69,6 +69,34 @@ struct BackendConfig {
         void* sharedContext = nullptr;
         size_t flags; // Valid for CPU Backend
     };
+
+    /** Valid for CPU Backend, ignored if the machine has only one NUMA node or numaNode is invalid.
+     * Numa_Bind: run on the pool threads of numaNode and allocate dynamic memory from numaNode.
+     * Numa_Replicate: also allocate static memory (weights) from numaNode, so the sessions bound to each node
+     * keep their own replica of weights. */
+    enum NumaMode { Numa_None = 0, Numa_Bind, Numa_Replicate };
+
+    NumaMode numa = Numa_None;
+
+    /** NUMA node id, the same as the system's numbering */
+    int numaNode = 0;
+
+    /** Valid for CPU Backend, pages of the buffers not less than 2MB.
+     * Page_Huge: transparent huge pages by madvise.
+     * Page_HugeTLB: MAP_HUGETLB, use transparent huge pages if no huge page is reserved. */
+    enum PageMode { Page_Normal = 0, Page_Huge, Page_HugeTLB };
+
+    PageMode page = Page_Normal;
+
+    /** Valid for CPU Backend, fault in the pages of large buffers by numThread threads when they are allocated, so
+     * that the first inference after resize doesn't take page faults */
+    bool prefault = false;
+
+    /** Valid for CPU Backend on x86 (AVX2 / AVX512_BF16 / AMX), the im2col float convolutions keep their weights in
+     * bfloat16 and compute their GEMM in bfloat16 summed in float. With AMX the convolutions of Winograd / Strassen
+     * use im2col too. Tensors, MatMul and InnerProduct stay float. Only AMX is faster than float, the others only
+     * halve the memory of the weights */
+    bool bf16Convolution = false;
 };
 }; // namespace MNN
 #endif
@@ -64,6 +64,8 @@ MNN_PUBLIC VARP _Erf(VARP x);
 MNN_PUBLIC VARP _Erfc(VARP x);
 MNN_PUBLIC VARP _Erfinv(VARP x);
 MNN_PUBLIC VARP _Expm1(VARP x);
+MNN_PUBLIC VARP _Silu(VARP x);
+MNN_PUBLIC VARP _Gelu(VARP x, bool approximate = false);
 
 
 //ReduceOPs
@@ -135,6 +135,8 @@ MNN_PUBLIC VARP _FloatToInt8(VARP x, VARP scale, char minValue, char maxValue);
 MNN_PUBLIC VARP _Int8ToFloat(VARP x, VARP scale);
 
 MNN_PUBLIC VARP _Select(VARP select, VARP input0, VARP input1);
+MNN_PUBLIC VARP _Attention(VARP query, VARP key, VARP value, VARP mask = nullptr, float scale = 0.0f);
+MNN_PUBLIC VARP _EmbeddingBag(VARP weight, VARP indices, VARP offsets = nullptr, bool mean = false);
 
 } // namespace Express
 } // namespace MNN
@@ -30,6 +30,12 @@ struct WhileParamT;
 struct IfParam;
 struct IfParamT;
 
+struct AttentionParam;
+struct AttentionParamT;
+
+struct EmbeddingBagParam;
+struct EmbeddingBagParamT;
+
 struct Op;
 struct OpT;
 
@@ -58,6 +64,10 @@ inline const flatbuffers::TypeTable *WhileParamTypeTable();
 
 inline const flatbuffers::TypeTable *IfParamTypeTable();
 
+inline const flatbuffers::TypeTable *AttentionParamTypeTable();
+
+inline const flatbuffers::TypeTable *EmbeddingBagParamTypeTable();
+
 inline const flatbuffers::TypeTable *OpTypeTable();
 
 inline const flatbuffers::TypeTable *ViewTypeTable();
@@ -221,11 +231,14 @@ enum OpType {
   OpType_While = 600,
   OpType_If = 601,
   OpType_LayerNorm = 603,
+  OpType_Attention = 604,
+  OpType_EmbeddingBag = 605,
+  OpType_LSTMRecurrence = 606,
   OpType_MIN = OpType_AbsVal,
-  OpType_MAX = OpType_LayerNorm
+  OpType_MAX = OpType_LSTMRecurrence
 };
 
-inline const OpType (&EnumValuesOpType())[150] {
+inline const OpType (&EnumValuesOpType())[153] {
   static const OpType values[] = {
     OpType_AbsVal,
     OpType_QuantizedAdd,
@@ -376,7 +389,10 @@ inline const OpType (&EnumValuesOpType())[150] {
     OpType_EltwiseInt8,
     OpType_While,
     OpType_If,
-    OpType_LayerNorm
+    OpType_LayerNorm,
+    OpType_Attention,
+    OpType_EmbeddingBag,
+    OpType_LSTMRecurrence
   };
   return values;
 }
@@ -987,13 +1003,16 @@ inline const char * const *EnumNamesOpType() {
     "If",
     "",
     "LayerNorm",
+    "Attention",
+    "EmbeddingBag",
+    "LSTMRecurrence",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNameOpType(OpType e) {
-  if (e < OpType_AbsVal || e > OpType_LayerNorm) return "";
+  if (e < OpType_AbsVal || e > OpType_LSTMRecurrence) return "";
   const size_t index = static_cast<int>(e);
   return EnumNamesOpType()[index];
 }
@@ -1088,11 +1107,13 @@ enum OpParameter {
   OpParameter_IfParam = 86,
   OpParameter_RandomUniform = 87,
   OpParameter_LayerNorm = 88,
+  OpParameter_AttentionParam = 89,
+  OpParameter_EmbeddingBagParam = 90,
   OpParameter_MIN = OpParameter_NONE,
-  OpParameter_MAX = OpParameter_LayerNorm
+  OpParameter_MAX = OpParameter_EmbeddingBagParam
 };
 
-inline const OpParameter (&EnumValuesOpParameter())[89] {
+inline const OpParameter (&EnumValuesOpParameter())[91] {
   static const OpParameter values[] = {
     OpParameter_NONE,
     OpParameter_QuantizedAdd,
@@ -1182,7 +1203,9 @@ inline const OpParameter (&EnumValuesOpParameter())[89] {
     OpParameter_WhileParam,
     OpParameter_IfParam,
     OpParameter_RandomUniform,
-    OpParameter_LayerNorm
+    OpParameter_LayerNorm,
+    OpParameter_AttentionParam,
+    OpParameter_EmbeddingBagParam
   };
   return values;
 }
@@ -1278,13 +1301,15 @@ inline const char * const *EnumNamesOpParameter() {
     "IfParam",
     "RandomUniform",
     "LayerNorm",
+    "AttentionParam",
+    "EmbeddingBagParam",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNameOpParameter(OpParameter e) {
-  if (e < OpParameter_NONE || e > OpParameter_LayerNorm) return "";
+  if (e < OpParameter_NONE || e > OpParameter_EmbeddingBagParam) return "";
   const size_t index = static_cast<int>(e);
   return EnumNamesOpParameter()[index];
 }
@@ -1645,6 +1670,14 @@ template<> struct OpParameterTraits<LayerNorm> {
   static const OpParameter enum_value = OpParameter_LayerNorm;
 };
 
+template<> struct OpParameterTraits<AttentionParam> {
+  static const OpParameter enum_value = OpParameter_AttentionParam;
+};
+
+template<> struct OpParameterTraits<EmbeddingBagParam> {
+  static const OpParameter enum_value = OpParameter_EmbeddingBagParam;
+};
+
 struct OpParameterUnion {
   OpParameter type;
   void *value;
@@ -2380,6 +2413,22 @@ struct OpParameterUnion {
     return type == OpParameter_LayerNorm ?
       reinterpret_cast<const LayerNormT *>(value) : nullptr;
   }
+  AttentionParamT *AsAttentionParam() {
+    return type == OpParameter_AttentionParam ?
+      reinterpret_cast<AttentionParamT *>(value) : nullptr;
+  }
+  const AttentionParamT *AsAttentionParam() const {
+    return type == OpParameter_AttentionParam ?
+      reinterpret_cast<const AttentionParamT *>(value) : nullptr;
+  }
+  EmbeddingBagParamT *AsEmbeddingBagParam() {
+    return type == OpParameter_EmbeddingBagParam ?
+      reinterpret_cast<EmbeddingBagParamT *>(value) : nullptr;
+  }
+  const EmbeddingBagParamT *AsEmbeddingBagParam() const {
+    return type == OpParameter_EmbeddingBagParam ?
+      reinterpret_cast<const EmbeddingBagParamT *>(value) : nullptr;
+  }
 };
 
 bool VerifyOpParameter(flatbuffers::Verifier &verifier, const void *obj, OpParameter type);
@@ -2960,6 +3009,120 @@ inline flatbuffers::Offset<IfParam> CreateIfParamDirect(
 
 flatbuffers::Offset<IfParam> CreateIfParam(flatbuffers::FlatBufferBuilder &_fbb, const IfParamT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
+struct AttentionParamT : public flatbuffers::NativeTable {
+  typedef AttentionParam TableType;
+  float scale;
+  AttentionParamT()
+      : scale(0.0f) {
+  }
+};
+
+struct AttentionParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AttentionParamT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return AttentionParamTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SCALE = 4
+  };
+  float scale() const {
+    return GetField<float>(VT_SCALE, 0.0f);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<float>(verifier, VT_SCALE) &&
+           verifier.EndTable();
+  }
+  AttentionParamT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(AttentionParamT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<AttentionParam> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AttentionParamT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct AttentionParamBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_scale(float scale) {
+    fbb_.AddElement<float>(AttentionParam::VT_SCALE, scale, 0.0f);
+  }
+  explicit AttentionParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  AttentionParamBuilder &operator=(const AttentionParamBuilder &);
+  flatbuffers::Offset<AttentionParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<AttentionParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<AttentionParam> CreateAttentionParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    float scale = 0.0f) {
+  AttentionParamBuilder builder_(_fbb);
+  builder_.add_scale(scale);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<AttentionParam> CreateAttentionParam(flatbuffers::FlatBufferBuilder &_fbb, const AttentionParamT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct EmbeddingBagParamT : public flatbuffers::NativeTable {
+  typedef EmbeddingBagParam TableType;
+  ReductionType mode;
+  EmbeddingBagParamT()
+      : mode(ReductionType_SUM) {
+  }
+};
+
+struct EmbeddingBagParam FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EmbeddingBagParamT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return EmbeddingBagParamTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_MODE = 4
+  };
+  ReductionType mode() const {
+    return static_cast<ReductionType>(GetField<int8_t>(VT_MODE, 0));
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_MODE) &&
+           verifier.EndTable();
+  }
+  EmbeddingBagParamT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EmbeddingBagParamT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<EmbeddingBagParam> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EmbeddingBagParamT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EmbeddingBagParamBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_mode(ReductionType mode) {
+    fbb_.AddElement<int8_t>(EmbeddingBagParam::VT_MODE, static_cast<int8_t>(mode), 0);
+  }
+  explicit EmbeddingBagParamBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  EmbeddingBagParamBuilder &operator=(const EmbeddingBagParamBuilder &);
+  flatbuffers::Offset<EmbeddingBagParam> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<EmbeddingBagParam>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<EmbeddingBagParam> CreateEmbeddingBagParam(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    ReductionType mode = ReductionType_SUM) {
+  EmbeddingBagParamBuilder builder_(_fbb);
+  builder_.add_mode(mode);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<EmbeddingBagParam> CreateEmbeddingBagParam(flatbuffers::FlatBufferBuilder &_fbb, const EmbeddingBagParamT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
 struct OpT : public flatbuffers::NativeTable {
   typedef Op TableType;
   std::vector<int32_t> inputIndexes;
@@ -3262,6 +3425,12 @@ struct Op FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const LayerNorm *main_as_LayerNorm() const {
     return main_type() == OpParameter_LayerNorm ? static_cast<const LayerNorm *>(main()) : nullptr;
   }
+  const AttentionParam *main_as_AttentionParam() const {
+    return main_type() == OpParameter_AttentionParam ? static_cast<const AttentionParam *>(main()) : nullptr;
+  }
+  const EmbeddingBagParam *main_as_EmbeddingBagParam() const {
+    return main_type() == OpParameter_EmbeddingBagParam ? static_cast<const EmbeddingBagParam *>(main()) : nullptr;
+  }
   const flatbuffers::String *name() const {
     return GetPointer<const flatbuffers::String *>(VT_NAME);
   }
@@ -3646,6 +3815,14 @@ template<> inline const LayerNorm *Op::main_as<LayerNorm>() const {
   return main_as_LayerNorm();
 }
 
+template<> inline const AttentionParam *Op::main_as<AttentionParam>() const {
+  return main_as_AttentionParam();
+}
+
+template<> inline const EmbeddingBagParam *Op::main_as<EmbeddingBagParam>() const {
+  return main_as_EmbeddingBagParam();
+}
+
 struct OpBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
@@ -4532,6 +4709,58 @@ inline flatbuffers::Offset<IfParam> CreateIfParam(flatbuffers::FlatBufferBuilder
       _aliases_outputs);
 }
 
+inline AttentionParamT *AttentionParam::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AttentionParamT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void AttentionParam::UnPackTo(AttentionParamT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = scale(); _o->scale = _e; };
+}
+
+inline flatbuffers::Offset<AttentionParam> AttentionParam::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AttentionParamT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAttentionParam(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<AttentionParam> CreateAttentionParam(flatbuffers::FlatBufferBuilder &_fbb, const AttentionParamT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AttentionParamT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _scale = _o->scale;
+  return MNN::CreateAttentionParam(
+      _fbb,
+      _scale);
+}
+
+inline EmbeddingBagParamT *EmbeddingBagParam::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new EmbeddingBagParamT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void EmbeddingBagParam::UnPackTo(EmbeddingBagParamT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = mode(); _o->mode = _e; };
+}
+
+inline flatbuffers::Offset<EmbeddingBagParam> EmbeddingBagParam::Pack(flatbuffers::FlatBufferBuilder &_fbb, const EmbeddingBagParamT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateEmbeddingBagParam(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<EmbeddingBagParam> CreateEmbeddingBagParam(flatbuffers::FlatBufferBuilder &_fbb, const EmbeddingBagParamT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const EmbeddingBagParamT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _mode = _o->mode;
+  return MNN::CreateEmbeddingBagParam(
+      _fbb,
+      _mode);
+}
+
 inline OpT *Op::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = new OpT();
   UnPackTo(_o, _resolver);
@@ -5126,6 +5355,14 @@ inline bool VerifyOpParameter(flatbuffers::Verifier &verifier, const void *obj,
       auto ptr = reinterpret_cast<const LayerNorm *>(obj);
       return verifier.VerifyTable(ptr);
     }
+    case OpParameter_AttentionParam: {
+      auto ptr = reinterpret_cast<const AttentionParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case OpParameter_EmbeddingBagParam: {
+      auto ptr = reinterpret_cast<const EmbeddingBagParam *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
     default: return false;
   }
 }
@@ -5496,6 +5733,14 @@ inline void *OpParameterUnion::UnPack(const void *obj, OpParameter type, const f
       auto ptr = reinterpret_cast<const LayerNorm *>(obj);
       return ptr->UnPack(resolver);
     }
+    case OpParameter_AttentionParam: {
+      auto ptr = reinterpret_cast<const AttentionParam *>(obj);
+      return ptr->UnPack(resolver);
+    }
+    case OpParameter_EmbeddingBagParam: {
+      auto ptr = reinterpret_cast<const EmbeddingBagParam *>(obj);
+      return ptr->UnPack(resolver);
+    }
     default: return nullptr;
   }
 }
@@ -5854,6 +6099,14 @@ inline flatbuffers::Offset<void> OpParameterUnion::Pack(flatbuffers::FlatBufferB
       auto ptr = reinterpret_cast<const LayerNormT *>(value);
       return CreateLayerNorm(_fbb, ptr, _rehasher).Union();
     }
+    case OpParameter_AttentionParam: {
+      auto ptr = reinterpret_cast<const AttentionParamT *>(value);
+      return CreateAttentionParam(_fbb, ptr, _rehasher).Union();
+    }
+    case OpParameter_EmbeddingBagParam: {
+      auto ptr = reinterpret_cast<const EmbeddingBagParamT *>(value);
+      return CreateEmbeddingBagParam(_fbb, ptr, _rehasher).Union();
+    }
     default: return 0;
   }
 }
@@ -6212,6 +6465,14 @@ inline OpParameterUnion::OpParameterUnion(const OpParameterUnion &u) FLATBUFFERS
       value = new LayerNormT(*reinterpret_cast<LayerNormT *>(u.value));
       break;
     }
+    case OpParameter_AttentionParam: {
+      value = new AttentionParamT(*reinterpret_cast<AttentionParamT *>(u.value));
+      break;
+    }
+    case OpParameter_EmbeddingBagParam: {
+      value = new EmbeddingBagParamT(*reinterpret_cast<EmbeddingBagParamT *>(u.value));
+      break;
+    }
     default:
       break;
   }
@@ -6659,6 +6920,16 @@ inline void OpParameterUnion::Reset() {
       delete ptr;
       break;
     }
+    case OpParameter_AttentionParam: {
+      auto ptr = reinterpret_cast<AttentionParamT *>(value);
+      delete ptr;
+      break;
+    }
+    case OpParameter_EmbeddingBagParam: {
+      auto ptr = reinterpret_cast<EmbeddingBagParamT *>(value);
+      delete ptr;
+      break;
+    }
     default: break;
   }
   value = nullptr;
@@ -6816,12 +7087,15 @@ inline const flatbuffers::TypeTable *OpTypeTypeTable() {
     { flatbuffers::ET_INT, 0, 0 },
     { flatbuffers::ET_INT, 0, 0 },
     { flatbuffers::ET_INT, 0, 0 },
+    { flatbuffers::ET_INT, 0, 0 },
+    { flatbuffers::ET_INT, 0, 0 },
+    { flatbuffers::ET_INT, 0, 0 },
     { flatbuffers::ET_INT, 0, 0 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     OpTypeTypeTable
   };
-  static const int64_t values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 128, 129, 130, 131, 132, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 512, 513, 514, 515, 516, 517, 518, 600, 601, 603 };
+  static const int64_t values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 128, 129, 130, 131, 132, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 512, 513, 514, 515, 516, 517, 518, 600, 601, 603, 604, 605, 606 };
   static const char * const names[] = {
     "AbsVal",
     "QuantizedAdd",
@@ -6972,10 +7246,13 @@ inline const flatbuffers::TypeTable *OpTypeTypeTable() {
     "EltwiseInt8",
     "While",
     "If",
-    "LayerNorm"
+    "LayerNorm",
+    "Attention",
+    "EmbeddingBag",
+    "LSTMRecurrence"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_ENUM, 150, type_codes, type_refs, values, names
+    flatbuffers::ST_ENUM, 153, type_codes, type_refs, values, names
   };
   return &tt;
 }
@@ -7070,7 +7347,9 @@ inline const flatbuffers::TypeTable *OpParameterTypeTable() {
     { flatbuffers::ET_SEQUENCE, 0, 84 },
     { flatbuffers::ET_SEQUENCE, 0, 85 },
     { flatbuffers::ET_SEQUENCE, 0, 86 },
-    { flatbuffers::ET_SEQUENCE, 0, 87 }
+    { flatbuffers::ET_SEQUENCE, 0, 87 },
+    { flatbuffers::ET_SEQUENCE, 0, 88 },
+    { flatbuffers::ET_SEQUENCE, 0, 89 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     QuantizedAddTypeTable,
@@ -7160,7 +7439,9 @@ inline const flatbuffers::TypeTable *OpParameterTypeTable() {
     WhileParamTypeTable,
     IfParamTypeTable,
     RandomUniformTypeTable,
-    LayerNormTypeTable
+    LayerNormTypeTable,
+    AttentionParamTypeTable,
+    EmbeddingBagParamTypeTable
   };
   static const char * const names[] = {
     "NONE",
@@ -7251,10 +7532,12 @@ inline const flatbuffers::TypeTable *OpParameterTypeTable() {
     "WhileParam",
     "IfParam",
     "RandomUniform",
-    "LayerNorm"
+    "LayerNorm",
+    "AttentionParam",
+    "EmbeddingBagParam"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_UNION, 89, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_UNION, 91, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
@@ -7402,6 +7685,35 @@ inline const flatbuffers::TypeTable *IfParamTypeTable() {
   return &tt;
 }
 
+inline const flatbuffers::TypeTable *AttentionParamTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_FLOAT, 0, -1 }
+  };
+  static const char * const names[] = {
+    "scale"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *EmbeddingBagParamTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_CHAR, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    ReductionTypeTypeTable
+  };
+  static const char * const names[] = {
+    "mode"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
 inline const flatbuffers::TypeTable *OpTypeTable() {
   static const flatbuffers::TypeCode type_codes[] = {
     { flatbuffers::ET_INT, 1, -1 },
@@ -364,11 +364,14 @@ enum UnaryOpOperation {
   UnaryOpOperation_EXPM1 = 28,
   UnaryOpOperation_SIGMOID = 29,
   UnaryOpOperation_TANH = 30,
+  UnaryOpOperation_GELU = 31,
+  UnaryOpOperation_GELU_STANDARD = 32,
+  UnaryOpOperation_SILU = 33,
   UnaryOpOperation_MIN = UnaryOpOperation_ABS,
-  UnaryOpOperation_MAX = UnaryOpOperation_TANH
+  UnaryOpOperation_MAX = UnaryOpOperation_SILU
 };
 
-inline const UnaryOpOperation (&EnumValuesUnaryOpOperation())[31] {
+inline const UnaryOpOperation (&EnumValuesUnaryOpOperation())[34] {
   static const UnaryOpOperation values[] = {
     UnaryOpOperation_ABS,
     UnaryOpOperation_NEG,
@@ -400,7 +403,10 @@ inline const UnaryOpOperation (&EnumValuesUnaryOpOperation())[31] {
     UnaryOpOperation_ERFINV,
     UnaryOpOperation_EXPM1,
     UnaryOpOperation_SIGMOID,
-    UnaryOpOperation_TANH
+    UnaryOpOperation_TANH,
+    UnaryOpOperation_GELU,
+    UnaryOpOperation_GELU_STANDARD,
+    UnaryOpOperation_SILU
   };
   return values;
 }
@@ -438,13 +444,16 @@ inline const char * const *EnumNamesUnaryOpOperation() {
     "EXPM1",
     "SIGMOID",
     "TANH",
+    "GELU",
+    "GELU_STANDARD",
+    "SILU",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNameUnaryOpOperation(UnaryOpOperation e) {
-  if (e < UnaryOpOperation_ABS || e > UnaryOpOperation_TANH) return "";
+  if (e < UnaryOpOperation_ABS || e > UnaryOpOperation_SILU) return "";
   const size_t index = static_cast<int>(e);
   return EnumNamesUnaryOpOperation()[index];
 }
@@ -4715,6 +4724,9 @@ inline const flatbuffers::TypeTable *UnaryOpOperationTypeTable() {
     { flatbuffers::ET_INT, 0, 0 },
     { flatbuffers::ET_INT, 0, 0 },
     { flatbuffers::ET_INT, 0, 0 },
+    { flatbuffers::ET_INT, 0, 0 },
+    { flatbuffers::ET_INT, 0, 0 },
+    { flatbuffers::ET_INT, 0, 0 },
     { flatbuffers::ET_INT, 0, 0 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
@@ -4751,10 +4763,13 @@ inline const flatbuffers::TypeTable *UnaryOpOperationTypeTable() {
     "ERFINV",
     "EXPM1",
     "SIGMOID",
-    "TANH"
+    "TANH",
+    "GELU",
+    "GELU_STANDARD",
+    "SILU"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_ENUM, 31, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_ENUM, 34, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
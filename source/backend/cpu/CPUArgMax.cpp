@@ -8,13 +8,66 @@
 
 #include "backend/cpu/CPUArgMax.hpp"
 #include <float.h>
+#include <string.h>
 #include "backend/cpu/CPUBackend.hpp"
 #include "backend/cpu/compute/CommonOptFunction.h"
+#include "backend/cpu/compute/TopK.hpp"
+#include "core/Concurrency.h"
 #include "core/TensorUtils.hpp"
 #include <vector>
 
+// Keys reduced together when the reduced axis is not the last one
+#define MNN_ARGMAX_KEY_BLOCK 256
+
 namespace MNN {
 
+// The first index of the max (or min) along dim, the input is [num, dim, keyExtent]
+template <bool MAX>
+static void _argExtreme(const float* src, int* dst, int num, int dim, int keyExtent, Backend* bn) {
+    auto backend     = [bn]() { return bn; };
+    int threadNumber = static_cast<CPUBackend*>(bn)->threadNumber();
+    if (1 == keyExtent) {
+        threadNumber = std::max(std::min(threadNumber, num), 1);
+        MNN_CONCURRENCY_BEGIN(tId, threadNumber) {
+            float extreme;
+            for (int i = (int)tId; i < num; i += threadNumber) {
+                auto row = src + (size_t)i * dim;
+                dst[i]   = MAX ? ArgMaxFloat(row, dim, extreme) : ArgMinFloat(row, dim, extreme);
+            }
+        }
+        MNN_CONCURRENCY_END();
+        return;
+    }
+    // Running extremes of a block of keys, updated by rows of dim so that the inner loop is vectorized
+    const int keyBlocks = UP_DIV(keyExtent, MNN_ARGMAX_KEY_BLOCK);
+    const int tasks     = num * keyBlocks;
+    threadNumber        = std::max(std::min(threadNumber, tasks), 1);
+    MNN_CONCURRENCY_BEGIN(tId, threadNumber) {
+        float best[MNN_ARGMAX_KEY_BLOCK];
+        int index[MNN_ARGMAX_KEY_BLOCK];
+        for (int t = (int)tId; t < tasks; t += threadNumber) {
+            int i      = t / keyBlocks;
+            int kStart = (t % keyBlocks) * MNN_ARGMAX_KEY_BLOCK;
+            int count  = std::min(keyExtent - kStart, MNN_ARGMAX_KEY_BLOCK);
+            auto iptr  = src + (size_t)i * dim * keyExtent + kStart;
+            for (int k = 0; k < count; ++k) {
+                best[k]  = iptr[k];
+                index[k] = 0;
+            }
+            for (int j = 1; j < dim; ++j) {
+                auto row = iptr + (size_t)j * keyExtent;
+                for (int k = 0; k < count; ++k) {
+                    bool better = MAX ? row[k] > best[k] : row[k] < best[k];
+                    best[k]     = better ? row[k] : best[k];
+                    index[k]    = better ? j : index[k];
+                }
+            }
+            ::memcpy(dst + (size_t)i * keyExtent + kStart, index, count * sizeof(int));
+        }
+    }
+    MNN_CONCURRENCY_END();
+}
+
 CPUArgMax::CPUArgMax(Backend *backend, ArgMinOrMax mode, int topk, int outMaxVal, int softmaxThreshold, int axis)
     : Execution(backend), mTopk(topk), mOutMaxVal(outMaxVal), mSoftmaxThreshold(softmaxThreshold), mAxis(axis), mMode(mode) {
     // nothing to do
@@ -113,48 +166,13 @@ ErrorCode CPUArgMax::onExecute(const std::vector<Tensor *> &inputs, const std::v
     };
 
     if (mFromNHWC) {
+        auto srcOrigin = input->host<float>();
+        auto dstOrigin = output->host<int>();
         if (mMode == ARGMAX) {
-            auto srcOrigin = input->host<float>();
-            auto dstOrigin = output->host<int>();
-            for (int i = 0; i < mNum; ++i) {
-                auto iptr = srcOrigin + i * mDim * mKeyExtent;
-                auto optr = dstOrigin + i * mKeyExtent;
-
-                for(int k = 0; k < mKeyExtent; ++k){
-                    int index      = 0;
-                    float maxValue = -FLT_MAX;
-                    for (int j = 0; j < mDim; ++j) {
-                        auto val = iptr[k + j * mKeyExtent];
-                        if (val > maxValue) {
-                            maxValue = val;
-                            index    = j;
-                        }
-                    }
-                    optr[k] = index;
-                }
-            }
+            _argExtreme<true>(srcOrigin, dstOrigin, mNum, mDim, mKeyExtent, backend());
         } else {
-            auto srcOrigin = input->host<float>();
-            auto dstOrigin = output->host<int>();
-            for (int i = 0; i < mNum; ++i) {
-                auto iptr = srcOrigin + i * mDim * mKeyExtent;
-                auto optr = dstOrigin + i * mKeyExtent;
-
-                for(int k = 0; k < mKeyExtent; ++k){
-                    int index      = 0;
-                    float minValue = FLT_MAX;
-                    for (int j = 0; j < mDim; ++j) {
-                        auto val = iptr[k + j * mKeyExtent];
-                        if (val < minValue) {
-                            minValue = val;
-                            index    = j;
-                        }
-                    }
-                    optr[k] = index;
-                }
-            }
+            _argExtreme<false>(srcOrigin, dstOrigin, mNum, mDim, mKeyExtent, backend());
         }
-
     } else {
         MNN_ASSERT(mMode == ARGMAX); // caffe does not have argmin layer
         // Legacy code for CAFFE
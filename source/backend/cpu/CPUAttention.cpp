@@ -0,0 +1,282 @@
+//
+//  CPUAttention.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/CPUAttention.hpp"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include "backend/cpu/CPUBackend.hpp"
+#include "backend/cpu/compute/CommonOptFunction.h"
+#include "core/Concurrency.h"
+#include "core/Macro.h"
+#include "math/Vec.hpp"
+using Vec4 = MNN::Math::Vec<float, 4>;
+
+// Keys of a block, the scores of eP x MNN_ATTENTION_KEY_BLOCK are kept in cache
+#define MNN_ATTENTION_KEY_BLOCK 128
+
+namespace MNN {
+struct AttentionCache {
+    float* keyPack;
+    float* valuePack;
+    float* queryC4;
+    float* queryPack;
+    float* scoreC4;
+    float* scorePack;
+    float* tempC4;
+    float* outputC4;
+    float* rowMax;
+    float* rowSum;
+    float* rowFactor;
+    float* matmulCache;
+};
+
+// Layout of the cache of a thread, returns the size
+static int _layoutCache(AttentionCache* cache, float* base, int seqK, int depth, int depthV, int keyBlock) {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    auto blockNumber = UP_DIV(seqK, keyBlock);
+    int sizes[] = {
+        blockNumber * UP_DIV(keyBlock, hP) * hP * depth,  // keyPack
+        blockNumber * UP_DIV(depthV, hP) * hP * keyBlock, // valuePack
+        UP_DIV(depth, 4) * 4 * eP,                        // queryC4
+        UP_DIV(depth, 4) * 4 * eP,                        // queryPack
+        UP_DIV(keyBlock, 4) * 4 * eP,                     // scoreC4
+        UP_DIV(keyBlock, 4) * 4 * eP,                     // scorePack
+        UP_DIV(depthV, 4) * 4 * eP,                       // tempC4
+        UP_DIV(depthV, 4) * 4 * eP,                       // outputC4
+        eP,                                               // rowMax
+        eP,                                               // rowSum
+        eP,                                               // rowFactor
+        0,                                                // matmulCache
+    };
+    if (hP % 4 != 0) {
+        sizes[11] = eP * MNNGetC4DivNumber(hP) * 4 + std::max(UP_DIV(keyBlock, 4), UP_DIV(depthV, 4)) * eP * 4;
+    }
+    float** ptrs[] = {&cache->keyPack,  &cache->valuePack, &cache->queryC4, &cache->queryPack,
+                      &cache->scoreC4,  &cache->scorePack, &cache->tempC4,  &cache->outputC4,
+                      &cache->rowMax,   &cache->rowSum,    &cache->rowFactor, &cache->matmulCache};
+    int offset = 0;
+    for (int i = 0; i < (int)(sizeof(sizes) / sizeof(int)); ++i) {
+        if (nullptr != cache) {
+            *ptrs[i] = base + offset;
+        }
+        // Keep each part aligned
+        offset += UP_DIV(sizes[i], 16) * 16;
+    }
+    return offset;
+}
+
+CPUAttention::CPUAttention(Backend* backend, float scale) : Execution(backend) {
+    mParamScale = scale;
+}
+
+ErrorCode CPUAttention::onResize(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
+    auto query      = inputs[0];
+    auto key        = inputs[1];
+    auto value      = inputs[2];
+    auto dimensions = query->dimensions();
+    mBatch          = 1;
+    for (int i = 0; i < dimensions - 2; ++i) {
+        mBatch *= query->length(i);
+    }
+    mSeqQ   = query->length(dimensions - 2);
+    mDepth  = query->length(dimensions - 1);
+    mSeqK   = key->length(dimensions - 2);
+    mDepthV = value->length(dimensions - 1);
+    mScale  = mParamScale;
+    if (0.0f == mScale) {
+        mScale = 1.0f / sqrtf((float)mDepth);
+    }
+    mKeyBlock = std::min(mSeqK, MNN_ATTENTION_KEY_BLOCK);
+
+    // Broadcast the mask to [batch, seqQ, seqK]
+    mMaskOffset.clear();
+    mMaskRowStride = 0;
+    if (inputs.size() > 3) {
+        auto mask      = inputs[3];
+        auto maskDim   = mask->dimensions();
+        auto offset    = dimensions - maskDim;
+        mMaskRowStride = (maskDim >= 2 && mask->length(maskDim - 2) != 1) ? mSeqK : 0;
+        mMaskOffset.resize(mBatch);
+        for (int b = 0; b < mBatch; ++b) {
+            int rest       = b;
+            int maskOffset = 0;
+            int maskStride = mSeqK * (maskDim >= 2 ? mask->length(maskDim - 2) : 1);
+            for (int i = dimensions - 3; i >= 0; --i) {
+                int index = rest % query->length(i);
+                rest      = rest / query->length(i);
+                if (i < offset) {
+                    continue;
+                }
+                auto length = mask->length(i - offset);
+                if (length != 1) {
+                    maskOffset += index * maskStride;
+                }
+                maskStride *= length;
+            }
+            mMaskOffset[b] = maskOffset;
+        }
+    }
+
+    mThreadNumber = std::min(static_cast<CPUBackend*>(backend())->threadNumber(), mBatch);
+    auto cacheSize = _layoutCache(nullptr, nullptr, mSeqK, mDepth, mDepthV, mKeyBlock);
+    mCache.reset(Tensor::createDevice<float>({mThreadNumber, cacheSize}));
+    auto res = backend()->onAcquireBuffer(mCache.get(), Backend::DYNAMIC);
+    if (!res) {
+        return OUT_OF_MEMORY;
+    }
+    backend()->onReleaseBuffer(mCache.get(), Backend::DYNAMIC);
+    return NO_ERROR;
+}
+
+void CPUAttention::_computeHead(float* dst, const float* query, const float* key, const float* value,
+                                const float* mask, float* cacheBase) const {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    AttentionCache cache;
+    _layoutCache(&cache, cacheBase, mSeqK, mDepth, mDepthV, mKeyBlock);
+    auto blockNumber    = UP_DIV(mSeqK, mKeyBlock);
+    auto keyBlockSize   = UP_DIV(mKeyBlock, hP) * hP * mDepth;
+    auto valueBlockSize = UP_DIV(mDepthV, hP) * hP * mKeyBlock;
+    // Pack K and V once, they are used by all tiles of queries
+    for (int j = 0; j < blockNumber; ++j) {
+        auto keyStart = j * mKeyBlock;
+        auto keyCount = std::min(mKeyBlock, mSeqK - keyStart);
+        MNNPackForMatMul_B(cache.keyPack + j * keyBlockSize, key + keyStart * mDepth, keyCount, mDepth, true);
+        MNNPackForMatMul_B(cache.valuePack + j * valueBlockSize, value + keyStart * mDepthV, mDepthV, keyCount, false);
+    }
+    auto depthVC4 = UP_DIV(mDepthV, 4);
+    for (int queryStart = 0; queryStart < mSeqQ; queryStart += eP) {
+        auto e = std::min(eP, mSeqQ - queryStart);
+        // Q * K^T uses the packed Q of [depth, e] as A
+        MNNUnpackTranspose(cache.queryC4, query + queryStart * mDepth, e, mDepth);
+        MNNPackC4ForMatMul_A(cache.queryPack, cache.queryC4, e, mDepth, e);
+        for (int y = 0; y < e; ++y) {
+            cache.rowMax[y] = -FLT_MAX;
+            cache.rowSum[y] = 0.0f;
+        }
+        ::memset(cache.outputC4, 0, depthVC4 * e * 4 * sizeof(float));
+        for (int j = 0; j < blockNumber; ++j) {
+            auto keyStart = j * mKeyBlock;
+            auto keyCount = std::min(mKeyBlock, mSeqK - keyStart);
+            auto keyC4    = UP_DIV(keyCount, 4);
+            // parameters: e, l, h, CStride, AStride, BStride
+            size_t parameters[6] = {e * sizeof(float), (size_t)mDepth, (size_t)keyCount, e * 4 * sizeof(float), 0, 0};
+            if (e == eP) {
+                MNNPackedMatMul(cache.scoreC4, cache.queryPack, cache.keyPack + j * keyBlockSize, parameters,
+                                cache.matmulCache, nullptr, nullptr);
+            } else {
+                MNNPackedMatMulRemain(cache.scoreC4, cache.queryPack, cache.keyPack + j * keyBlockSize, e, parameters,
+                                      cache.matmulCache, nullptr, nullptr);
+            }
+            // Scale, mask and the max of rows, the keys out of block are -FLT_MAX so that their exp is 0
+            for (int y = 0; y < e; ++y) {
+                cache.rowFactor[y] = cache.rowMax[y];
+            }
+            for (int z = 0; z < keyC4; ++z) {
+                auto scoreZ = cache.scoreC4 + z * e * 4;
+                auto valid  = std::min(4, keyCount - z * 4);
+                for (int y = 0; y < e; ++y) {
+                    auto scoreY    = scoreZ + y * 4;
+                    const float* maskY = nullptr;
+                    if (nullptr != mask) {
+                        maskY = mask + (queryStart + y) * mMaskRowStride + keyStart + z * 4;
+                    }
+                    auto maxValue = cache.rowMax[y];
+                    for (int i = 0; i < 4; ++i) {
+                        float v = -FLT_MAX;
+                        if (i < valid) {
+                            v = scoreY[i] * mScale + (nullptr != maskY ? maskY[i] : 0.0f);
+                            v = ALIMAX(v, -FLT_MAX);
+                        }
+                        scoreY[i] = v;
+                        maxValue  = ALIMAX(maxValue, v);
+                    }
+                    cache.rowMax[y] = maxValue;
+                }
+            }
+            // exp(score - max), MNNExp computes exp(-x)
+            for (int z = 0; z < keyC4; ++z) {
+                auto scoreZ = cache.scoreC4 + z * e * 4;
+                for (int y = 0; y < e; ++y) {
+                    Vec4::save(scoreZ + 4 * y, Vec4(cache.rowMax[y]) - Vec4::load(scoreZ + 4 * y));
+                }
+            }
+            MNNExp(cache.scoreC4, cache.scoreC4, keyC4 * e * 4);
+            for (int y = 0; y < e; ++y) {
+                // The factor to rescale the previous blocks
+                cache.rowFactor[y] = expf(cache.rowFactor[y] - cache.rowMax[y]);
+                Vec4 sum(0.0f);
+                for (int z = 0; z < keyC4; ++z) {
+                    sum = sum + Vec4::load(cache.scoreC4 + z * e * 4 + 4 * y);
+                }
+                cache.rowSum[y] = cache.rowSum[y] * cache.rowFactor[y] + (sum[0] + sum[1] + sum[2] + sum[3]);
+            }
+            // P * V, the scores in C4 are just the source of packed A
+            MNNPackC4ForMatMul_A(cache.scorePack, cache.scoreC4, e, keyCount, e);
+            parameters[1] = keyCount;
+            parameters[2] = mDepthV;
+            if (e == eP) {
+                MNNPackedMatMul(cache.tempC4, cache.scorePack, cache.valuePack + j * valueBlockSize, parameters,
+                                cache.matmulCache, nullptr, nullptr);
+            } else {
+                MNNPackedMatMulRemain(cache.tempC4, cache.scorePack, cache.valuePack + j * valueBlockSize, e,
+                                      parameters, cache.matmulCache, nullptr, nullptr);
+            }
+            for (int z = 0; z < depthVC4; ++z) {
+                auto outputZ = cache.outputC4 + z * e * 4;
+                auto tempZ   = cache.tempC4 + z * e * 4;
+                for (int y = 0; y < e; ++y) {
+                    auto o = Vec4::load(outputZ + 4 * y) * cache.rowFactor[y] + Vec4::load(tempZ + 4 * y);
+                    Vec4::save(outputZ + 4 * y, o);
+                }
+            }
+        }
+        for (int z = 0; z < depthVC4; ++z) {
+            auto outputZ = cache.outputC4 + z * e * 4;
+            for (int y = 0; y < e; ++y) {
+                Vec4::save(outputZ + 4 * y, Vec4::load(outputZ + 4 * y) * (1.0f / cache.rowSum[y]));
+            }
+        }
+        MNNPackTranspose(dst + queryStart * mDepthV, cache.outputC4, e, mDepthV);
+    }
+}
+
+ErrorCode CPUAttention::onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
+    auto query  = inputs[0]->host<float>();
+    auto key    = inputs[1]->host<float>();
+    auto value  = inputs[2]->host<float>();
+    auto mask   = inputs.size() > 3 ? inputs[3]->host<float>() : nullptr;
+    auto output = outputs[0]->host<float>();
+    MNN_CONCURRENCY_BEGIN(tId, mThreadNumber) {
+        auto cache = mCache->host<float>() + tId * mCache->stride(0);
+        for (int b = (int)tId; b < mBatch; b += mThreadNumber) {
+            _computeHead(output + b * mSeqQ * mDepthV, query + b * mSeqQ * mDepth, key + b * mSeqK * mDepth,
+                         value + b * mSeqK * mDepthV, nullptr != mask ? mask + mMaskOffset[b] : nullptr, cache);
+        }
+    }
+    MNN_CONCURRENCY_END();
+    return NO_ERROR;
+}
+
+class CPUAttentionCreator : public CPUBackend::Creator {
+public:
+    virtual Execution* onCreate(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
+                                const MNN::Op* op, Backend* backend) const override {
+        float scale = 0.0f;
+        if (nullptr != op->main_as_AttentionParam()) {
+            scale = op->main_as_AttentionParam()->scale();
+        }
+        return new CPUAttention(backend, scale);
+    }
+};
+
+REGISTER_CPU_OP_CREATOR(CPUAttentionCreator, OpType_Attention);
+} // namespace MNN
@@ -0,0 +1,46 @@
+//
+//  CPUAttention.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef CPUAttention_hpp
+#define CPUAttention_hpp
+
+#include "core/Execution.hpp"
+
+namespace MNN {
+/**
+ * softmax(Q * K^T * scale + mask) * V for each of the leading dimensions. Queries are computed by tiles of eP rows
+ * and keys by blocks, the scores of a block are normalized by online softmax, so that they stay in cache.
+ */
+class CPUAttention : public Execution {
+public:
+    CPUAttention(Backend* backend, float scale);
+    virtual ~CPUAttention() = default;
+    virtual ErrorCode onResize(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) override;
+    virtual ErrorCode onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) override;
+
+private:
+    void _computeHead(float* dst, const float* query, const float* key, const float* value, const float* mask,
+                      float* cache) const;
+
+    float mParamScale;
+    float mScale;
+    int mBatch;
+    int mSeqQ;
+    int mSeqK;
+    int mDepth;
+    int mDepthV;
+    int mKeyBlock;
+    int mThreadNumber;
+    // Offset of mask for each of batch, and between rows of queries, 0 for broadcast
+    std::vector<int> mMaskOffset;
+    int mMaskRowStride;
+    std::shared_ptr<Tensor> mCache;
+};
+} // namespace MNN
+
+#endif /* CPUAttention_hpp */
@@ -9,9 +9,14 @@
 #include "backend/cpu/CPUBackend.hpp"
 #include <cmath>
 #include <mutex>
+#include <set>
 #include "core/BufferAllocator.hpp"
+#include "backend/cpu/CPUMmapAllocator.hpp"
+#include "backend/cpu/CPUNuma.hpp"
 #include "backend/cpu/CPUTensorConvert.hpp"
+#include "backend/cpu/CPUWeightCache.hpp"
 #include "backend/cpu/compute/CommonOptFunction.h"
+#include "core/OpCommonUtils.hpp"
 #include "core/TensorUtils.hpp"
 #include "backend/cpu/ThreadPool.hpp"
 #include "shape/SizeComputer.hpp"
@@ -23,6 +28,9 @@
 #if defined(__aarch64__) && ENABLE_ARMV82
 #include "backend/arm82/Arm82Backend.hpp"
 #endif
+#ifdef MNN_USE_SSE
+#include "backend/cpu/x86_x64/cpu_id.h"
+#endif
 #define MAX_THREAD_NUMBER 32
 #define LARGE_MEMORY 1024 * 1024 * 500
 
@@ -50,10 +58,40 @@ CPURuntime::CPURuntime(const Backend::Info& info) {
 #endif
     if (info.user != nullptr) {
         mPrecision = info.user->precision;
+        mBF16Convolution = info.user->bf16Convolution;
         mPower = info.user->power;
         mMemory = info.user->memory;
         mFlags = info.user->flags;
+        // Fall back to not bind if there is only one node
+        auto numa      = CPUNuma::get();
+        int staticNode = -1;
+        if (BackendConfig::Numa_None != info.user->numa && numa->nodeNumber() > 1 &&
+            !numa->cpus(info.user->numaNode).empty()) {
+            mNumaNode = info.user->numaNode;
+            if (BackendConfig::Numa_Replicate == info.user->numa) {
+                staticNode = mNumaNode;
+            }
+        }
+        auto page     = info.user->page;
+        auto prefault = info.user->prefault;
+        if (staticNode >= 0 || BackendConfig::Page_Normal != page || prefault) {
+            mStaticOutside.reset(new CPUMmapAllocator(staticNode, page, prefault, mThreadNumber));
+            mStaticAllocator.reset(new BufferAllocator(mStaticOutside));
+        }
+        if (mNumaNode >= 0) {
+            // Dynamic memory is bound to the node whether static memory is or not
+            mDynamicOutside.reset(new CPUMmapAllocator(mNumaNode, page, prefault, mThreadNumber));
+        }
     }
+    // The features that decide which kernels (and so the packed weight format) are used
+    int features = (mIsSupportDot ? 1 : 0) | (mIsSupportFp16arith ? 2 : 0);
+#ifdef MNN_USE_SSE
+    features |= libyuv::InitCpuFlags() & (libyuv::kCpuHasSSE41 | libyuv::kCpuHasAVX | libyuv::kCpuHasAVX2 |
+                                          libyuv::kCpuHasFMA3 | libyuv::kCpuHasAVX512BW | libyuv::kCpuHasAVX512VL |
+                                          libyuv::kCpuHasAVX512VNNI | libyuv::kCpuHasAVXVNNI |
+                                          libyuv::kCpuHasAVX512BF16 | libyuv::kCpuHasAMXBF16);
+#endif
+    mWeightCache.reset(new CPUWeightCache(features));
 #ifdef _OPENMP
     switch (mPower) {
         case BackendConfig::Power_Low:
@@ -67,29 +105,47 @@ CPURuntime::CPURuntime(const Backend::Info& info) {
     }
 #endif
 #ifdef MNN_USE_THREAD_POOL
-    mThreadNumber = ThreadPool::init(mThreadNumber);
+    // A runtime bound to a node uses the pool of the node, so that the shared pool used by others isn't bound
+    if (mNumaNode >= 0) {
+        mThreadNumber = ThreadPool::initNuma(mNumaNode, mThreadNumber);
+    } else {
+        mThreadNumber = ThreadPool::init(mThreadNumber);
+    }
     if (mThreadNumber > 1) {
         mTaskIndex = ThreadPool::acquireWorkIndex();
     } else {
         mTaskIndex = -1;
     }
     if (mTaskIndex >= 0 && mPower == BackendConfig::Power_High) {
-        ThreadPool::active();
+        ThreadPool::active(mNumaNode);
     }
 #endif
 }
 CPURuntime:: ~ CPURuntime() {
 #ifdef MNN_USE_THREAD_POOL
     if (mTaskIndex >= 0 && mPower == BackendConfig::Power_High) {
-        ThreadPool::deactive();
+        ThreadPool::deactive(mNumaNode);
     }
     ThreadPool::releaseWorkIndex(mTaskIndex);
+    if (mTaskIndex >= 0 && mNumaNode >= 0) {
+        ThreadPool::releaseNuma(mNumaNode);
+    }
 #endif
 }
 float CPURuntime::onGetMemoryInMB() {
     auto staticMemoryInMB = mStaticAllocator->totalSize() / 1024.0f / 1024.0f;
     return staticMemoryInMB;
 }
+float CPURuntime::onGetHugePageInMB() {
+    size_t hugePageSize = 0;
+    if (nullptr != mStaticOutside) {
+        hugePageSize += mStaticOutside->hugePageSize();
+    }
+    if (nullptr != mDynamicOutside) {
+        hugePageSize += mDynamicOutside->hugePageSize();
+    }
+    return hugePageSize / 1024.0f / 1024.0f;
+}
 Backend* CPURuntime::onCreate() const{
 #if defined(__aarch64__) && ENABLE_ARMV82
     if (mIsSupportFp16arith && mPrecision == BackendConfig::Precision_Low) {
@@ -101,6 +157,12 @@ Backend* CPURuntime::onCreate() const{
 void CPURuntime::onGabageCollect(int level) {
     mStaticAllocator->release(false);
 }
+bool CPURuntime::onSetCache(const void* buffer, size_t size) {
+    return mWeightCache->load(buffer, size);
+}
+std::pair<const void*, size_t> CPURuntime::onGetCache() {
+    return mWeightCache->save();
+}
 std::map<OpType, CPUBackend::Creator*>* CPUBackend::gCreator = nullptr;
 
 void CPUBackend::initCreatorMap() {
@@ -121,10 +183,80 @@ bool CPUBackend::addCreator(OpType t, Creator* c) {
     return true;
 }
 
+void CPUBackend::onElideRasters(CommandBuffer& buffer) const {
+    if (mCheckNAN) {
+        // CheckNANExecution reads the inputs as dense tensors
+        return;
+    }
+    // Only the Rasters of the intermediate tensors made by geometry, which no one else can read
+    std::set<const Tensor*> extras;
+    for (auto& t : buffer.extras) {
+        extras.insert(t.get());
+    }
+    auto getOp = [](const Command& cmd) {
+        if (!cmd.buffer.empty()) {
+            return flatbuffers::GetRoot<Op>(cmd.buffer.data());
+        }
+        return cmd.op;
+    };
+    std::map<const Tensor*, int> rasters;
+    std::map<const Tensor*, int> useCount;
+    for (int i = 0; i < buffer.command.size(); ++i) {
+        auto& cmd = buffer.command[i];
+        if (OpType_Raster == getOp(cmd)->type() && extras.find(cmd.outputs[0]) != extras.end()) {
+            rasters.insert(std::make_pair(cmd.outputs[0], i));
+        }
+        for (auto t : cmd.inputs) {
+            useCount[t] += 1;
+        }
+    }
+    if (rasters.empty()) {
+        return;
+    }
+    auto map = getCreatorMap();
+    std::vector<bool> removed(buffer.command.size(), false);
+    for (auto& cmd : buffer.command) {
+        auto op = getOp(cmd);
+        if (OpType_Raster == op->type()) {
+            continue;
+        }
+        auto creator = map->find(op->type());
+        if (creator == map->end()) {
+            continue;
+        }
+        for (int v = 0; v < cmd.inputs.size(); ++v) {
+            auto input = cmd.inputs[v];
+            auto iter  = rasters.find(input);
+            if (iter == rasters.end() || useCount[input] != 1 ||
+                TensorUtils::getDescribe(input)->usage != Tensor::InsideDescribe::NORMAL) {
+                continue;
+            }
+            auto view = buffer.command[iter->second].inputs[0];
+            if (nullptr == OpCommonUtils::getStridedView(view) ||
+                !creator->second->onSupportStridedInput(cmd.inputs, cmd.outputs, op, v, view)) {
+                continue;
+            }
+            cmd.inputs[v]         = view;
+            removed[iter->second] = true;
+        }
+    }
+    std::vector<Command> commands;
+    commands.reserve(buffer.command.size());
+    for (int i = 0; i < buffer.command.size(); ++i) {
+        if (!removed[i]) {
+            commands.emplace_back(std::move(buffer.command[i]));
+        }
+    }
+    buffer.command = std::move(commands);
+}
+
 CPUBackend::CPUBackend(const CPURuntime* runtime, MNNForwardType type) : Backend(type) {
     mRuntime = runtime;
     mCheckNAN = runtime->mFlags == MNN_CPU_CHECK_NAN;
     std::shared_ptr<BufferAllocator::Allocator> defaultAlloc(BufferAllocator::Allocator::createRecurse(runtime->mStaticAllocator.get()));
+    if (nullptr != runtime->mDynamicOutside) {
+        defaultAlloc = runtime->mDynamicOutside;
+    }
     mDynamicAllocator.reset(new BufferAllocator(defaultAlloc));
     mStaticAllocator = runtime->mStaticAllocator;
 }
@@ -132,6 +264,10 @@ bool CPUBackend::supportDot() const {
     return mRuntime->mIsSupportDot;
 }
 
+bool CPUBackend::useBF16() const {
+    return mRuntime->mBF16Convolution && MNNSupportBF16();
+}
+
 CPUBackend::~CPUBackend() {
     // Do nothing
 }
@@ -139,7 +275,7 @@ CPUBackend::~CPUBackend() {
 void CPUBackend::onExecuteBegin() const {
 #ifdef MNN_USE_THREAD_POOL
     if (mRuntime->mTaskIndex >= 0 && mRuntime->mPower != BackendConfig::Power_High) {
-        ThreadPool::active();
+        ThreadPool::active(mRuntime->mNumaNode);
     }
 #else
 #ifdef _OPENMP
@@ -151,7 +287,7 @@ void CPUBackend::onExecuteBegin() const {
 void CPUBackend::onExecuteEnd() const {
 #ifdef MNN_USE_THREAD_POOL
     if (mRuntime->mTaskIndex >= 0 && mRuntime->mPower != BackendConfig::Power_High) {
-        ThreadPool::deactive();
+        ThreadPool::deactive(mRuntime->mNumaNode);
     }
 #endif
 }
@@ -331,6 +467,53 @@ bool CPUBackend::onClearBuffer() {
     return true;
 }
 
+bool CPUBackend::onPlanMemory(MemoryPlanStage stage) {
+    switch (stage) {
+        case PLAN_RECORD:
+            mDynamicAllocator->beginRecord();
+            return true;
+        case PLAN_SOLVE:
+            return mDynamicAllocator->plan();
+        case PLAN_APPLY:
+            mDynamicAllocator->beginApply();
+            return true;
+        case PLAN_END:
+            return mDynamicAllocator->endPlan();
+        default:
+            break;
+    }
+    return false;
+}
+
+std::pair<size_t, size_t> CPUBackend::onGetMemoryPlan() const {
+    // Without a record, the greedy alloc is the current one
+    auto current = mDynamicAllocator->totalSize();
+    auto greedy  = mDynamicAllocator->greedySize();
+    return std::make_pair(greedy > 0 ? greedy : current, current);
+}
+
+bool CPUBackend::onTraceBuffer(BufferTrace* trace) {
+    mDynamicAllocator->setTrace(trace);
+    return true;
+}
+
+bool CPUBackend::onConcurrent(const std::function<void(int)>& task, int size) const {
+#ifdef MNN_USE_THREAD_POOL
+    int number = std::min(size, threadNumber());
+    std::pair<std::function<void(int)>, int> group;
+    group.second = number;
+    group.first  = [&](int tId) {
+        for (int k = tId; k < size; k += number) {
+            task(k);
+        }
+    };
+    ThreadPool::enqueue(std::move(group), taskIndex(), numaNode());
+    return true;
+#else
+    return false;
+#endif
+}
+
 std::pair<int, int> CPUBackend::multiThreadDivide(int size) const {
     int sizeDivide = size / threadNumber();
     sizeDivide = UP_DIV(sizeDivide, 4) * 4;
@@ -13,11 +13,14 @@
 #include <map>
 #include <memory>
 #include "core/Backend.hpp"
+#include "core/Command.hpp"
 #include "core/Execution.hpp"
 #include "MNN_generated.h"
 
 namespace MNN {
 class BufferAllocator;
+class CPUMmapAllocator;
+class CPUWeightCache;
 class CPURuntime : public Runtime {
 public:
     friend class CPUBackend;
@@ -32,14 +35,25 @@ public:
     virtual Backend* onCreate() const override;
     virtual void onGabageCollect(int level) override;
     virtual float onGetMemoryInMB() override;
+    virtual float onGetHugePageInMB() override;
+    // Packed weights of executions, see CPUWeightCache
+    virtual bool onSetCache(const void* buffer, size_t size) override;
+    virtual std::pair<const void*, size_t> onGetCache() override;
 private:
     std::shared_ptr<BufferAllocator> mStaticAllocator;
+    // Outside allocators by mmap for NUMA / huge page / prefault, nullptr if not used
+    std::shared_ptr<CPUMmapAllocator> mStaticOutside;
+    std::shared_ptr<CPUMmapAllocator> mDynamicOutside;
+    std::shared_ptr<CPUWeightCache> mWeightCache;
     int mThreadNumber;
     int mTaskIndex;
+    // NUMA node the runtime is bound to, -1 if not bound
+    int mNumaNode = -1;
     size_t mFlags;
     BackendConfig::MemoryMode mMemory;
     BackendConfig::PowerMode mPower;
     BackendConfig::PrecisionMode mPrecision;
+    bool mBF16Convolution = false;
 
     // Backend features
     // CPU features
@@ -60,6 +74,10 @@ public:
     virtual bool onAcquireBuffer(const Tensor* nativeTensor, StorageType storageType) override;
     virtual bool onReleaseBuffer(const Tensor* nativeTensor, StorageType storageType) override;
     virtual bool onClearBuffer() override;
+    virtual bool onPlanMemory(MemoryPlanStage stage) override;
+    virtual std::pair<size_t, size_t> onGetMemoryPlan() const override;
+    virtual bool onTraceBuffer(BufferTrace* trace) override;
+    virtual bool onConcurrent(const std::function<void(int)>& task, int size) const override;
     virtual void onCopyBuffer(const Tensor* srcTensor, const Tensor* dstTensor) const override;
     virtual std::pair<float, bool> onMeasure(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
                                             const MNN::Op* op) override;
@@ -68,12 +86,23 @@ public:
                                 const MNN::Op* op) override;
     virtual void onExecuteBegin() const override;
     virtual void onExecuteEnd() const override;
+    // Replace the inputs copied by a single region Raster with the view of it if the consumer supports, and remove
+    // the Raster
+    virtual void onElideRasters(CommandBuffer& buffer) const override;
     
 public:
     class Creator {
     public:
         virtual Execution* onCreate(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
                                     const MNN::Op* op, Backend* backend) const = 0;
+        /**
+         * Whether the execution can read inputs[index] as the strided view of OpCommonUtils::getStridedView, so that
+         * the Raster producing it is removed by onElideRasters
+         */
+        virtual bool onSupportStridedInput(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
+                                           const MNN::Op* op, int index, const Tensor* view) const {
+            return false;
+        }
     };
 
     static bool addCreator(OpType t, Creator* c);
@@ -89,10 +118,21 @@ public:
     BackendConfig::MemoryMode memoryMode() const {
         return mRuntime->mMemory;
     }
+
+    BackendConfig::PrecisionMode precisionMode() const {
+        return mRuntime->mPrecision;
+    }
+
+    CPUWeightCache* getWeightCache() const {
+        return mRuntime->mWeightCache.get();
+    }
 #ifdef MNN_USE_THREAD_POOL
     inline int taskIndex() const {return mRuntime->mTaskIndex;}
 #endif
+    inline int numaNode() const {return mRuntime->mNumaNode;}
     bool supportDot() const;
+    // BackendConfig::bf16Convolution on the CPU that has the bf16 GEMM, see MNNSupportBF16
+    bool useBF16() const;
     static void initCreatorMap();
 
 protected:
@@ -8,6 +8,7 @@
 
 #include "CPUBinary.hpp"
 #include <math.h>
+#include <string.h>
 #include <algorithm>
 #include "CPUBackend.hpp"
 #include "compute/CommonOptFunction.h"
@@ -15,6 +16,8 @@
 #include "core/Macro.h"
 #include "core/Concurrency.h"
 #include "core/OpCommonUtils.hpp"
+// Elements of a chunk for the binary of strided views
+#define MNN_BINARY_VIEW_CHUNK 256
 namespace MNN {
 #define MAX_DIM 6
 CPUBinaryInt::CPUBinaryInt(Backend* b, int32_t type) : MNN::Execution(b), mType(type) {
@@ -32,6 +35,7 @@ ErrorCode CPUBinaryFloat::onResize(const std::vector<Tensor*>& inputs, const std
     int maxCount = input0DataCount > input1DataCount ?  input0DataCount : input1DataCount;
     mElementProc = nullptr;
     mSupportScale = false;
+    mHasView = nullptr != OpCommonUtils::getStridedView(inputs[0]) || nullptr != OpCommonUtils::getStridedView(inputs[1]);
     if (outputs[0]->getType().code != halide_type_float || maxCount < 4 || (outputDataCount > input0DataCount && outputDataCount > input1DataCount)) {
         // Can't optimize
         return NO_ERROR;
@@ -327,6 +331,41 @@ struct BinaryNotEqual : std::binary_function<_Arg1, _Arg2, _ErrorCode> {
     }
 };
 
+// The elements [start, start + size) of a dense input or a strided view, gathered into buffer if not contiguous
+static const float* _readView(const float* host, const Tensor::InsideDescribe::Region* view, int start, int size,
+                              float* buffer) {
+    if (nullptr == view) {
+        return host + start;
+    }
+    auto& sizes   = view->size;
+    auto& strides = view->src.stride;
+    int i2        = start % sizes[2];
+    int i1        = (start / sizes[2]) % sizes[1];
+    int i0        = start / sizes[2] / sizes[1];
+    if (1 == strides[2] && i2 + size <= sizes[2]) {
+        return host + i0 * strides[0] + i1 * strides[1] + i2;
+    }
+    for (int i = 0; i < size;) {
+        auto src  = host + i0 * strides[0] + i1 * strides[1];
+        int count = std::min(size - i, sizes[2] - i2);
+        if (1 == strides[2]) {
+            ::memcpy(buffer + i, src + i2, count * sizeof(float));
+        } else {
+            for (int k = 0; k < count; ++k) {
+                buffer[i + k] = src[(i2 + k) * strides[2]];
+            }
+        }
+        i += count;
+        i2 = 0;
+        i1++;
+        if (i1 == sizes[1]) {
+            i1 = 0;
+            i0++;
+        }
+    }
+    return buffer;
+}
+
 static void callEleFunc(void(*proc)(float* C, const float* A, const float* B, size_t width, size_t cStride, size_t aStride, size_t bStride, size_t height),
                         float* C, const float* A, const float* B, size_t size, bool swap) {
     if (swap) {
@@ -359,7 +398,28 @@ ErrorCode CPUBinaryFloat::onExecute(const std::vector<Tensor*>& inputs, const st
         int sizeDivide = schedule.first;
         int scheduleNumber = schedule.second;
         if (nullptr != mElementProc) {
-            if (mOutside == 1) {
+            if (mHasView) {
+                // The inputs are of the same size, read by chunks from the origins of the views
+                const Tensor::InsideDescribe::Region* views[2];
+                const float* hosts[2];
+                for (int i = 0; i < 2; ++i) {
+                    views[i] = OpCommonUtils::getStridedView(inputs[i]);
+                    hosts[i] = (const float*)OpCommonUtils::viewHost(inputs[i]);
+                }
+                auto outputPtr = output->host<float>();
+                int chunks     = UP_DIV(size, MNN_BINARY_VIEW_CHUNK);
+                MNN_CONCURRENCY_BEGIN(tId, numberThread) {
+                    float buffer[2][MNN_BINARY_VIEW_CHUNK];
+                    for (int c = (int)tId; c < chunks; c += numberThread) {
+                        int start = c * MNN_BINARY_VIEW_CHUNK;
+                        int count = std::min(MNN_BINARY_VIEW_CHUNK, size - start);
+                        auto a    = _readView(hosts[0], views[0], start, count, buffer[0]);
+                        auto b    = _readView(hosts[1], views[1], start, count, buffer[1]);
+                        mElementProc(outputPtr + start, a, b, count, 0, 0, 0, 1);
+                    }
+                }
+                MNN_CONCURRENCY_END();
+            } else if (mOutside == 1) {
                 MNN_CONCURRENCY_BEGIN(tId, scheduleNumber) {
                     int start = sizeDivide * (int)tId;
                     int realSize = sizeDivide;
@@ -372,12 +432,11 @@ ErrorCode CPUBinaryFloat::onExecute(const std::vector<Tensor*>& inputs, const st
                 }
                 MNN_CONCURRENCY_END();
             } else {
-                MNN_CONCURRENCY_BEGIN(tId, numberThread) {
-                    for (int y = tId; y < mOutside; y+=numberThread) {
-                        callEleFunc(mElementProc, output->host<float>() + y * mAxis, input->host<float>() + y * mAxis, input1->host<float>(), mAxis, swap);
-                    }
+                // Take at least about 1024 elements each time
+                MNN_CONCURRENCY_DYNAMIC_BEGIN(tId, y, mOutside, numberThread, UP_DIV(1024, std::max(mAxis, 1))) {
+                    callEleFunc(mElementProc, output->host<float>() + y * mAxis, input->host<float>() + y * mAxis, input1->host<float>(), mAxis, swap);
                 }
-                MNN_CONCURRENCY_END();
+                MNN_CONCURRENCY_DYNAMIC_END();
             }
         } else {
             if (mOutside == 1 && mAxis == 1) {
@@ -418,33 +477,31 @@ ErrorCode CPUBinaryFloat::onExecute(const std::vector<Tensor*>& inputs, const st
                 float* inputPtr = input->host<float>();
                 float* input1Ptr = input1->host<float>();
                 auto total = mOutside * mAxis;
-                MNN_CONCURRENCY_BEGIN(tId, numberThread) {
-                    for (int index = (int)tId; index < total; index += numberThread) {
-                        auto axis = index % mAxis;
-                        float scalar = input1Ptr[axis];
-                        float scale = scalar;
-                        float bias = 0.0f;
-                        switch (mType) {
-                            case BinaryOpOperation_ADD:
+                MNN_CONCURRENCY_DYNAMIC_BEGIN(tId, index, total, numberThread, UP_DIV(1024, std::max(mInside, 1))) {
+                    auto axis = index % mAxis;
+                    float scalar = input1Ptr[axis];
+                    float scale = scalar;
+                    float bias = 0.0f;
+                    switch (mType) {
+                        case BinaryOpOperation_ADD:
+                            scale = 1.0f;
+                            bias = scalar;
+                            break;
+                        case BinaryOpOperation_SUB:
+                            if (!swap) {
                                 scale = 1.0f;
+                                bias = -scalar;
+                            } else {
+                                scale = -1.0f;
                                 bias = scalar;
-                                break;
-                            case BinaryOpOperation_SUB:
-                                if (!swap) {
-                                    scale = 1.0f;
-                                    bias = -scalar;
-                                } else {
-                                    scale = -1.0f;
-                                    bias = scalar;
-                                }
-                                break;
-                            default:
-                                break;
-                        }
-                        MNNScaleAndAddBiasScalar(output->host<float>() + mInside * index, inputPtr +  mInside * index, bias, scale, mInside);
+                            }
+                            break;
+                        default:
+                            break;
                     }
+                    MNNScaleAndAddBiasScalar(output->host<float>() + mInside * index, inputPtr +  mInside * index, bias, scale, mInside);
                 }
-                MNN_CONCURRENCY_END();
+                MNN_CONCURRENCY_DYNAMIC_END();
             }
 
         }
@@ -597,6 +654,25 @@ public:
                   dataType.bits, dataType.code);
         return nullptr;
     }
+    virtual bool onSupportStridedInput(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
+                                       const MNN::Op* op, int index, const Tensor* view) const override {
+        // Only the element-wise functions of CPUBinaryFloat read the views
+        if (index >= 2 || inputs[0]->getType() != halide_type_of<float>() ||
+            outputs[0]->getType() != halide_type_of<float>()) {
+            return false;
+        }
+        switch (op->main_as_BinaryOp()->opType()) {
+            case BinaryOpOperation_MUL:
+            case BinaryOpOperation_ADD:
+            case BinaryOpOperation_MAXIMUM:
+            case BinaryOpOperation_SUB:
+                break;
+            default:
+                return false;
+        }
+        auto size = outputs[0]->elementSize();
+        return size >= 4 && inputs[0]->elementSize() == size && inputs[1]->elementSize() == size;
+    }
 };
 
 REGISTER_CPU_OP_CREATOR(CPUBinaryCreator, OpType_BinaryOp);
@@ -27,6 +27,8 @@ protected:
     int mOutside = 1;
     int mInside = 1;
     int mAxis = 1;
+    // Some input is a strided view, see CPUBackend::onElideRasters
+    bool mHasView = false;
 };
 class CPUBinaryInt : public Execution {
 public:
@@ -137,17 +137,10 @@ static void _im2colCommon(int8_t* colAddr, const int8_t* inputOrigin,
     }
 }
 CPUConvInt8::~CPUConvInt8() {
-    if(mWeightInt8 != nullptr){
-        backend()->onReleaseBuffer(mWeightInt8.get(), Backend::STATIC);
-    }
-    if(mBiasInt32 != nullptr){
-        backend()->onReleaseBuffer(mBiasInt32.get(), Backend::STATIC);
-    }
-    if(mScaleFloat != nullptr){
-        backend()->onReleaseBuffer(mScaleFloat.get(), Backend::STATIC);
-    }
+    // Do nothing
 }
-CPUConvInt8::CPUConvInt8(Backend* backend, const MNN::Convolution2D* convParam, const std::vector<Tensor*>& inputs)
+CPUConvInt8::CPUConvInt8(Backend* backend, const MNN::Convolution2D* convParam, const std::vector<Tensor*>& inputs,
+                         std::shared_ptr<CPUConvolution::Resource> resource)
     : CPUConvolution(convParam->common(), backend) {
     const auto convCommon             = convParam->common();
     const auto kx                     = convCommon->kernelX();
@@ -167,18 +160,36 @@ CPUConvInt8::CPUConvInt8(Backend* backend, const MNN::Convolution2D* convParam,
         mGemmKernel = MNNGemmInt8AddBiasScale_16x4_Unit_FAST;
     }
     mActBits = convParam->symmetricQuan()->nbits();
-    
-    mWeightInt8.reset(Tensor::createDevice<int8_t>({outputCountUnit, totalKernelCountD8Div2, GEMM_INT8_UNIT, GEMM_INT8_SRC_UNIT}));
-    auto allocRes = backend->onAcquireBuffer(mWeightInt8.get(), Backend::STATIC);
+
+    mIm2ColParamter.dilateX         = convCommon->dilateX();
+    mIm2ColParamter.dilateY         = convCommon->dilateY();
+    mIm2ColParamter.strideX         = convCommon->strideX();
+    mIm2ColParamter.strideY         = convCommon->strideY();
+    mIm2ColParamter.padX            = convCommon->padX();
+    mIm2ColParamter.padY            = convCommon->padY();
+    mIm2ColParamter.icDiv4          = srcCountUnit;
+    mIm2ColParamter.kernelX         = convCommon->kernelX();
+    mIm2ColParamter.kernelY         = convCommon->kernelY();
+    mIm2ColParamter.kernelCountUnit = totalKernelCountD8Div2;
+
+    mRelu = convCommon->relu() || convCommon->relu6();
+    if (nullptr != resource) {
+        mResource = resource;
+        return;
+    }
+    mResource.reset(new CPUConvolution::Resource);
+    mResource->backend = backend;
+    mResource->mWeight.reset(Tensor::createDevice<int8_t>({outputCountUnit, totalKernelCountD8Div2, GEMM_INT8_UNIT, GEMM_INT8_SRC_UNIT}));
+    auto allocRes = backend->onAcquireBuffer(mResource->mWeight.get(), Backend::STATIC);
     if (!allocRes) {
         mValid = false;
         return;
     }
-    const int oneTileLen         = mWeightInt8->stride(1);
-    const int outputChnnelStride = mWeightInt8->stride(0);
+    const int oneTileLen         = mResource->mWeight->stride(1);
+    const int outputChnnelStride = mResource->mWeight->stride(0);
     const auto weightSrc         = convParam->symmetricQuan()->weight()->data();
-    auto weightDst               = mWeightInt8->host<int8_t>();
-    memset(weightDst, 0, mWeightInt8->size());
+    auto weightDst               = mResource->mWeight->host<int8_t>();
+    memset(weightDst, 0, mResource->mWeight->size());
     // reorder weight
     for (int k = 0; k < kernelCount; ++k) {
         const auto srcK = weightSrc + k;
@@ -201,39 +212,38 @@ CPUConvInt8::CPUConvInt8(Backend* backend, const MNN::Convolution2D* convParam,
         }
     }
     const int outputChannleUp4 = ALIGN_UP4(outputCount);
-    mBiasInt32.reset(Tensor::createDevice<int32_t>({outputChannleUp4}));
-    allocRes = backend->onAcquireBuffer(mBiasInt32.get(), Backend::STATIC);
+    mResource->mBias.reset(Tensor::createDevice<int32_t>({outputChannleUp4}));
+    allocRes = backend->onAcquireBuffer(mResource->mBias.get(), Backend::STATIC);
     if (!allocRes) {
         mValid = false;
         return;
     }
-    auto biasPtr = mBiasInt32->host<int32_t>();
+    auto biasPtr = mResource->mBias->host<int32_t>();
     memset(biasPtr, 0, outputChannleUp4 * sizeof(int32_t));
     memcpy(biasPtr, convParam->symmetricQuan()->bias()->data(), outputCount * sizeof(int32_t));
+    // The gemm kernel computes (src + offset) * weight, see MNNGetInt8GemmSrcOffset
+    const int srcOffset = MNNGetInt8GemmSrcOffset();
+    if (0 != srcOffset) {
+        for (int x = 0; x < outputCount; ++x) {
+            const auto weightX = weightSrc + x * kernelCount * srcCount;
+            int32_t weightSum  = 0;
+            for (int i = 0; i < kernelCount * srcCount; ++i) {
+                weightSum += weightX[i];
+            }
+            biasPtr[x] -= srcOffset * weightSum;
+        }
+    }
 
-    mScaleFloat.reset(Tensor::createDevice<float>({outputChannleUp4}));
-    allocRes = backend->onAcquireBuffer(mScaleFloat.get(), Backend::STATIC);
+    mResource->mScale.reset(Tensor::createDevice<float>({outputChannleUp4}));
+    allocRes = backend->onAcquireBuffer(mResource->mScale.get(), Backend::STATIC);
     if (!allocRes) {
         mValid = false;
         return;
     }
 
-    auto scalePtr = mScaleFloat->host<float>();
+    auto scalePtr = mResource->mScale->host<float>();
     memset(scalePtr, 0, outputChannleUp4 * sizeof(float));
     memcpy(scalePtr, convParam->symmetricQuan()->scale()->data(), outputCount * sizeof(float));
-
-    mIm2ColParamter.dilateX         = convCommon->dilateX();
-    mIm2ColParamter.dilateY         = convCommon->dilateY();
-    mIm2ColParamter.strideX         = convCommon->strideX();
-    mIm2ColParamter.strideY         = convCommon->strideY();
-    mIm2ColParamter.padX            = convCommon->padX();
-    mIm2ColParamter.padY            = convCommon->padY();
-    mIm2ColParamter.icDiv4          = srcCountUnit;
-    mIm2ColParamter.kernelX         = convCommon->kernelX();
-    mIm2ColParamter.kernelY         = convCommon->kernelY();
-    mIm2ColParamter.kernelCountUnit = totalKernelCountD8Div2;
-
-    mRelu = convCommon->relu() || convCommon->relu6();
 }
 
 ErrorCode CPUConvInt8::onResize(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
@@ -258,7 +268,7 @@ ErrorCode CPUConvInt8::onResize(const std::vector<Tensor*>& inputs, const std::v
     mTempIm2ColBuffer.buffer().dimensions = 3;
     mTempIm2ColBuffer.setLength(0, mThreadNums);
     mTempIm2ColBuffer.setLength(1, GEMM_INT8_DST_XUNIT);
-    mTempIm2ColBuffer.setLength(2, mWeightInt8->length(1) * GEMM_INT8_SRC_UNIT);
+    mTempIm2ColBuffer.setLength(2, mResource->mWeight->length(1) * GEMM_INT8_SRC_UNIT);
     TensorUtils::setLinearLayout(&mTempIm2ColBuffer);
 
     // set reamin tensor info
@@ -304,9 +314,9 @@ ErrorCode CPUConvInt8::onExecute(const std::vector<Tensor*>& inputs, const std::
 
     const auto inputDataPtr = input->host<int8_t>();
 
-    const auto weightDataPtr = mWeightInt8->host<int8_t>();
-    const auto biasDataPtr   = mBiasInt32->host<int32_t>();
-    const auto scaleDataPtr  = mScaleFloat->host<float>();
+    const auto weightDataPtr = mResource->mWeight->host<int8_t>();
+    const auto biasDataPtr   = mResource->mBias->host<int32_t>();
+    const auto scaleDataPtr  = mResource->mScale->host<float>();
     auto im2colPtr           = mTempIm2ColBuffer.host<int8_t>();
     auto outputDataPtr       = output->host<int8_t>();
     auto tempRemainPtr       = mTempRemainBuffer.host<int8_t>();
@@ -699,7 +709,16 @@ public:
                 return new ConvInt8_1xN(backend, op->main_as_Convolution2D());
             }
         }
-        return new CPUConvInt8(backend, op->main_as_Convolution2D(), inputs);
+        auto key      = CPUConvolution::weightCacheKey(op, ("int8_" + std::to_string(inputs[0]->channel())).c_str());
+        auto resource = CPUConvolution::loadResource(backend, key);
+        if (nullptr != resource) {
+            return new CPUConvInt8(backend, op->main_as_Convolution2D(), inputs, resource);
+        }
+        auto execution = new CPUConvInt8(backend, op->main_as_Convolution2D(), inputs);
+        if (execution->valid()) {
+            CPUConvolution::saveResource(backend, key, execution->resource());
+        }
+        return execution;
     }
 };
 
@@ -16,19 +16,22 @@ namespace MNN {
 
 class CPUConvInt8 : public CPUConvolution {
 public:
-    CPUConvInt8(Backend *backend, const MNN::Convolution2D *convOp, const std::vector<Tensor *> &inputs);
+    /** if resource is not null, use its reordered weight, bias and scale */
+    CPUConvInt8(Backend *backend, const MNN::Convolution2D *convOp, const std::vector<Tensor *> &inputs,
+                std::shared_ptr<CPUConvolution::Resource> resource = nullptr);
     virtual ~CPUConvInt8();
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
+    std::shared_ptr<CPUConvolution::Resource> resource() const {
+        return mResource;
+    }
 
 private:
     // relu or relu6
     bool mRelu;
     int mActBits;
 
-    std::shared_ptr<Tensor> mWeightInt8;
-    std::shared_ptr<Tensor> mBiasInt32;
-    std::shared_ptr<Tensor> mScaleFloat;
+    std::shared_ptr<CPUConvolution::Resource> mResource;
 
     ConvolutionCommon::Im2ColParameter mIm2ColParamter;
     int mTileCount;
@@ -8,6 +8,9 @@
 
 #include "backend/cpu/CPUConvolution.hpp"
 #include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "backend/cpu/CPUWeightCache.hpp"
 #include "backend/cpu/compute/CommonOptFunction.h"
 #include "core/Macro.h"
 #include <limits>
@@ -18,6 +21,109 @@
 
 namespace MNN {
 
+CPUConvolution::Resource::~Resource() {
+    if (nullptr != mScale) {
+        backend->onReleaseBuffer(mScale.get(), Backend::STATIC);
+    }
+    if (nullptr != mBias) {
+        backend->onReleaseBuffer(mBias.get(), Backend::STATIC);
+    }
+    if (nullptr != mWeight) {
+        backend->onReleaseBuffer(mWeight.get(), Backend::STATIC);
+    }
+}
+
+// FNV-1a on 64 bits words, the weight may be large
+static void _hashBytes(uint64_t &hash, const void *data, size_t size) {
+    auto bytes = (const uint8_t *)data;
+    size_t i   = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        ::memcpy(&word, bytes + i, sizeof(uint64_t));
+        hash = (hash ^ word) * 1099511628211ULL;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+}
+
+template <typename T>
+static void _hashVector(uint64_t &hash, const flatbuffers::Vector<T> *vec) {
+    if (nullptr != vec) {
+        _hashBytes(hash, vec->data(), vec->size() * sizeof(T));
+    }
+}
+
+std::string CPUConvolution::weightCacheKey(const Op *op, const char *kind, int index) {
+    // Keyed by the weight and the shape instead of op's name, which may be duplicated or empty
+    auto conv2D = op->main_as_Convolution2D();
+    if (nullptr == conv2D || nullptr == conv2D->common() ||
+        (nullptr == conv2D->weight() && nullptr == conv2D->quanParameter() && nullptr == conv2D->symmetricQuan())) {
+        MNN_PRINT("Weight of %s isn't in the model, can't cache it\n",
+                  nullptr == op->name() ? EnumNameOpType(op->type()) : op->name()->c_str());
+        return "";
+    }
+    auto common   = conv2D->common();
+    uint64_t hash = 14695981039346656037ULL;
+    int32_t shape[] = {common->kernelX(), common->kernelY(), common->strideX(),    common->strideY(),
+                       common->dilateX(), common->dilateY(), common->inputCount(), common->outputCount(),
+                       common->group()};
+    _hashBytes(hash, shape, sizeof(shape));
+    _hashVector(hash, conv2D->weight());
+    _hashVector(hash, conv2D->bias());
+    if (nullptr != conv2D->quanParameter()) {
+        auto quan = conv2D->quanParameter();
+        _hashVector(hash, quan->buffer());
+        _hashVector(hash, quan->alpha());
+        int32_t type = quan->type();
+        _hashBytes(hash, &type, sizeof(type));
+    }
+    if (nullptr != conv2D->symmetricQuan()) {
+        auto quan = conv2D->symmetricQuan();
+        _hashVector(hash, quan->weight());
+        _hashVector(hash, quan->bias());
+        _hashVector(hash, quan->scale());
+    }
+    char hashString[32];
+    snprintf(hashString, sizeof(hashString), "%016llx", (unsigned long long)hash);
+    return std::string(EnumNameOpType(op->type())) + "/" + kind + "/" + std::to_string(index) + "/" + hashString;
+}
+
+std::shared_ptr<CPUConvolution::Resource> CPUConvolution::loadResource(Backend *b, const std::string &key) {
+    std::vector<std::shared_ptr<Tensor>> tensors;
+    if (key.empty() || !static_cast<CPUBackend *>(b)->getWeightCache()->get(key, b, tensors)) {
+        return nullptr;
+    }
+    std::shared_ptr<Resource> resource(new Resource);
+    resource->backend = b;
+    if (tensors.size() > 3) {
+        for (auto &t : tensors) {
+            b->onReleaseBuffer(t.get(), Backend::STATIC);
+        }
+        return nullptr;
+    }
+    std::shared_ptr<Tensor> *dst[] = {&resource->mWeight, &resource->mBias, &resource->mScale};
+    for (int i = 0; i < tensors.size(); ++i) {
+        *dst[i] = tensors[i];
+    }
+    return resource;
+}
+
+void CPUConvolution::saveResource(Backend *b, const std::string &key, std::shared_ptr<Resource> resource) {
+    if (key.empty() || nullptr == resource || nullptr == resource->mWeight) {
+        return;
+    }
+    std::vector<Tensor *> tensors = {resource->mWeight.get()};
+    if (nullptr != resource->mBias) {
+        tensors.emplace_back(resource->mBias.get());
+        if (nullptr != resource->mScale) {
+            tensors.emplace_back(resource->mScale.get());
+        }
+    }
+    static_cast<CPUBackend *>(b)->getWeightCache()->put(key, resource, tensors);
+}
+
 CPUConvolution::CPUConvolution(const Convolution2DCommon *convOp, Backend *b) : MNN::Execution(b), mCommon(convOp) {
     mPostFunction = getPostFunction();
 }
@@ -14,6 +14,21 @@
 namespace MNN {
 class CPUConvolution : public Execution {
 public:
+    /** packed weight and bias in STATIC memory, shared by the executions cloned from the same one */
+    struct Resource {
+        std::shared_ptr<Tensor> mWeight;
+        std::shared_ptr<Tensor> mBias;
+        // Only used by int8 convolution
+        std::shared_ptr<Tensor> mScale;
+        Backend* backend;
+        ~Resource();
+    };
+    /** key of op's packed weight in CPUWeightCache by the hash of the weight, empty if the op can't be cached */
+    static std::string weightCacheKey(const Op* op, const char* kind, int index = 0);
+    /** load resource of key from the weight cache of backend, nullptr if not cached */
+    static std::shared_ptr<Resource> loadResource(Backend* b, const std::string& key);
+    /** record resource so that the weight cache of backend can save it */
+    static void saveResource(Backend* b, const std::string& key, std::shared_ptr<Resource> resource);
     CPUConvolution(const Convolution2DCommon *convOp, Backend *b);
     virtual ~CPUConvolution() = default;
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
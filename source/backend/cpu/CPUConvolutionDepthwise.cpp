@@ -86,6 +86,21 @@ ErrorCode CPUConvolutionDepthwise::onExecute(const std::vector<Tensor*>& inputs,
     return mSubExecution->onExecute(inputs, outputs);
 }
 
+bool CPUConvolutionDepthwise::onClone(Backend* bn, const Op* op, Execution** dst) {
+    if (!mSubExecution->onClone(bn, op, nullptr)) {
+        return false;
+    }
+    if (nullptr == dst) {
+        return true;
+    }
+    Execution* sub = nullptr;
+    mSubExecution->onClone(bn, op, &sub);
+    auto exe = new CPUConvolutionDepthwise(bn);
+    exe->mSubExecution.reset(sub);
+    *dst = exe;
+    return true;
+}
+
 CPUConvolutionDepthwise::FloatExecution::FloatExecution(const Convolution2DCommon* common, Backend* b,
                                                         const float* originWeight, size_t originWeightSize,
                                                         const float* bias, size_t biasSize)
@@ -96,29 +111,46 @@ CPUConvolutionDepthwise::FloatExecution::FloatExecution(const Convolution2DCommo
     int kw          = layer->kernelX();
     int kh          = layer->kernelY();
     int outputCount = (int)biasSize;
-    mBias.reset(Tensor::createDevice<float>(std::vector<int>{ALIGN_UP4(outputCount)}));
+    mResource.reset(new Resource);
+    mResource->backend = b;
+    mResource->mBias.reset(Tensor::createDevice<float>(std::vector<int>{ALIGN_UP4(outputCount)}));
     int depthQuad   = UP_DIV(outputCount, 4);
     int kernelSize  = depthQuad * 4 * kw * kh;
-    mWeight.reset(Tensor::createDevice<float>(std::vector<int>{kernelSize}));
+    mResource->mWeight.reset(Tensor::createDevice<float>(std::vector<int>{kernelSize}));
     bool success =
-        b->onAcquireBuffer(mBias.get(), Backend::STATIC) && b->onAcquireBuffer(mWeight.get(), Backend::STATIC);
+        b->onAcquireBuffer(mResource->mBias.get(), Backend::STATIC) && b->onAcquireBuffer(mResource->mWeight.get(), Backend::STATIC);
     if (!success) {
         MNN_ERROR("Error for alloc memory for CPUConvolutionDepthwise\n");
         mValid = false;
         return;
     }
-    ::memset(mBias->host<float>(), 0, mBias->size());
-    ::memcpy(mBias->host<float>(), bias, biasSize * sizeof(float));
+    ::memset(mResource->mBias->host<float>(), 0, mResource->mBias->size());
+    ::memcpy(mResource->mBias->host<float>(), bias, biasSize * sizeof(float));
 
     const float* tempWeight = originWeight;
     // Reorder weight from whc -> pwhc4
-    ::memset(mWeight->host<float>(), 0, kernelSize * sizeof(float));
-    auto weight = mWeight->host<float>();
+    ::memset(mResource->mWeight->host<float>(), 0, kernelSize * sizeof(float));
+    auto weight = mResource->mWeight->host<float>();
     MNNPackC4(weight, tempWeight, kh * kw, outputCount);
 }
+CPUConvolutionDepthwise::FloatExecution::FloatExecution(std::shared_ptr<Resource> resource,
+                                                        const Convolution2DCommon* common, Backend* b)
+    : MNN::CPUConvolution(common, b) {
+    mResource = resource;
+    mOrigin.reset(new BasicFloatExecution(common, b));
+}
 CPUConvolutionDepthwise::FloatExecution::~FloatExecution() {
-    backend()->onReleaseBuffer(mWeight.get(), Backend::STATIC);
-    backend()->onReleaseBuffer(mBias.get(), Backend::STATIC);
+    // Do nothing
+}
+bool CPUConvolutionDepthwise::FloatExecution::onClone(Backend* bn, const Op* op, Execution** dst) {
+    if (!mValid) {
+        return false;
+    }
+    if (nullptr == dst) {
+        return true;
+    }
+    *dst = new FloatExecution(mResource, op->main_as_Convolution2D()->common(), bn);
+    return true;
 }
 ErrorCode CPUConvolutionDepthwise::MultiInputFloatExecution::onResize(const std::vector<Tensor*>& inputs,
                                                                       const std::vector<Tensor*>& outputs) {
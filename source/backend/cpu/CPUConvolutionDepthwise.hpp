@@ -45,19 +45,20 @@ public:
     public:
         FloatExecution(const Convolution2DCommon *common, Backend *b, const float *originWeight,
                        size_t originWeightSize, const float *bias, size_t biasSize);
+        FloatExecution(std::shared_ptr<Resource> resource, const Convolution2DCommon *common, Backend *b);
         virtual ~FloatExecution();
         virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs,
                                     const std::vector<Tensor *> &outputs) override {
             return mOrigin->onExecute(mTempInputs, outputs);
         }
         virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override {
-            mTempInputs = {inputs[0], mWeight.get(), mBias.get()};
+            mTempInputs = {inputs[0], mResource->mWeight.get(), mResource->mBias.get()};
             return mOrigin->onResize(mTempInputs, outputs);
         }
+        virtual bool onClone(Backend *bn, const Op *op, Execution **dst) override;
 
     private:
-        std::unique_ptr<Tensor> mWeight;
-        std::unique_ptr<Tensor> mBias;
+        std::shared_ptr<Resource> mResource;
         std::vector<Tensor *> mTempInputs;
         std::unique_ptr<BasicFloatExecution> mOrigin;
     };
@@ -85,8 +86,11 @@ public:
     virtual ~CPUConvolutionDepthwise() = default;
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
+    virtual bool onClone(Backend *bn, const Op *op, Execution **dst) override;
 
 private:
+    CPUConvolutionDepthwise(Backend *b) : Execution(b) {
+    }
     std::unique_ptr<Execution> mSubExecution;
 };
 } // namespace MNN
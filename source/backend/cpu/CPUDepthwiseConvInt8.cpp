@@ -51,6 +51,8 @@ static void MNNDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src, con
     }
 }
 
+// The x86 line kernel is dispatched by FunctionDispatcher
+#ifndef MNN_USE_SSE
 static void MNNLineDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src, const int8_t* weight,
                                                  const int32_t* bias_z, size_t width, size_t src_w_step, size_t fw,
                                                  size_t fh, size_t dilateX_step, size_t dilateY_step,
@@ -78,6 +80,7 @@ static void MNNLineDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src,
         }
     }
 }
+#endif
 
 #endif
 
@@ -18,6 +18,8 @@
 #include <MNN/AutoTime.hpp>
 #include "backend/cpu/CPUBackend.hpp"
 #include "backend/cpu/compute/CommonOptFunction.h"
+#include "backend/cpu/compute/NonMaxSuppression.hpp"
+#include "core/Concurrency.h"
 #include "core/TensorUtils.hpp"
 
 namespace MNN {
@@ -46,54 +48,6 @@ using score_box_t = std::tuple<float, float, float, float, int, float>;
 #define box_label(rect) (std::get<4>(rect))
 #define box_score(rect) (std::get<5>(rect))
 
-static inline float intersectionArea(const score_box_t& a, const score_box_t& b) {
-    float axmin = box_rect_xmin(a), bxmin = box_rect_xmin(b);
-    float axmax = box_rect_xmax(a), bxmax = box_rect_xmax(b);
-    float aymin = box_rect_ymin(a), bymin = box_rect_ymin(b);
-    float aymax = box_rect_ymax(a), bymax = box_rect_ymax(b);
-    if (axmin > bxmax || axmax < bxmin || aymin > bymax || aymax < bymin)
-        return 0.f;
-
-    float interWidth  = fmin(axmax, bxmax) - fmax(axmin, bxmin);
-    float interHeight = fmin(aymax, bymax) - fmax(aymin, bymin);
-    return interWidth * interHeight;
-}
-
-static void pickBoxes(const std::vector<score_box_t> &boxes, std::vector<int> &picked, float nmsThreshold, int topK) {
-    long n = boxes.size();
-    std::vector<float> areas;
-    areas.resize(n);
-    for (int i = 0; i < n; i++) {
-        auto& box     = boxes[i];
-        float width  = box_rect_xmax(box) - box_rect_xmin(box);
-        float height = box_rect_ymax(box) - box_rect_ymin(box);
-        areas[i]     = width * height;
-    }
-
-    for (int i = 0; i < n; i++) {
-        auto& a = boxes[i];
-
-        bool keep = true;
-        for (auto pick : picked) {
-            auto& b = boxes[pick];
-
-            // intersection over union
-            float interArea = intersectionArea(a, b);
-            float unionArea = areas[i] + areas[pick] - interArea;
-            if (interArea / unionArea > nmsThreshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            picked.push_back(i);
-            if (picked.size() >= topK) {
-                break;
-            }
-        }
-    }
-}
-
 ErrorCode CPUDetectionOutput::onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
     auto &location = inputs[0];
     auto &priorbox = inputs[2];
@@ -199,31 +153,30 @@ ErrorCode CPUDetectionOutput::onExecute(const std::vector<Tensor *> &inputs, con
     auto compareFunction = [](const score_box_t &a, const score_box_t &b) { return box_score(a) > box_score(b); };
     {
         AUTOTIME;
-        for (int i = 1; i < mClassCount; i++) { // start from 1 to ignore background class
-            std::vector<score_box_t> classBoxes;
-            classBoxes.reserve(priorCount);
-            // filter by confidenceThreshold
+        // start from 1 to ignore background class, the classes take different time so take them dynamically
+        std::vector<std::vector<float>> classScores(mClassCount);
+        std::vector<std::vector<int>> picked(mClassCount);
+        int threadNumber = static_cast<CPUBackend *>(backend())->threadNumber();
+        MNN_CONCURRENCY_DYNAMIC_BEGIN(tId, i, mClassCount - 1, threadNumber, 1) {
+            auto& scores = classScores[i + 1];
+            scores.resize(priorCount);
             for (int j = 0; j < priorCount; j++) {
-                float score = confidencePtr[j * mClassCount + i];
+                scores[j] = confidencePtr[j * mClassCount + i + 1];
                 if (refineDet && (armconfidencePtr[j * 2 + 1] < mObjectnessScoreThreshold)) {
-                    score = 0.0;
-                }
-                if (score > mConfidenceThreshold) {
-                    const float *box = boxes.get() + 4 * j;
-                    classBoxes.push_back(box_rect(box[0], box[1], box[2], box[3], i, score));
+                    scores[j] = 0.0;
                 }
             }
+            // filter by confidenceThreshold, sort and apply nms
+            NonMaxSuppression(boxes.get(), scores.data(), priorCount, mKeepTopK, mNMSThreshold,
+                              mConfidenceThreshold, picked[i + 1]);
+        }
+        MNN_CONCURRENCY_DYNAMIC_END();
 
-            // sort inplace
-            std::sort(classBoxes.begin(), classBoxes.end(), compareFunction);
-
-            // apply nms
-            std::vector<int> picked;
-            pickBoxes(classBoxes, picked, mNMSThreshold, mKeepTopK);
-
-            // select
-            for (auto index : picked) {
-                allClassBoxes.push_back(classBoxes[index]);
+        // select
+        for (int i = 1; i < mClassCount; i++) {
+            for (auto index : picked[i]) {
+                const float *box = boxes.get() + 4 * index;
+                allClassBoxes.push_back(box_rect(box[0], box[1], box[2], box[3], i, classScores[i][index]));
             }
         }
     }
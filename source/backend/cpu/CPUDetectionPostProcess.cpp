@@ -6,11 +6,14 @@
 //  Copyright © 2018, Alibaba Group Holding Limited
 
 #include <math.h>
+#include <algorithm>
 #include <numeric>
+#include <tuple>
 
 #include "backend/cpu/CPUBackend.hpp"
 #include "backend/cpu/CPUDetectionPostProcess.hpp"
-#include "backend/cpu/CPUNonMaxSuppressionV2.hpp"
+#include "backend/cpu/compute/NonMaxSuppression.hpp"
+#include "core/Concurrency.h"
 
 namespace MNN {
 
@@ -76,8 +79,8 @@ static void _NonMaxSuppressionMultiClassFastImpl(const DetectionPostProcessParam
     }
 
     std::vector<int> seleted;
-    NonMaxSuppressionSingleClasssImpl(decodedBoxes, maxScores.data(), postProcessParam.maxDetections,
-                                      postProcessParam.iouThreshold, postProcessParam.nmsScoreThreshold, &seleted);
+    NonMaxSuppression(decodedBoxes->host<float>(), maxScores.data(), numBoxes, postProcessParam.maxDetections,
+                      postProcessParam.iouThreshold, postProcessParam.nmsScoreThreshold, seleted);
 
     const auto decodedBoxesPtr = reinterpret_cast<const BoxCornerEncoding*>(decodedBoxes->host<float>());
     auto detectionBoxesPtr     = reinterpret_cast<BoxCornerEncoding*>(detectionBoxes->host<float>());
@@ -100,13 +103,61 @@ static void _NonMaxSuppressionMultiClassFastImpl(const DetectionPostProcessParam
     *numDetectionsPtr = outputBoxIndex;
 }
 
+// NMS of each class, then keep the top maxDetections of all classes
+static void _NonMaxSuppressionMultiClassRegularImpl(const DetectionPostProcessParamT& postProcessParam,
+                                                    const Tensor* decodedBoxes, const Tensor* classPredictions,
+                                                    Tensor* detectionBoxes, Tensor* detectionClass,
+                                                    Tensor* detectionScores, Tensor* numDetections, Backend* bn) {
+    const int numBoxes               = decodedBoxes->length(0);
+    const int numClasses             = postProcessParam.numClasses;
+    const int numClassWithBackground = classPredictions->length(2);
+    const int labelOffset            = numClassWithBackground - numClasses;
+    const auto scoresStartPtr        = classPredictions->host<float>();
+    const auto decodedBoxesPtr       = decodedBoxes->host<float>();
+
+    // The classes take different time, so take them dynamically
+    std::vector<std::vector<float>> classScores(numClasses);
+    std::vector<std::vector<int>> selected(numClasses);
+    auto backend     = [bn]() { return bn; };
+    int threadNumber = static_cast<CPUBackend*>(bn)->threadNumber();
+    MNN_CONCURRENCY_DYNAMIC_BEGIN(tId, c, numClasses, threadNumber, 1) {
+        auto& scores = classScores[c];
+        scores.resize(numBoxes);
+        for (int idx = 0; idx < numBoxes; ++idx) {
+            scores[idx] = scoresStartPtr[idx * numClassWithBackground + labelOffset + c];
+        }
+        NonMaxSuppression(decodedBoxesPtr, scores.data(), numBoxes, postProcessParam.detectionsPerClass,
+                          postProcessParam.iouThreshold, postProcessParam.nmsScoreThreshold, selected[c]);
+    }
+    MNN_CONCURRENCY_DYNAMIC_END();
+
+    // (score, class, box), the same scores keep the order of classes
+    std::vector<std::tuple<float, int, int>> detections;
+    for (int c = 0; c < numClasses; ++c) {
+        for (auto idx : selected[c]) {
+            detections.emplace_back(classScores[c][idx], c, idx);
+        }
+    }
+    std::stable_sort(detections.begin(), detections.end(),
+                     [](const std::tuple<float, int, int>& a, const std::tuple<float, int, int>& b) {
+                         return std::get<0>(a) > std::get<0>(b);
+                     });
+    const int numDetected    = std::min((int)detections.size(), postProcessParam.maxDetections);
+    const auto boxesPtr      = reinterpret_cast<const BoxCornerEncoding*>(decodedBoxesPtr);
+    auto detectionBoxesPtr   = reinterpret_cast<BoxCornerEncoding*>(detectionBoxes->host<float>());
+    auto detectionClassesPtr = detectionClass->host<float>();
+    auto detectionScoresPtr  = detectionScores->host<float>();
+    for (int i = 0; i < numDetected; ++i) {
+        detectionBoxesPtr[i]   = boxesPtr[std::get<2>(detections[i])];
+        detectionClassesPtr[i] = std::get<1>(detections[i]);
+        detectionScoresPtr[i]  = std::get<0>(detections[i]);
+    }
+    *numDetections->host<float>() = numDetected;
+}
+
 CPUDetectionPostProcess::CPUDetectionPostProcess(Backend* bn, const MNN::Op* op) : Execution(bn) {
     auto param = op->main_as_DetectionPostProcessParam();
     param->UnPackTo(&mParam);
-    if (mParam.useRegularNMS) {
-        MNN_ERROR("TODO, use regular NMS to process decoded boxes!");
-        return;
-    }
 }
 
 ErrorCode CPUDetectionPostProcess::onResize(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
@@ -132,7 +183,8 @@ ErrorCode CPUDetectionPostProcess::onExecute(const std::vector<Tensor*>& inputs,
     _decodeBoxes(inputs[0], inputs[2], scaleValues, mDecodedBoxes.get());
 
     if (mParam.useRegularNMS) {
-        return NOT_SUPPORT;
+        _NonMaxSuppressionMultiClassRegularImpl(mParam, mDecodedBoxes.get(), inputs[1], outputs[0], outputs[1],
+                                                outputs[2], outputs[3], backend());
     } else {
         // perform NMS on max scores
         _NonMaxSuppressionMultiClassFastImpl(mParam, mDecodedBoxes.get(), inputs[1], outputs[0], outputs[1], outputs[2],
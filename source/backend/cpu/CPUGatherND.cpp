@@ -14,8 +14,16 @@
 #include <string.h>
 #include "backend/cpu/CPUGatherND.hpp"
 #include "core/Concurrency.h"
+#include "core/Macro.h"
+#include "math/Vec.hpp"
+
+// Each thread copies at least so many bytes
+#define MNN_GATHERND_THREAD_BYTES (16 * 1024)
+#define MNN_GATHERND_VEC_BYTES 256
 
 namespace MNN {
+using Vec4 = MNN::Math::Vec<float, 4>;
+
 ErrorCode CPUGatherND::onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
     auto params = inputs[0];
     auto indice = inputs[1];
@@ -45,12 +53,39 @@ ErrorCode CPUGatherND::onExecute(const std::vector<Tensor *> &inputs, const std:
     auto indiceData = indice->host<int32_t>();
     auto output = outputs[0];
     auto bytes = output->getType().bytes();
-    MNN_CONCURRENCY_BEGIN(i, mSliceN) {
-        int fromPos = 0;
-        for (int j=0; j<indiceNd; ++j) {
-            fromPos += mDimsToCount[j] * indiceData[i*indiceNd + j];
+    for (int i=0; i<mSliceN * indiceNd; ++i) {
+        auto index = indiceData[i];
+        if (index < 0 || index >= params->length(i % indiceNd)) {
+            return INPUT_DATA_ERROR;
+        }
+    }
+    const int sliceBytes = bytes * mSliceSize;
+    const auto srcPtr = params->host<uint8_t>();
+    auto dstPtr = output->host<uint8_t>();
+    // Contiguous parts of slices for each thread, at least MNN_GATHERND_THREAD_BYTES
+    int threadNumber = static_cast<CPUBackend*>(backend())->threadNumber();
+    threadNumber = (int)ALIMIN((int64_t)threadNumber, UP_DIV((int64_t)mSliceN * sliceBytes, MNN_GATHERND_THREAD_BYTES));
+    threadNumber = ALIMAX(threadNumber, 1);
+    // Short slices are copied by Vec4, calling memcpy costs more than the copy
+    const bool vecCopy = sliceBytes <= MNN_GATHERND_VEC_BYTES && 0 == sliceBytes % (4 * sizeof(float));
+    MNN_CONCURRENCY_BEGIN(tId, threadNumber) {
+        int begin = (int)((int64_t)mSliceN * tId / threadNumber);
+        int end = (int)((int64_t)mSliceN * (tId + 1) / threadNumber);
+        for (int i = begin; i < end; ++i) {
+            int fromPos = 0;
+            for (int j=0; j<indiceNd; ++j) {
+                fromPos += mDimsToCount[j] * indiceData[i*indiceNd + j];
+            }
+            auto dst = dstPtr + (size_t)sliceBytes * i;
+            auto src = srcPtr + (size_t)bytes * fromPos;
+            if (vecCopy) {
+                for (int k = 0; k < sliceBytes; k += 4 * sizeof(float)) {
+                    Vec4::save((float*)(dst + k), Vec4::load((const float*)(src + k)));
+                }
+            } else {
+                ::memcpy(dst, src, sliceBytes);
+            }
         }
-        ::memcpy(output->host<uint8_t>() + bytes * i * mSliceSize, params->host<uint8_t>() + bytes * fromPos, bytes * mSliceSize);
     }
     MNN_CONCURRENCY_END();
     return NO_ERROR;
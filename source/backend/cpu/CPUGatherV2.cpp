@@ -9,9 +9,53 @@
 #include "backend/cpu/CPUGatherV2.hpp"
 #include "backend/cpu/CPUBackend.hpp"
 #include "backend/cpu/compute/CommonOptFunction.h"
+#include "core/Concurrency.h"
 #include "core/Macro.h"
+#include "math/Vec.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MNN_GATHER_PREFETCH(ptr) __builtin_prefetch(ptr)
+#else
+#define MNN_GATHER_PREFETCH(ptr)
+#endif
+// Rows are prefetched so many rows ahead, only the first cache lines since the rest are streamed by hardware
+#define MNN_GATHER_PREFETCH_DISTANCE 8
+#define MNN_GATHER_PREFETCH_BYTES 256
+// Each thread copies at least so many bytes
+#define MNN_GATHER_THREAD_BYTES (16 * 1024)
+// Columns of the embedding rows pooled at once, so the pooled row stays in L1
+#define MNN_EMBEDDING_BLOCK 1024
 
 namespace MNN {
+using Vec4 = MNN::Math::Vec<float, 4>;
+
+static inline void _prefetchRow(const uint8_t* row, int bytes) {
+    auto size = ALIMIN(bytes, MNN_GATHER_PREFETCH_BYTES);
+    for (int i = 0; i < size; i += 64) {
+        MNN_GATHER_PREFETCH(row + i);
+    }
+}
+
+static inline void _copyRow(uint8_t* dst, const uint8_t* src, int bytes) {
+    // Calling memcpy costs more than the copy for short rows, which are the common embeddings
+    if (bytes <= MNN_GATHER_PREFETCH_BYTES && 0 == bytes % (4 * sizeof(float))) {
+        for (int i = 0; i < bytes; i += 4 * sizeof(float)) {
+            Vec4::save((float*)(dst + i), Vec4::load((const float*)(src + i)));
+        }
+        return;
+    }
+    ::memcpy(dst, src, bytes);
+}
+
+static inline void _addRow(float* dst, const float* src, int size) {
+    int sizeC4 = size / 4 * 4;
+    for (int i = 0; i < sizeC4; i += 4) {
+        Vec4::save(dst + i, Vec4::load(dst + i) + Vec4::load(src + i));
+    }
+    for (int i = sizeC4; i < size; ++i) {
+        dst[i] += src[i];
+    }
+}
 
 CPUGatherV2::CPUGatherV2(Backend *b, const Op* op) : MNN::Execution(b), mOp(op) {
     // nothing to do
@@ -57,16 +101,94 @@ ErrorCode CPUGatherV2::onExecute(const std::vector<Tensor *> &inputs, const std:
     const int *indicesPtr    = indices->host<int32_t>();
     const auto inputPtr      = params->host<uint8_t>();
     auto outputPtr           = output->host<uint8_t>();
-    for (int o=0; o<outside; ++o) {
-        auto outputO = outputPtr + outputOutsideStride * o;
-        auto inputO = inputPtr + inputOutsideStride * o;
-        for (int i = 0; i < N; i++) {
-            if (indicesPtr[i] < 0 || indicesPtr[i] > limit) {
+    for (int i = 0; i < N; i++) {
+        if (indicesPtr[i] < 0 || indicesPtr[i] >= limit) {
+            return INPUT_DATA_ERROR;
+        }
+    }
+    // Split the outside * N rows into contiguous parts of threads
+    const int total  = outside * N;
+    if (0 == total) {
+        return NO_ERROR;
+    }
+    int threadNumber = static_cast<CPUBackend*>(backend())->threadNumber();
+    threadNumber     = (int)ALIMIN((int64_t)threadNumber, UP_DIV((int64_t)total * insideStride, MNN_GATHER_THREAD_BYTES));
+    threadNumber     = ALIMAX(threadNumber, 1);
+    MNN_CONCURRENCY_BEGIN(tId, threadNumber) {
+        int begin = (int)((int64_t)total * tId / threadNumber);
+        int end   = (int)((int64_t)total * (tId + 1) / threadNumber);
+        int o     = begin / N;
+        int i     = begin % N;
+        for (int r = begin; r < end; ++r) {
+            auto inputO = inputPtr + inputOutsideStride * o;
+            // The prefetched row may belong to the next outside, skip it at the boundary
+            if (i + MNN_GATHER_PREFETCH_DISTANCE < N) {
+                _prefetchRow(inputO + insideStride * indicesPtr[i + MNN_GATHER_PREFETCH_DISTANCE], insideStride);
+            }
+            _copyRow(outputPtr + outputOutsideStride * o + i * insideStride, inputO + insideStride * indicesPtr[i],
+                     insideStride);
+            if (++i == N) {
+                i = 0;
+                o++;
+            }
+        }
+    }
+    MNN_CONCURRENCY_END();
+    return NO_ERROR;
+}
+
+CPUEmbeddingBag::CPUEmbeddingBag(Backend *b, bool mean) : MNN::Execution(b), mMean(mean) {
+    // nothing to do
+}
+
+ErrorCode CPUEmbeddingBag::onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
+    auto weight        = inputs[0];
+    auto indices       = inputs[1];
+    auto output        = outputs[0];
+    const int rows     = weight->length(0);
+    const int inside   = rows > 0 ? weight->elementSize() / rows : 0;
+    const int N        = indices->elementSize();
+    const int bags     = output->length(0);
+    auto indicesPtr    = indices->host<int32_t>();
+    const int* offsets = inputs.size() > 2 ? inputs[2]->host<int32_t>() : nullptr;
+    const int bagSize  = nullptr == offsets ? indices->length(1) : 0;
+    for (int i = 0; i < N; ++i) {
+        if (indicesPtr[i] < 0 || indicesPtr[i] >= rows) {
+            return INPUT_DATA_ERROR;
+        }
+    }
+    if (nullptr != offsets) {
+        for (int b = 0; b < bags; ++b) {
+            auto end = b + 1 < bags ? offsets[b + 1] : N;
+            if (offsets[b] < 0 || offsets[b] > end || end > N) {
                 return INPUT_DATA_ERROR;
             }
-            memcpy(outputO + i * insideStride, inputO + insideStride * indicesPtr[i], insideStride);
         }
     }
+    const auto weightPtr = weight->host<float>();
+    auto outputPtr       = output->host<float>();
+    int threadNumber     = static_cast<CPUBackend*>(backend())->threadNumber();
+    // The bags may have different sizes, so take them dynamically
+    MNN_CONCURRENCY_DYNAMIC_BEGIN(tId, b, bags, threadNumber, UP_DIV(1024, ALIMAX(inside, 1))) {
+        int begin = nullptr == offsets ? b * bagSize : offsets[b];
+        int end   = nullptr == offsets ? begin + bagSize : (b + 1 < bags ? offsets[b + 1] : N);
+        auto dst  = outputPtr + (size_t)b * inside;
+        for (int x = 0; x < inside; x += MNN_EMBEDDING_BLOCK) {
+            int width = ALIMIN(MNN_EMBEDDING_BLOCK, inside - x);
+            ::memset(dst + x, 0, width * sizeof(float));
+            for (int j = begin; j < end; ++j) {
+                if (j + MNN_GATHER_PREFETCH_DISTANCE < end) {
+                    auto next = weightPtr + (size_t)indicesPtr[j + MNN_GATHER_PREFETCH_DISTANCE] * inside + x;
+                    _prefetchRow((const uint8_t*)next, width * sizeof(float));
+                }
+                _addRow(dst + x, weightPtr + (size_t)indicesPtr[j] * inside + x, width);
+            }
+            if (mMean && end > begin) {
+                MNNScaleAndAddBiasScalar(dst + x, dst + x, 0.0f, 1.0f / (float)(end - begin), width);
+            }
+        }
+    }
+    MNN_CONCURRENCY_DYNAMIC_END();
     return NO_ERROR;
 }
 
@@ -81,4 +203,26 @@ public:
 REGISTER_CPU_OP_CREATOR(CPUGatherV2Creator, OpType_GatherV2);
 REGISTER_CPU_OP_CREATOR(CPUGatherV2Creator, OpType_Gather);
 
+class CPUEmbeddingBagCreator : public CPUBackend::Creator {
+public:
+    virtual Execution *onCreate(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs,
+                                const MNN::Op *op, Backend *backend) const override {
+        if (inputs[0]->getType() != halide_type_of<float>()) {
+            MNN_ERROR("EmbeddingBag only supports float weight\n");
+            return nullptr;
+        }
+        auto mode = ReductionType_SUM;
+        if (nullptr != op->main_as_EmbeddingBagParam()) {
+            mode = op->main_as_EmbeddingBagParam()->mode();
+        }
+        if (ReductionType_SUM != mode && ReductionType_MEAN != mode) {
+            MNN_ERROR("EmbeddingBag doesn't support pooling mode %d\n", mode);
+            return nullptr;
+        }
+        return new CPUEmbeddingBag(backend, ReductionType_MEAN == mode);
+    }
+};
+
+REGISTER_CPU_OP_CREATOR(CPUEmbeddingBagCreator, OpType_EmbeddingBag);
+
 } // namespace MNN
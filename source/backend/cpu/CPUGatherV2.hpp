@@ -22,5 +22,15 @@ private:
     int mAxis;
     const Op* mOp;
 };
+
+// Gather + sum / mean pooling, the gathered rows are not materialized
+class CPUEmbeddingBag : public Execution {
+public:
+    CPUEmbeddingBag(Backend *b, bool mean);
+    virtual ~CPUEmbeddingBag() = default;
+    virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
+private:
+    bool mMean;
+};
 } // namespace MNN
 #endif /* CPUGatherV2_hpp */
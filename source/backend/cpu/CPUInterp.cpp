@@ -34,7 +34,7 @@ CPUInterp::CPUInterp(Backend *backend, int resizeType,
 }
 
 CPUInterp::~CPUInterp() {
-    if (mInit && mResizeType == 2) {
+    if (mInit) {
         backend()->onReleaseBuffer(&mWidthPosition, Backend::STATIC);
         backend()->onReleaseBuffer(&mWidthFactor, Backend::STATIC);
         backend()->onReleaseBuffer(&mHeightPosition, Backend::STATIC);
@@ -43,47 +43,86 @@ CPUInterp::~CPUInterp() {
 }
 
 ErrorCode CPUInterp::onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
-    auto &input  = inputs[0]->buffer();
-    auto &output = outputs[0]->buffer();
+    auto &input      = inputs[0]->buffer();
+    auto &output     = outputs[0]->buffer();
+    int threadNumber = ((CPUBackend *)backend())->threadNumber();
 
-    if (mResizeType == 1) {
+    if (mResizeType == 1 || mResizeType == 4) {
         // Nearstneighbor
-        CPUResizeNearestneighborC4(input, output, mWidthScale, mHeightScale, mWidthOffset, mHeightOffset);
+        CPUResizeNearestneighborC4(input, output, mWidthPosition.host<int>(), mHeightPosition.host<int>(),
+                                   threadNumber);
     } else if (mResizeType == 2) {
         // bilinear
         CPUResizeBilinearC4(input, output, mWidthPosition.host<int>(), mWidthFactor.host<float>(),
                             mHeightPosition.host<int>(), mHeightFactor.host<float>(), mLineBuffer.host<float>(),
-                            ((CPUBackend *)backend())->threadNumber());
+                            threadNumber);
     } else if (mResizeType == 3) {
         // cubic
-        CPUResizeCubicC4(input, output, mWidthScale, mHeightScale, mWidthOffset, mHeightOffset);
-    } else if (mResizeType == 4) {
-        // Nearstneighbor
-        CPUResizeNearestneighborRoundC4(input, output, mWidthScale, mHeightScale, mWidthOffset, mHeightOffset);
+        CPUResizeCubicC4(input, output, mWidthPosition.host<int>(), mWidthFactor.host<float>(),
+                         mHeightPosition.host<int>(), mHeightFactor.host<float>(), mLineBuffer.host<float>(),
+                         threadNumber);
     } else {
         return NOT_SUPPORT;
     }
     return NO_ERROR;
 }
 
+// Source positions and fractions of an axis, 1 position for nearest, 2 for bilinear and 4 for cubic of each output
+static void _computeLinePosition(int resizeType, int inSize, int outSize, float scale, float offset,
+                                 int *positions, float *factors) {
+    for (int x = 0; x < outSize; ++x) {
+        float srcX = x * scale + offset;
+        switch (resizeType) {
+            case 1:
+                positions[x] = CLAMP(static_cast<int>(floor(srcX)), 0, inSize - 1);
+                break;
+            case 4:
+                positions[x] = CLAMP(static_cast<int>(roundf(srcX)), 0, inSize - 1);
+                break;
+            case 2: {
+                int x1               = floor(srcX);
+                factors[x]           = srcX - x1;
+                positions[2 * x + 0] = CLAMP(x1, 0, inSize - 1);
+                positions[2 * x + 1] = CLAMP(x1 + 1, 0, inSize - 1);
+                break;
+            }
+            case 3: {
+                int xInt   = (int)srcX;
+                factors[x] = (float)(srcX - floor(srcX));
+                for (int i = 0; i < 4; ++i) {
+                    positions[4 * x + i] = CLAMP(xInt - 1 + i, 0, inSize - 1);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
 ErrorCode CPUInterp::onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
-    if (mResizeType != 2) {
+    if (mResizeType < 1 || mResizeType > 4) {
         return NO_ERROR;
     }
     const int inW  = inputs[0]->buffer().dim[3].extent;
     const int inH  = inputs[0]->buffer().dim[2].extent;
     const int outW = outputs[0]->buffer().dim[3].extent;
     const int outH = outputs[0]->buffer().dim[2].extent;
-    if (mInit && mResizeType == 2) {
+    if (mInit) {
         backend()->onReleaseBuffer(&mWidthPosition, Backend::STATIC);
         backend()->onReleaseBuffer(&mWidthFactor, Backend::STATIC);
         backend()->onReleaseBuffer(&mHeightPosition, Backend::STATIC);
         backend()->onReleaseBuffer(&mHeightFactor, Backend::STATIC);
+        mInit = false;
+    }
+    int taps = 1;
+    if (mResizeType == 2) {
+        taps = 2;
+    } else if (mResizeType == 3) {
+        taps = 4;
     }
-    const float xScaling = mWidthScale;
-    const float yScaling = mHeightScale;
 
-    mWidthPosition.buffer().dim[0].extent = 2 * outW;
+    mWidthPosition.buffer().dim[0].extent = taps * outW;
     mWidthPosition.buffer().dimensions    = 1;
     mWidthPosition.setType(DataType_DT_INT32);
 
@@ -91,7 +130,7 @@ ErrorCode CPUInterp::onResize(const std::vector<Tensor *> &inputs, const std::ve
     mWidthFactor.buffer().dimensions    = 1;
     mWidthFactor.setType(DataType_DT_FLOAT);
 
-    mHeightPosition.buffer().dim[0].extent = 2 * outH;
+    mHeightPosition.buffer().dim[0].extent = taps * outH;
     mHeightPosition.buffer().dimensions    = 1;
     mHeightPosition.setType(DataType_DT_INT32);
 
@@ -107,36 +146,18 @@ ErrorCode CPUInterp::onResize(const std::vector<Tensor *> &inputs, const std::ve
     }
     mInit = true;
 
-    auto _wPosition = mWidthPosition.host<int>();
-    auto _wFactor   = mWidthFactor.host<float>();
-
-    // Compute Line Position
-    for (int x = 0; x < outW; ++x) {
-        float srcX = x * xScaling + mWidthOffset;
-        int x1         = floor(srcX);
-        float x2Factor = srcX - x1;
-
-        _wFactor[x]           = x2Factor;
-        _wPosition[2 * x + 0] = CLAMP(x1, 0, inW - 1);
-        _wPosition[2 * x + 1] = CLAMP(x1 + 1, 0, inW - 1);
-    }
-
-    auto _hPosition = mHeightPosition.host<int>();
-    auto _hFactor   = mHeightFactor.host<float>();
-
-    for (int y = 0; y < outH; ++y) {
-        float srcY = y * yScaling + mHeightOffset;
-        int y1         = floor(srcY);
-        float y2Factor = srcY - y1;
-
-        _hFactor[y]           = y2Factor;
-        _hPosition[2 * y + 0] = CLAMP(y1, 0, inH - 1);
-        _hPosition[2 * y + 1] = CLAMP(y1 + 1, 0, inH - 1);
+    _computeLinePosition(mResizeType, inW, outW, mWidthScale, mWidthOffset, mWidthPosition.host<int>(),
+                         mWidthFactor.host<float>());
+    _computeLinePosition(mResizeType, inH, outH, mHeightScale, mHeightOffset, mHeightPosition.host<int>(),
+                         mHeightFactor.host<float>());
+    if (taps == 1) {
+        return NO_ERROR;
     }
 
+    // Horizontally sampled input rows of each thread
     int threadNumber = ((CPUBackend *)backend())->threadNumber();
 
-    mLineBuffer.buffer().dim[0].extent = 2 * 4 * outW * threadNumber;
+    mLineBuffer.buffer().dim[0].extent = taps * 4 * outW * threadNumber;
     mLineBuffer.buffer().dimensions    = 1;
     mLineBuffer.setType(DataType_DT_FLOAT);
     res = backend()->onAcquireBuffer(&mLineBuffer, Backend::DYNAMIC);
@@ -0,0 +1,146 @@
+//
+//  CPULSTMRecurrence.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/CPULSTMRecurrence.hpp"
+#include <string.h>
+#include <algorithm>
+#include "backend/cpu/CPUBackend.hpp"
+#include "backend/cpu/compute/CommonOptFunction.h"
+#include "core/Concurrency.h"
+#include "core/Macro.h"
+#include "core/TensorUtils.hpp"
+#include "math/Vec.hpp"
+
+namespace MNN {
+using Vec4 = MNN::Math::Vec<float, 4>;
+
+CPULSTMRecurrence::CPULSTMRecurrence(Backend* backend) : Execution(backend) {
+    // Do nothing
+}
+
+ErrorCode CPULSTMRecurrence::onResize(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
+    auto R      = inputs[0];
+    auto Y      = outputs[0];
+    mDirections = R->length(0);
+    mHidden     = R->length(2);
+    mHiddenPad  = ROUND_UP(mHidden, 4);
+    mSequence   = Y->length(0);
+    mBatch      = Y->length(2);
+    MNN_ASSERT(inputs.size() == 1 + mDirections || inputs.size() == 3 + mDirections);
+    MNN_ASSERT(inputs[1]->length(0) == mSequence * mBatch && inputs[1]->length(1) == 4 * mHidden);
+    const bool constR =
+        TensorUtils::getDescribe(R)->usage == Tensor::InsideDescribe::CONSTANT && nullptr != R->host<float>();
+    if (constR && mRecurrent.empty()) {
+        for (int d = 0; d < mDirections; ++d) {
+            auto padded = RNNPadGates(R->host<float>() + d * 4 * mHidden * mHidden, 4, mHidden, mHidden, true);
+            mRecurrent.emplace_back(new RNNMatMul(padded.data(), nullptr, mHidden, 4 * mHiddenPad, true));
+        }
+    }
+
+    // hidden, cell, 4 gates and tanh(cell) of all batches in C4
+    mCacheSize = RNNMatMul::cacheSize(mHidden, 4 * mHiddenPad) + 7 * mHiddenPad * mBatch;
+    mCache.reset(Tensor::createDevice<float>({mDirections, mCacheSize}));
+    if (!backend()->onAcquireBuffer(mCache.get(), Backend::DYNAMIC)) {
+        return OUT_OF_MEMORY;
+    }
+    backend()->onReleaseBuffer(mCache.get(), Backend::DYNAMIC);
+    return NO_ERROR;
+}
+
+void CPULSTMRecurrence::_runDirection(int direction, const RNNMatMul& recurrent, const std::vector<Tensor*>& inputs,
+                                      const std::vector<Tensor*>& outputs, float* cache) const {
+    const int batch     = mBatch;
+    const int hidden    = mHidden;
+    const int planeSize = mHiddenPad * batch;
+    auto hiddenC4       = cache;
+    auto cell           = hiddenC4 + planeSize;
+    auto gates          = cell + planeSize;
+    auto cellTanh       = gates + 4 * planeSize;
+    auto matmulCache    = cellTanh + planeSize;
+    auto inputGates     = inputs[1 + direction]->host<float>();
+    auto output         = outputs[0]->host<float>();
+    if (inputs.size() > 1 + mDirections) {
+        MNNUnpackTranspose(hiddenC4, inputs[1 + mDirections]->host<float>() + direction * batch * hidden, batch,
+                           hidden);
+        MNNUnpackTranspose(cell, inputs[2 + mDirections]->host<float>() + direction * batch * hidden, batch, hidden);
+    } else {
+        ::memset(hiddenC4, 0, 2 * planeSize * sizeof(float));
+    }
+    const int hiddenC4Size = mHiddenPad / 4;
+    for (int step = 0; step < mSequence; ++step) {
+        const int t = direction > 0 ? mSequence - 1 - step : step;
+        // Gates in IOFC = Input gates + R * h, the padding of each gate is zero
+        recurrent.compute(gates, hiddenC4, 0, batch, batch, matmulCache);
+        for (int g = 0; g < 4; ++g) {
+            for (int b = 0; b < batch; ++b) {
+                auto src = inputGates + (t * batch + b) * 4 * hidden + g * hidden;
+                auto dst = gates + g * planeSize + b * 4;
+                int z    = 0;
+                for (; z < hidden / 4; ++z) {
+                    auto d = dst + z * batch * 4;
+                    Vec4::save(d, Vec4::load(d) + Vec4::load(src + 4 * z));
+                }
+                for (int i = 4 * z; i < hidden; ++i) {
+                    dst[z * batch * 4 + i - 4 * z] += src[i];
+                }
+            }
+        }
+        MNNSigmoid(gates, gates, 3 * planeSize);
+        MNNTanh(gates + 3 * planeSize, gates + 3 * planeSize, planeSize);
+        // Cell = I * C + F * Cell, h = O * tanh(Cell)
+        auto inputGate  = gates;
+        auto outputGate = gates + planeSize;
+        auto forgetGate = gates + 2 * planeSize;
+        auto cellGate   = gates + 3 * planeSize;
+        for (int i = 0; i < hiddenC4Size * batch; ++i) {
+            auto c = Vec4::load(inputGate + 4 * i) * Vec4::load(cellGate + 4 * i) +
+                     Vec4::load(forgetGate + 4 * i) * Vec4::load(cell + 4 * i);
+            Vec4::save(cell + 4 * i, c);
+        }
+        MNNTanh(cellTanh, cell, planeSize);
+        for (int i = 0; i < hiddenC4Size * batch; ++i) {
+            Vec4::save(hiddenC4 + 4 * i, Vec4::load(outputGate + 4 * i) * Vec4::load(cellTanh + 4 * i));
+        }
+        MNNPackTranspose(output + (t * mDirections + direction) * batch * hidden, hiddenC4, batch, hidden);
+    }
+    if (outputs.size() >= 2) {
+        MNNPackTranspose(outputs[1]->host<float>() + direction * batch * hidden, hiddenC4, batch, hidden);
+    }
+    if (outputs.size() >= 3) {
+        MNNPackTranspose(outputs[2]->host<float>() + direction * batch * hidden, cell, batch, hidden);
+    }
+}
+
+ErrorCode CPULSTMRecurrence::onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
+    auto R          = inputs[0]->host<float>();
+    const int units = mHidden;
+    MNN_CONCURRENCY_BEGIN(tId, mDirections) {
+        auto cache = mCache->host<float>() + tId * mCacheSize;
+        if (!mRecurrent.empty()) {
+            _runDirection((int)tId, *mRecurrent[tId], inputs, outputs, cache);
+        } else {
+            // R is packed once for all the steps
+            auto padded = RNNPadGates(R + tId * 4 * units * units, 4, units, units, true);
+            RNNMatMul recurrent(padded.data(), nullptr, units, 4 * mHiddenPad, true);
+            _runDirection((int)tId, recurrent, inputs, outputs, cache);
+        }
+    }
+    MNN_CONCURRENCY_END();
+    return NO_ERROR;
+}
+
+class CPULSTMRecurrenceCreator : public CPUBackend::Creator {
+public:
+    virtual Execution* onCreate(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
+                                const MNN::Op* op, Backend* backend) const override {
+        return new CPULSTMRecurrence(backend);
+    }
+};
+
+REGISTER_CPU_OP_CREATOR(CPULSTMRecurrenceCreator, OpType_LSTMRecurrence);
+} // namespace MNN
@@ -0,0 +1,47 @@
+//
+//  CPULSTMRecurrence.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef CPULSTMRecurrence_hpp
+#define CPULSTMRecurrence_hpp
+
+#include "core/Execution.hpp"
+#include "backend/cpu/compute/RNNFunction.hpp"
+
+namespace MNN {
+/**
+ * The recurrent steps of LSTM made by GeometryLSTM, the input gates of all time steps are computed by one MatMul
+ * before. Inputs: R of [directions, 4 * hidden, hidden] in IOFC order, the input gates of each direction of
+ * [seq * batch, 4 * hidden], and optionally the initial hidden and cell of [directions, batch, hidden]. Outputs: Y of
+ * [seq, directions, batch, hidden], optionally the last hidden and cell. Each step is one GEMM of the hidden state of
+ * all batches kept in C4 followed by the gate nonlinearity, the directions run in parallel. A constant R is packed
+ * once in onResize, otherwise in each run.
+ */
+class CPULSTMRecurrence : public Execution {
+public:
+    CPULSTMRecurrence(Backend* backend);
+    virtual ~CPULSTMRecurrence() = default;
+    virtual ErrorCode onResize(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) override;
+    virtual ErrorCode onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) override;
+
+private:
+    void _runDirection(int direction, const RNNMatMul& recurrent, const std::vector<Tensor*>& inputs,
+                       const std::vector<Tensor*>& outputs, float* cache) const;
+
+    int mDirections;
+    int mSequence;
+    int mBatch;
+    int mHidden;
+    int mHiddenPad;
+    int mCacheSize;
+    std::shared_ptr<Tensor> mCache;
+    // R of each direction packed, empty if R isn't constant
+    std::vector<std::shared_ptr<RNNMatMul>> mRecurrent;
+};
+} // namespace MNN
+
+#endif /* CPULSTMRecurrence_hpp */
@@ -11,6 +11,7 @@
 #include "core/Execution.hpp"
 #include "core/Concurrency.h"
 #include "backend/cpu/CPUBackend.hpp"
+#include "backend/cpu/compute/CommonOptFunction.h"
 #include "MNN_generated.h"
 
 
@@ -76,26 +77,18 @@ ErrorCode CPULayerNorm::onExecute(const std::vector<Tensor*> &inputs,
     const float* beta = beta_->host<float>();
 
     const float* input = inputs.at(0)->host<float>();
+    // The fused residual add: layer norm of input + residual
+    const float* residual = inputs.size() > 1 ? inputs.at(1)->host<float>() : nullptr;
     float* output = outputs.at(0)->host<float>();
-    for (int i = 0; i < outter_size_; ++i) {
-        const float* inner_input = input + i * inner_size_;
-        float* inner_output = output + i * inner_size_;
-        float sum = 0.f;
-        for (int j = 0; j < inner_size_; ++j) {
-            sum += inner_input[j];
-        }
-        float mean = sum / inner_size_;
-        float square_sum = 0.f;
-        for (int j = 0; j < inner_size_; ++j) {
-            square_sum += (inner_input[j] - mean) * (inner_input[j] - mean);
-        }
-        float variable = square_sum / inner_size_;
-        variable = 1.f / std::sqrt(variable + epsilon_);
-
-        for (int j = 0; j < inner_size_; ++j) {
-            inner_output[j] = (inner_input[j] - mean) * variable * gamma[j] + beta[j];
+    int threadNumber = std::min(static_cast<CPUBackend*>(backend())->threadNumber(), outter_size_);
+    MNN_CONCURRENCY_BEGIN(tId, threadNumber) {
+        for (int i = (int)tId; i < outter_size_; i += threadNumber) {
+            MNNLayerNorm(output + i * inner_size_, input + i * inner_size_,
+                         nullptr != residual ? residual + i * inner_size_ : nullptr, gamma, beta, epsilon_,
+                         inner_size_);
         }
     }
+    MNN_CONCURRENCY_END();
     return NO_ERROR;
 }
 
@@ -117,6 +110,14 @@ ErrorCode CPULayerNorm::onResize(const std::vector<Tensor*> &inputs,
     for (int i = rank - axis.size(); i < rank; ++i) {
         inner_size_ *= inputs.at(0)->length(i);
     }
+    if (inner_size_ != gamma_->elementSize()) {
+        MNN_ERROR("Size of gamma doesn't match the normalized axis in CPULayerNorm.\n");
+        return INPUT_DATA_ERROR;
+    }
+    if (inputs.size() > 1 && inputs.at(1)->elementSize() != inputs.at(0)->elementSize()) {
+        MNN_ERROR("Residual of CPULayerNorm should have the same size as input.\n");
+        return INPUT_DATA_ERROR;
+    }
     return NO_ERROR;
 }
 
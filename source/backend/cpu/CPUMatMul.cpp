@@ -10,8 +10,11 @@
 #include "CPUBackend.hpp"
 #include "math/Matrix.hpp"
 #include "compute/CommonOptFunction.h"
+#include "compute/Int8FunctionsOpt.h"
 #include "core/Macro.h"
 #include "core/Concurrency.h"
+#include "core/OpCommonUtils.hpp"
+#include "core/TensorUtils.hpp"
 #include "math/Vec.hpp"
 #include <limits>
 using Vec4 = MNN::Math::Vec<float, 4>;
@@ -114,7 +117,7 @@ void CPUMatMul::_scheduleForVecE(float* C, const float* biasPtr, int e, int l, i
                 }
                 Vec4::save(C + 4 * y, sumValue);
             }
-            for (int y=hR; y<h; y+=numberThread) {
+            for (int y=hR+tId; y<h; y+=numberThread) {
                 auto bs = B + y;
                 float sumValue = 0.0f;
                 if (biasPtr != nullptr) {
@@ -183,6 +186,180 @@ void CPUMatMul::_scheduleForVec(float* C, const float* biasPtr, int e, int l, in
     }
 }
 
+// Quantizes the l elements of src in srcStride to int8 by the symmetric scale of their absolute maximum, and writes
+// them to dst by groups of 8 in dstStride, zero padded. Returns the scale to dequantize.
+static float _quantizeDynamicInt8(int8_t* dst, int dstStride, const float* src, int srcStride, int l, float* buffer,
+                                  int8_t* quanBuffer) {
+    auto lPad = UP_DIV(l, 8) * 8;
+    if (1 == srcStride) {
+        ::memcpy(buffer, src, l * sizeof(float));
+    } else {
+        for (int i = 0; i < l; ++i) {
+            buffer[i] = src[i * srcStride];
+        }
+    }
+    ::memset(buffer + l, 0, (lPad - l) * sizeof(float));
+    auto maxValue = Vec4(0.0f);
+    auto minValue = Vec4(0.0f);
+    for (int i = 0; i < lPad; i += 4) {
+        auto value = Vec4::load(buffer + i);
+        maxValue   = Vec4::max(maxValue, value);
+        minValue   = Vec4::min(minValue, value);
+    }
+    float absMax = 0.0f;
+    for (int i = 0; i < 4; ++i) {
+        absMax = std::max(absMax, std::max(maxValue[i], -minValue[i]));
+    }
+    // -128 is excluded, so that the sum of two products fits in the int16 of the arm kernels
+    const float quanScale = absMax > 0.0f ? 127.0f / absMax : 0.0f;
+    const float scales[4] = {quanScale, quanScale, quanScale, quanScale};
+    MNNFloat2Int8(buffer, quanBuffer, lPad / 4, scales, -127, 127);
+    for (int i = 0; i < lPad / 8; ++i) {
+        ::memcpy(dst + i * dstStride, quanBuffer + 8 * i, 8 * sizeof(int8_t));
+    }
+    return absMax / 127.0f;
+}
+
+ErrorCode CPUMatMul::_scheduleForDynamicInt8(const std::vector<Tensor*>& inputs, Tensor* C, int e, int l, int h) {
+    const Tensor* A  = inputs[0];
+    const Tensor* B  = inputs[1];
+    int numberThread = mSupportMultiThread ? static_cast<CPUBackend*>(backend())->threadNumber() : 1;
+#ifdef MNN_USE_SSE
+    // The x86 kernels of MNNGemmInt8toFloat32_8x4_Common have no fixed width, a wider tile reuses more of B
+    const int unit   = 8;
+#else
+    const int unit   = DST_XUNIT;
+#endif
+    const int lU     = UP_DIV(l, 8);
+    const int hC4    = UP_DIV(h, 4);
+    const int eTiles = UP_DIV(e, unit);
+    // The strides of the rows and columns of A and B, which may be strided views, see CPUBackend::onElideRasters
+    int aRowStride = A->length(1), aColStride = 1;
+    int bRowStride = B->length(1), bColStride = 1;
+    auto AView = OpCommonUtils::getStridedView(A);
+    auto BView = OpCommonUtils::getStridedView(B);
+    if (nullptr != AView) {
+        OpCommonUtils::getMatrixView(*AView, A->length(1), aRowStride, aColStride);
+    }
+    if (nullptr != BView) {
+        OpCommonUtils::getMatrixView(*BView, B->length(1), bRowStride, bColStride);
+    }
+    const int aeStride = mTransposeA ? aColStride : aRowStride;
+    const int alStride = mTransposeA ? aRowStride : aColStride;
+    const int bhStride = mTransposeB ? bRowStride : bColStride;
+    const int blStride = mTransposeB ? bColStride : bRowStride;
+
+    // Per thread: the float result of a tile [hC4, unit, 4], the row of float, the scales and int8 of the A tile
+    // [lU, unit, 8] and the int8 row
+    const int bufferSize = hC4 * unit * 4 + lU * 8 + unit + UP_DIV(lU * (unit + 1) * 8, 4);
+    std::shared_ptr<Tensor> threadBuffer(Tensor::createDevice<float>({numberThread, bufferSize}));
+    std::shared_ptr<Tensor> quanB(Tensor::createDevice<int8_t>({hC4, lU * 32}));
+    std::shared_ptr<Tensor> quanBScale(Tensor::createDevice<float>({hC4 * 4}));
+    auto res = backend()->onAcquireBuffer(threadBuffer.get(), Backend::DYNAMIC);
+    if (!res) {
+        return OUT_OF_MEMORY;
+    }
+    auto bufferPtr = threadBuffer->host<float>();
+    // B: [hC4, lU, 4, 8], quantized by columns
+    auto quanFunction = [h, l, lU, bhStride, blStride](int8_t* dst, float* scale, const float* BPtr, int z,
+                                                       float* buffer) {
+        for (int i = 0; i < 4; ++i) {
+            auto dstX = dst + z * lU * 32 + i * 8;
+            int x     = 4 * z + i;
+            if (x >= h) {
+                for (int sz = 0; sz < lU; ++sz) {
+                    ::memset(dstX + sz * 32, 0, 8 * sizeof(int8_t));
+                }
+                scale[x] = 0.0f;
+                continue;
+            }
+            scale[x] = _quantizeDynamicInt8(dstX, 32, BPtr + x * bhStride, blStride, l, buffer,
+                                            (int8_t*)(buffer + lU * 8));
+        }
+    };
+    int8_t* quanBPtr     = nullptr;
+    float* quanBScalePtr = nullptr;
+    const bool constB = nullptr == BView && TensorUtils::getDescribe(B)->usage == Tensor::InsideDescribe::CONSTANT &&
+                        nullptr != B->host<float>();
+    if (constB) {
+        mQuanB.resize(hC4 * lU * 32);
+        mQuanBScale.resize(hC4 * 4);
+        std::vector<float> buffer(lU * 10);
+        for (int z = 0; z < hC4; ++z) {
+            quanFunction(mQuanB.data(), mQuanBScale.data(), B->host<float>(), z, buffer.data());
+        }
+        quanBPtr      = mQuanB.data();
+        quanBScalePtr = mQuanBScale.data();
+    } else {
+        mQuanB.clear();
+        mQuanBScale.clear();
+        res = backend()->onAcquireBuffer(quanB.get(), Backend::DYNAMIC) &&
+              backend()->onAcquireBuffer(quanBScale.get(), Backend::DYNAMIC);
+        if (!res) {
+            return OUT_OF_MEMORY;
+        }
+        quanBPtr      = quanB->host<int8_t>();
+        quanBScalePtr = quanBScale->host<float>();
+        mPreFunctions.emplace_back(std::make_pair(
+            [quanFunction, quanBPtr, quanBScalePtr, bufferPtr, bufferSize, hC4, numberThread](
+                int tId, const float* APtr, const float* BPtr) {
+                for (int z = tId; z < hC4; z += numberThread) {
+                    quanFunction(quanBPtr, quanBScalePtr, BPtr, z, bufferPtr + tId * bufferSize);
+                }
+            }, numberThread));
+    }
+    const float* biasPtr = nullptr;
+    if (inputs.size() > 2) {
+        biasPtr = inputs[2]->host<float>();
+    }
+    // A is quantized by rows tile by tile, then the int32 of the tile is dequantized to C with the bias
+    mPostFunctions.emplace_back(std::make_pair([=](int tId, const float* APtr, const float* BPtr, float* CPtr) {
+        auto dstTemp   = bufferPtr + tId * bufferSize;
+        auto rowBuffer = dstTemp + hC4 * unit * 4;
+        auto scaleA    = rowBuffer + lU * 8;
+        auto quanA     = (int8_t*)(scaleA + unit);
+        auto quanRow   = quanA + lU * unit * 8;
+        for (int t = tId; t < eTiles; t += numberThread) {
+            const int eStart = t * unit;
+            const int width  = std::min(unit, e - eStart);
+            for (int w = 0; w < width; ++w) {
+                scaleA[w] = _quantizeDynamicInt8(quanA + w * 8, width * 8, APtr + (eStart + w) * aeStride, alStride,
+                                                 l, rowBuffer, quanRow);
+            }
+            if (width == DST_XUNIT) {
+                MNNGemmInt8toFloat32_8x4_Unit(dstTemp, quanA, quanBPtr, lU, width * 4, hC4);
+            } else {
+                MNNGemmInt8toFloat32_8x4_Common(dstTemp, quanA, quanBPtr, lU, width, width * 4, hC4);
+            }
+            for (int w = 0; w < width; ++w) {
+                auto dstY   = CPtr + (eStart + w) * h;
+                auto srcY   = dstTemp + w * 4;
+                auto scaleY = scaleA[w];
+                for (int z = 0; z < h / 4; ++z) {
+                    auto value = Vec4::load(srcY + z * width * 4) * Vec4::load(quanBScalePtr + 4 * z) * scaleY;
+                    if (nullptr != biasPtr) {
+                        value = value + Vec4::load(biasPtr + 4 * z);
+                    }
+                    Vec4::save(dstY + 4 * z, value);
+                }
+                for (int x = h / 4 * 4; x < h; ++x) {
+                    auto value = srcY[(x / 4) * width * 4 + x % 4] * quanBScalePtr[x] * scaleY;
+                    if (nullptr != biasPtr) {
+                        value += biasPtr[x];
+                    }
+                    dstY[x] = value;
+                }
+            }
+        }
+    }, numberThread));
+    backend()->onReleaseBuffer(threadBuffer.get(), Backend::DYNAMIC);
+    if (!constB) {
+        backend()->onReleaseBuffer(quanB.get(), Backend::DYNAMIC);
+        backend()->onReleaseBuffer(quanBScale.get(), Backend::DYNAMIC);
+    }
+    return NO_ERROR;
+}
+
 ErrorCode CPUMatMul::onResize(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
     const Tensor* A = inputs[0];
     const Tensor* B = inputs[1];
@@ -222,6 +399,12 @@ ErrorCode CPUMatMul::onResize(const std::vector<Tensor*>& inputs, const std::vec
         _scheduleForVecE(C->host<float>(), biasPtr, e, l, h);
         return NO_ERROR;
     }
+#if defined(MNN_USE_NEON) || defined(MNN_USE_SSE)
+    // Only the NEON and x86 kernels of MNNGemmInt8toFloat32_8x4 are faster than the float GEMM, the C ones are scalar
+    if (static_cast<CPUBackend*>(backend())->precisionMode() == BackendConfig::Precision_Low) {
+        return _scheduleForDynamicInt8(inputs, C, e, l, h);
+    }
+#endif
     int eP, lP, hP;
     MNNGetMatMulPackMode(&eP, &lP, &hP);
     std::shared_ptr<Tensor> AT(Tensor::createDevice<float>({UP_DIV(l, 4), e, 4}));
@@ -236,16 +419,40 @@ ErrorCode CPUMatMul::onResize(const std::vector<Tensor*>& inputs, const std::vec
     auto hC4 = UP_DIV(h, 4);
     auto lC4 = UP_DIV(l, 4);
     int numberThread = mSupportMultiThread ? ((CPUBackend*)backend())->threadNumber() : 1;
-    mPreFunctions.emplace_back(std::make_pair([BTempPtr, l, h, this] (int tId, const float* APtr, const float* BPtr) {
-        MNNPackForMatMul_B(BTempPtr, BPtr, h, l, mTransposeB);
-    } , 1));
+    // The inputs may be strided views of the tensors copied by Raster before, see CPUBackend::onElideRasters
+    auto AView = OpCommonUtils::getStridedView(A);
+    auto BView = OpCommonUtils::getStridedView(B);
+    if (nullptr != BView) {
+        int rowStride, colStride;
+        OpCommonUtils::getMatrixView(*BView, B->length(1), rowStride, colStride);
+        int hStride = mTransposeB ? rowStride : colStride;
+        int lStride = mTransposeB ? colStride : rowStride;
+        mPreFunctions.emplace_back(std::make_pair([BTempPtr, l, h, hStride, lStride] (int tId, const float* APtr, const float* BPtr) {
+            MNNPackForMatMul_BStrided(BTempPtr, BPtr, h, l, hStride, lStride);
+        } , 1));
+    } else {
+        mPreFunctions.emplace_back(std::make_pair([BTempPtr, l, h, this] (int tId, const float* APtr, const float* BPtr) {
+            MNNPackForMatMul_B(BTempPtr, BPtr, h, l, mTransposeB);
+        } , 1));
+    }
     res = backend()->onAcquireBuffer(AT.get(), Backend::DYNAMIC);
     res = res && backend()->onAcquireBuffer(CT.get(), Backend::DYNAMIC);
     if (!res) {
         return OUT_OF_MEMORY;
     }
     auto ATPtr = AT->host<float>();
-    if (mTransposeA) {
+    if (nullptr != AView) {
+        int rowStride, colStride;
+        OpCommonUtils::getMatrixView(*AView, A->length(1), rowStride, colStride);
+        int eStride = mTransposeA ? colStride : rowStride;
+        int lStride = mTransposeA ? rowStride : colStride;
+        mPreFunctions.emplace_back(std::make_pair(
+            [ATPtr, e, l, lC4, eStride, lStride, numberThread](int tId, const float* APtr, const float* BPtr) {
+            for (int z = tId; z < lC4; z += numberThread) {
+                MNNPackC4Strided(ATPtr + z * e * 4, APtr + 4 * z * lStride, e, std::min(4, l - 4 * z), eStride, lStride);
+            }
+        }, numberThread));
+    } else if (mTransposeA) {
         // l, e -> lC4, e, 4
         mPreFunctions.emplace_back(std::make_pair([ATPtr, e, l](int tId, const float* APtr, const float* BPtr) {
             MNNPackC4(ATPtr, APtr, e, l);
@@ -313,8 +520,8 @@ ErrorCode CPUMatMul::onExecute(const std::vector<Tensor*>& inputs, const std::ve
         return NO_ERROR;
     }
 
-    auto APtr = inputs[0]->host<float>();
-    auto BPtr = inputs[1]->host<float>();
+    auto APtr = (const float*)OpCommonUtils::viewHost(inputs[0]);
+    auto BPtr = (const float*)OpCommonUtils::viewHost(inputs[1]);
     auto CPtr = outputs[0]->host<float>();
 
     for (auto& f : mPreFunctions) {
@@ -340,6 +547,18 @@ public:
         auto param = op->main_as_MatMul();
         return new CPUMatMul(backend, param->transposeA(), param->transposeB(), true);
     }
+    virtual bool onSupportStridedInput(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
+                                       const MNN::Op* op, int index, const Tensor* view) const override {
+        // The vector paths of h = 1 or e = 1 read the inputs densely
+        auto C = outputs[0];
+        if (index >= 2 || inputs[index]->dimensions() != 2 || C->dimensions() != 2 || C->length(0) <= 1 ||
+            C->length(1) <= 1 || view->getType() != halide_type_of<float>()) {
+            return false;
+        }
+        int rowStride, colStride;
+        return OpCommonUtils::getMatrixView(*OpCommonUtils::getStridedView(view), inputs[index]->length(1), rowStride,
+                                            colStride);
+    }
 };
 
 REGISTER_CPU_OP_CREATOR(CPUMatMulCreator, OpType_MatMul);
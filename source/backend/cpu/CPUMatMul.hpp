@@ -25,12 +25,16 @@ public:
 private:
     void _scheduleForVec(float* C, const float* biasPtr, int e, int l, int h);
     void _scheduleForVecE(float* C, const float* biasPtr, int e, int l, int h);
+    ErrorCode _scheduleForDynamicInt8(const std::vector<Tensor *> &inputs, Tensor *C, int e, int l, int h);
     bool mTransposeA;
     bool mTransposeB;
     bool mSupportMultiThread = false;
     std::vector<std::pair<std::function<void(int, const float*, const float*)>, int>> mPreFunctions;
     std::vector<std::pair<std::function<void(int, const float*, const float*, float*)>, int>> mPostFunctions;
     std::shared_ptr<StrassenMatrixComputor> mComputer;
+    // The constant B quantized once for Precision_Low on NEON and x86, see _scheduleForDynamicInt8
+    std::vector<int8_t> mQuanB;
+    std::vector<float> mQuanBScale;
 };
 } // namespace MNN
 
@@ -0,0 +1,187 @@
+//
+//  CPUMmapAllocator.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/CPUMmapAllocator.hpp"
+#include <stdio.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "backend/cpu/CPUNuma.hpp"
+#include "core/MNNMemoryUtils.h"
+#include "core/Macro.h"
+#ifdef __linux__
+#include <sys/mman.h>
+#define MNN_MMAP_LINUX
+#endif
+
+// Smaller buffers are allocated by malloc
+#define MNN_MMAP_MIN_SIZE (64 * 1024)
+#define MNN_PAGE_SIZE (4 * 1024)
+#define MNN_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+// Each thread touches at least so many bytes when prefault
+#define MNN_PREFAULT_UNIT (4 * 1024 * 1024)
+
+namespace MNN {
+CPUMmapAllocator::CPUMmapAllocator(int node, BackendConfig::PageMode page, bool prefault, int threadNumber) {
+    mNode         = node;
+    mPage         = page;
+    mPrefault     = prefault;
+    mThreadNumber = std::max(threadNumber, 1);
+}
+
+void* CPUMmapAllocator::_map(size_t size, Mapping& mapping) const {
+#ifdef MNN_MMAP_LINUX
+    mapping.size        = size;
+    mapping.hugeTLB     = false;
+    mapping.transparent = false;
+    if (BackendConfig::Page_Normal == mPage || size < MNN_HUGE_PAGE_SIZE) {
+        auto ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return MAP_FAILED == ptr ? nullptr : ptr;
+    }
+    mapping.size = UP_DIV(size, MNN_HUGE_PAGE_SIZE) * MNN_HUGE_PAGE_SIZE;
+#ifdef MAP_HUGETLB
+    if (BackendConfig::Page_HugeTLB == mPage) {
+        auto ptr = ::mmap(nullptr, mapping.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                          -1, 0);
+        if (MAP_FAILED != ptr) {
+            mapping.hugeTLB = true;
+            return ptr;
+        }
+        // No huge page is reserved, use transparent huge pages
+    }
+#endif
+    // Map more and unmap the head and tail, so that the huge pages are aligned
+    auto ptr = ::mmap(nullptr, mapping.size + MNN_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                      -1, 0);
+    if (MAP_FAILED == ptr) {
+        return nullptr;
+    }
+    auto origin  = (uint8_t*)ptr;
+    auto aligned = (uint8_t*)(UP_DIV((size_t)origin, MNN_HUGE_PAGE_SIZE) * MNN_HUGE_PAGE_SIZE);
+    if (aligned > origin) {
+        ::munmap(origin, aligned - origin);
+    }
+    auto tail = MNN_HUGE_PAGE_SIZE - (aligned - origin);
+    if (tail > 0) {
+        ::munmap(aligned + mapping.size, tail);
+    }
+#ifdef MADV_HUGEPAGE
+    mapping.transparent = 0 == ::madvise(aligned, mapping.size, MADV_HUGEPAGE);
+#endif
+    return aligned;
+#else
+    return nullptr;
+#endif
+}
+
+void CPUMmapAllocator::_prefault(uint8_t* ptr, size_t size, size_t pageSize) const {
+    auto touch = [ptr, pageSize](size_t begin, size_t end) {
+        for (size_t offset = begin; offset < end; offset += pageSize) {
+            ((volatile uint8_t*)ptr)[offset] = 0;
+        }
+    };
+    int threadNumber = (int)std::min((size_t)mThreadNumber, UP_DIV(size, MNN_PREFAULT_UNIT));
+    if (threadNumber <= 1) {
+        touch(0, size);
+        return;
+    }
+    // Split by pages, the caller touches the first part
+    auto pageNumber = UP_DIV(size, pageSize);
+    std::vector<std::thread> threads;
+    for (int t = 1; t < threadNumber; ++t) {
+        auto begin = pageNumber * t / threadNumber * pageSize;
+        auto end   = std::min(pageNumber * (t + 1) / threadNumber * pageSize, size);
+        threads.emplace_back(touch, begin, end);
+    }
+    touch(0, std::min(pageNumber / threadNumber * pageSize, size));
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+std::pair<void*, int> CPUMmapAllocator::onAlloc(int size) {
+    if (size < MNN_MMAP_MIN_SIZE) {
+        return std::make_pair(MNNMemoryAllocAlign(size, MNN_MEMORY_ALIGN_DEFAULT), 0);
+    }
+    // The second of pointer is the offset from the base of mmap, to distinguish from malloc
+    Mapping mapping;
+    auto ptr = (uint8_t*)_map((size_t)size + MNN_MEMORY_ALIGN_DEFAULT, mapping);
+    if (nullptr == ptr) {
+        return std::make_pair(MNNMemoryAllocAlign(size, MNN_MEMORY_ALIGN_DEFAULT), 0);
+    }
+    if (mNode >= 0) {
+        // Bind before first touch
+        CPUNuma::get()->bindMemory(ptr, mapping.size, mNode);
+    }
+    if (mPrefault) {
+        _prefault(ptr, mapping.size, mapping.hugeTLB ? MNN_HUGE_PAGE_SIZE : MNN_PAGE_SIZE);
+    }
+    std::lock_guard<std::mutex> _l(mLock);
+    mMappings.insert(std::make_pair((void*)ptr, mapping));
+    return std::make_pair((void*)ptr, MNN_MEMORY_ALIGN_DEFAULT);
+}
+
+void CPUMmapAllocator::onRelease(std::pair<void*, int> ptr) {
+    if (0 == ptr.second) {
+        MNNMemoryFreeAlign(ptr.first);
+        return;
+    }
+#ifdef MNN_MMAP_LINUX
+    std::lock_guard<std::mutex> _l(mLock);
+    auto iter = mMappings.find(ptr.first);
+    MNN_ASSERT(iter != mMappings.end());
+    ::munmap(ptr.first, iter->second.size);
+    mMappings.erase(iter);
+#endif
+}
+
+size_t CPUMmapAllocator::hugePageSize() const {
+    std::lock_guard<std::mutex> _l(mLock);
+    size_t total = 0;
+    std::vector<std::pair<size_t, size_t>> transparent;
+    for (auto& iter : mMappings) {
+        if (iter.second.hugeTLB) {
+            total += iter.second.size;
+        } else if (iter.second.transparent) {
+            transparent.emplace_back((size_t)iter.first, (size_t)iter.first + iter.second.size);
+        }
+    }
+#ifdef MNN_MMAP_LINUX
+    if (transparent.empty()) {
+        return total;
+    }
+    // Transparent huge pages are counted by AnonHugePages of the memory areas containing the mappings
+    auto file = fopen("/proc/self/smaps", "rb");
+    if (nullptr == file) {
+        return total;
+    }
+    char line[512];
+    size_t overlap = 0;
+    while (nullptr != fgets(line, sizeof(line), file)) {
+        unsigned long begin, end;
+        size_t hugeKB;
+        if (2 == sscanf(line, "%lx-%lx", &begin, &end)) {
+            overlap = 0;
+            for (auto& range : transparent) {
+                auto lower = std::max((size_t)begin, range.first);
+                auto upper = std::min((size_t)end, range.second);
+                if (upper > lower) {
+                    overlap += upper - lower;
+                }
+            }
+            continue;
+        }
+        if (overlap > 0 && 1 == sscanf(line, "AnonHugePages: %zu kB", &hugeKB)) {
+            total += std::min(overlap, hugeKB * 1024);
+        }
+    }
+    fclose(file);
+#endif
+    return total;
+}
+} // namespace MNN
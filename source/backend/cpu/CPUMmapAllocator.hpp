@@ -0,0 +1,57 @@
+//
+//  CPUMmapAllocator.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef CPUMmapAllocator_hpp
+#define CPUMmapAllocator_hpp
+
+#include <MNN/MNNForwardType.h>
+#include <map>
+#include <mutex>
+#include "core/BufferAllocator.hpp"
+
+namespace MNN {
+/**
+ * Allocate large buffers by anonymous mmap, so that they can be bound to a NUMA node, use huge pages and be
+ * pre-faulted before the first inference. Small buffers and the systems without mmap use malloc.
+ */
+class MNN_PUBLIC CPUMmapAllocator : public BufferAllocator::Allocator {
+public:
+    /**
+     * @param node          NUMA node to bind, -1 means not bind.
+     * @param page          huge page mode, see BackendConfig::PageMode.
+     * @param prefault      touch all pages when allocated.
+     * @param threadNumber  number of threads to touch pages.
+     */
+    CPUMmapAllocator(int node, BackendConfig::PageMode page, bool prefault, int threadNumber);
+    virtual ~CPUMmapAllocator() = default;
+    virtual std::pair<void*, int> onAlloc(int size) override;
+    virtual void onRelease(std::pair<void*, int> ptr) override;
+
+    /** bytes of the allocated memory that is on huge pages */
+    size_t hugePageSize() const;
+
+private:
+    struct Mapping {
+        size_t size;
+        bool hugeTLB;
+        bool transparent;
+    };
+    void* _map(size_t size, Mapping& mapping) const;
+    void _prefault(uint8_t* ptr, size_t size, size_t pageSize) const;
+
+    int mNode;
+    BackendConfig::PageMode mPage;
+    bool mPrefault;
+    int mThreadNumber;
+    mutable std::mutex mLock;
+    // base of mmap -> mapping
+    std::map<void*, Mapping> mMappings;
+};
+} // namespace MNN
+
+#endif /* CPUMmapAllocator_hpp */
@@ -0,0 +1,153 @@
+//
+//  CPUNuma.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/CPUNuma.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "backend/cpu/CPUMmapAllocator.hpp"
+#include "core/Macro.h"
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <dirent.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define MNN_NUMA_LINUX
+#endif
+
+// See MPOL_PREFERRED in linux/mempolicy.h, fall back to other nodes if the node is full
+#define MNN_NUMA_MPOL_PREFERRED 1
+
+namespace MNN {
+CPUNuma::CPUNuma() {
+#ifdef MNN_NUMA_LINUX
+    const char* root = "/sys/devices/system/node";
+    auto dir         = opendir(root);
+    if (nullptr == dir) {
+        return;
+    }
+    while (auto entry = readdir(dir)) {
+        int node = 0;
+        if (0 != strncmp(entry->d_name, "node", 4) || 1 != sscanf(entry->d_name + 4, "%d", &node)) {
+            continue;
+        }
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s/cpulist", root, entry->d_name);
+        auto file = fopen(path, "rb");
+        if (nullptr == file) {
+            continue;
+        }
+        char buffer[1024];
+        auto cpus = parseCPUList(fgets(buffer, sizeof(buffer), file));
+        fclose(file);
+        // Nodes of memory only are not used
+        if (!cpus.empty()) {
+            mNodes[node] = std::move(cpus);
+        }
+    }
+    closedir(dir);
+#endif
+}
+
+const CPUNuma* CPUNuma::get() {
+    static CPUNuma gNuma;
+    return &gNuma;
+}
+
+std::vector<int> CPUNuma::nodes() const {
+    std::vector<int> res;
+    for (auto& iter : mNodes) {
+        res.emplace_back(iter.first);
+    }
+    return res;
+}
+
+const std::vector<int>& CPUNuma::cpus(int node) const {
+    static std::vector<int> gEmpty;
+    auto iter = mNodes.find(node);
+    if (iter == mNodes.end()) {
+        return gEmpty;
+    }
+    return iter->second;
+}
+
+bool CPUNuma::bindThread(int node) const {
+#ifdef MNN_NUMA_LINUX
+    auto& nodeCpus = cpus(node);
+    if (nodeCpus.empty()) {
+        return false;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (auto cpu : nodeCpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &mask);
+        }
+    }
+    return 0 == sched_setaffinity(0, sizeof(mask), &mask);
+#else
+    return false;
+#endif
+}
+
+bool CPUNuma::bindMemory(void* ptr, size_t size, int node) const {
+#if defined(MNN_NUMA_LINUX) && defined(__NR_mbind)
+    if (cpus(node).empty()) {
+        return false;
+    }
+    const int bits = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> mask(node / bits + 1, 0);
+    mask[node / bits] = 1UL << (node % bits);
+    // The kernel uses maxnode - 1 bits of mask
+    auto code = syscall(__NR_mbind, ptr, size, MNN_NUMA_MPOL_PREFERRED, mask.data(), mask.size() * bits + 1, 0);
+    return 0 == code;
+#else
+    return false;
+#endif
+}
+
+std::shared_ptr<BufferAllocator::Allocator> CPUNuma::createAllocator(int node) const {
+    if (!cpus(node).empty()) {
+        return std::shared_ptr<BufferAllocator::Allocator>(
+            new CPUMmapAllocator(node, BackendConfig::Page_Normal, false, 1));
+    }
+    return BufferAllocator::Allocator::createDefault();
+}
+
+std::vector<int> CPUNuma::parseCPUList(const char* list) {
+    std::vector<int> res;
+    if (nullptr == list) {
+        return res;
+    }
+    auto current = list;
+    while (*current != '\0') {
+        char* next = nullptr;
+        auto first = strtol(current, &next, 10);
+        if (next == current) {
+            break;
+        }
+        auto last = first;
+        if ('-' == *next) {
+            current = next + 1;
+            last    = strtol(current, &next, 10);
+            if (next == current) {
+                break;
+            }
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) {
+            res.emplace_back((int)cpu);
+        }
+        current = next;
+        if (',' != *current) {
+            break;
+        }
+        current++;
+    }
+    return res;
+}
+} // namespace MNN
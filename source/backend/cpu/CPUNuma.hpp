@@ -0,0 +1,51 @@
+//
+//  CPUNuma.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef CPUNuma_hpp
+#define CPUNuma_hpp
+
+#include <map>
+#include <memory>
+#include <vector>
+#include "core/BufferAllocator.hpp"
+
+namespace MNN {
+/**
+ * NUMA topology of the machine, discovered from /sys/devices/system/node on Linux. On other systems or machines
+ * with only one node, nodeNumber() is not more than 1 and nothing is bound.
+ */
+class MNN_PUBLIC CPUNuma {
+public:
+    static const CPUNuma* get();
+
+    /** number of nodes that have cpus */
+    int nodeNumber() const {
+        return (int)mNodes.size();
+    }
+    /** ids of nodes that have cpus, the same as the system's numbering */
+    std::vector<int> nodes() const;
+    /** cpus of node, empty if node is invalid */
+    const std::vector<int>& cpus(int node) const;
+
+    /** bind the calling thread to the cpus of node */
+    bool bindThread(int node) const;
+    /** prefer node for the pages of [ptr, ptr + size), ptr must be page aligned */
+    bool bindMemory(void* ptr, size_t size, int node) const;
+    /** allocator whose memory is bound to node, the default allocator if node is invalid */
+    std::shared_ptr<BufferAllocator::Allocator> createAllocator(int node) const;
+
+    /** parse cpu list of sysfs such as "0-3,8,10-11" */
+    static std::vector<int> parseCPUList(const char* list);
+
+private:
+    CPUNuma();
+    std::map<int, std::vector<int>> mNodes;
+};
+} // namespace MNN
+
+#endif /* CPUNuma_hpp */
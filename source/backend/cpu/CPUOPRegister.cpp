@@ -72,6 +72,9 @@ extern void ___CPUPriorBoxCreator__OpType_PriorBox__();
 extern void ___CPUEltwiseInt8Creator__OpType_EltwiseInt8__();
 extern void ___CPUBatchMatMulCreator__OpType_BatchMatMul__();
 extern void ___CPULayerNormCreator__OpType_LayerNorm__();
+extern void ___CPUAttentionCreator__OpType_Attention__();
+extern void ___CPUEmbeddingBagCreator__OpType_EmbeddingBag__();
+extern void ___CPULSTMRecurrenceCreator__OpType_LSTMRecurrence__();
 
 void registerCPUOps() {
 ___CPUCropAndResizeCreator__OpType_CropAndResize__();
@@ -146,5 +149,8 @@ ___CPUPriorBoxCreator__OpType_PriorBox__();
 ___CPUEltwiseInt8Creator__OpType_EltwiseInt8__();
 ___CPUBatchMatMulCreator__OpType_BatchMatMul__();
 ___CPULayerNormCreator__OpType_LayerNorm__();
+___CPUAttentionCreator__OpType_Attention__();
+___CPUEmbeddingBagCreator__OpType_EmbeddingBag__();
+___CPULSTMRecurrenceCreator__OpType_LSTMRecurrence__();
 }
 }
@@ -8,172 +8,200 @@
 
 #include "backend/cpu/CPURNNSequenceGRU.hpp"
 #include <math.h>
+#include <algorithm>
 #include "backend/cpu/CPUBackend.hpp"
-#include "backend/cpu/compute/ConvOpt.h"
-#include "math/Matrix.hpp"
+#include "backend/cpu/compute/CommonOptFunction.h"
+#include "core/Concurrency.h"
+#include "core/Macro.h"
+#include "math/Vec.hpp"
 
 namespace MNN {
-
-static inline float sigmoid(float x) {
-    return 1. / (1. + expf(-x));
-}
+using Vec4 = MNN::Math::Vec<float, 4>;
 
 // implement GRU cell function
 // Ref: tensorflow/python/ops/rnn_cell_impl.py
-static void runRNNStep(const float* input, const int inputLength, std::shared_ptr<Tensor>& hiddenState,
-                       const int numUnits, std::shared_ptr<Tensor>& gateWeight, std::shared_ptr<Tensor>& gateBias,
-                       std::shared_ptr<Tensor>& candidateWeight, std::shared_ptr<Tensor>& candidateBias,
-                       std::shared_ptr<Tensor>& inputAndState, std::shared_ptr<Tensor>& gate) {
-    // gate is (r_t, z_t)
-    auto inputAndStatePtr = inputAndState->host<float>();
-    auto hiddenStatePtr   = hiddenState->host<float>();
-    ::memcpy(inputAndStatePtr, input, inputLength * sizeof(float));
-    ::memcpy(inputAndStatePtr + inputLength, hiddenStatePtr, numUnits * sizeof(float));
-    Math::Matrix::multi(gate.get(), inputAndState.get(), gateWeight.get());
-    Math::Matrix::add(gate.get(), gate.get(), gateBias.get());
-    const int gateSize = gate->elementSize();
-    auto gatePtr       = gate->host<float>();
-    for (int i = 0; i < gateSize; ++i) {
-        gatePtr[i] = sigmoid(gatePtr[i]);
-    }
-
-    {
-        // reset gate
-        auto resetGatePtr = inputAndStatePtr + inputLength;
-        int k             = 0;
-        auto numUnitC4    = numUnits / 4;
-        if (numUnitC4 > 0) {
-            MNNMatrixProd(resetGatePtr, gatePtr, hiddenStatePtr, numUnitC4, 0, 0, 0, 1);
-            k = numUnitC4 * 4;
-        }
-        for (; k < numUnits; ++k) {
-            resetGatePtr[k] = gatePtr[k] * hiddenStatePtr[k];
-        }
-    }
-
-    // use r_t to apply Matrix multi and add
-    gate->setLength(1, numUnits);
-    Math::Matrix::multi(gate.get(), inputAndState.get(), candidateWeight.get());
-    Math::Matrix::add(gate.get(), gate.get(), candidateBias.get());
-
-    for (int i = 0; i < numUnits; ++i) {
-        hiddenStatePtr[i] =
-            gatePtr[numUnits + i] * hiddenStatePtr[i] + (1.0 - gatePtr[numUnits + i]) * tanhf(gatePtr[i]);
-    }
-    // reset gate shape fot the next iteration
-    gate->setLength(1, 2 * numUnits);
-}
-
+// The gates of all time steps from the input are computed by one GEMM, then each step only multiplies the hidden state
+// of all batches in C4 by the recurrent weights packed in the constructor.
 CPURNNSequenceGRU::CPURNNSequenceGRU(const Op* op, Backend* backend) : MNN::Execution(backend) {
     auto rnnParam       = op->main_as_RNNParam();
     mKeepAllOutputs     = rnnParam->keepAllOutputs();
     mIsBidirectionalRNN = rnnParam->isBidirectionalRNN();
     mNumUnits           = rnnParam->numUnits();
-
-    auto copyData = [=](std::shared_ptr<Tensor>& tensor, const Blob* src) {
-        std::vector<int> shape;
-        for (int i = 0; i < src->dims()->size(); ++i) {
-            shape.push_back(src->dims()->data()[i]);
+    mNumUnitsPad        = ROUND_UP(mNumUnits, 4);
+    MNN_ASSERT(rnnParam->fwCandidateBias()->float32s()->size() == mNumUnits);
+
+    auto createDirection = [this](const Blob* gateWeight, const Blob* gateBias, const Blob* candidateWeight,
+                                  const Blob* candidateBias) {
+        // gateWeight: [inputSize + numUnits, 2 * numUnits], candidateWeight: [inputSize + numUnits, numUnits]
+        const int units     = mNumUnits;
+        const int inputSize = gateWeight->float32s()->size() / (2 * units) - units;
+        auto gateW          = gateWeight->float32s()->data();
+        auto candidateW     = candidateWeight->float32s()->data();
+        std::vector<float> inputWeight(inputSize * 3 * units);
+        for (int i = 0; i < inputSize; ++i) {
+            ::memcpy(inputWeight.data() + i * 3 * units, gateW + i * 2 * units, 2 * units * sizeof(float));
+            ::memcpy(inputWeight.data() + i * 3 * units + 2 * units, candidateW + i * units, units * sizeof(float));
         }
-        tensor.reset(Tensor::createDevice<float>(shape));
-        backend->onAcquireBuffer(tensor.get(), Backend::STATIC);
-        ::memcpy(tensor->host<float>(), src->float32s()->data(), src->float32s()->size() * sizeof(float));
+        std::vector<float> inputBias(3 * units);
+        ::memcpy(inputBias.data(), gateBias->float32s()->data(), 2 * units * sizeof(float));
+        ::memcpy(inputBias.data() + 2 * units, candidateBias->float32s()->data(), units * sizeof(float));
+        auto paddedWeight    = RNNPadGates(inputWeight.data(), 3, units, inputSize, false);
+        auto paddedBias      = RNNPadGates(inputBias.data(), 3, units, 1, false);
+        auto paddedGate      = RNNPadGates(gateW + inputSize * 2 * units, 2, units, units, false);
+        auto paddedCandidate = RNNPadGates(candidateW + inputSize * units, 1, units, units, false);
+        Direction direction;
+        direction.input.reset(
+            new RNNMatMul(paddedWeight.data(), paddedBias.data(), inputSize, 3 * mNumUnitsPad, false));
+        direction.gate.reset(new RNNMatMul(paddedGate.data(), nullptr, units, 2 * mNumUnitsPad, false));
+        direction.candidate.reset(new RNNMatMul(paddedCandidate.data(), nullptr, units, mNumUnitsPad, false));
+        mDirections.emplace_back(direction);
     };
-    copyData(mFwGateWeight, rnnParam->fwGateWeight());
-    copyData(mFwGateBias, rnnParam->fwGateBias());
-    copyData(mFwCandidateWeight, rnnParam->fwCandidateWeight());
-    copyData(mFwCandidateBias, rnnParam->fwCandidateBias());
-    MNN_ASSERT(mFwCandidateBias->length(0) == mNumUnits);
+    createDirection(rnnParam->fwGateWeight(), rnnParam->fwGateBias(), rnnParam->fwCandidateWeight(),
+                    rnnParam->fwCandidateBias());
     if (mIsBidirectionalRNN) {
-        copyData(mBwGateWeight, rnnParam->bwGateWeight());
-        copyData(mBwGateBias, rnnParam->bwGateBias());
-        copyData(mBwCandidateWeight, rnnParam->bwCandidateWeight());
-        copyData(mBwCandidateBias, rnnParam->bwCandidateBias());
+        createDirection(rnnParam->bwGateWeight(), rnnParam->bwGateBias(), rnnParam->bwCandidateWeight(),
+                        rnnParam->bwCandidateBias());
     }
 }
 
 CPURNNSequenceGRU::~CPURNNSequenceGRU() {
-    backend()->onReleaseBuffer(mFwGateWeight.get(), Backend::STATIC);
-    backend()->onReleaseBuffer(mFwGateBias.get(), Backend::STATIC);
-    backend()->onReleaseBuffer(mFwCandidateWeight.get(), Backend::STATIC);
-    backend()->onReleaseBuffer(mFwCandidateBias.get(), Backend::STATIC);
-    if (mIsBidirectionalRNN) {
-        backend()->onReleaseBuffer(mBwGateWeight.get(), Backend::STATIC);
-        backend()->onReleaseBuffer(mBwGateBias.get(), Backend::STATIC);
-        backend()->onReleaseBuffer(mBwCandidateWeight.get(), Backend::STATIC);
-        backend()->onReleaseBuffer(mBwCandidateBias.get(), Backend::STATIC);
-    }
+    // Do nothing
 }
 
 ErrorCode CPURNNSequenceGRU::onResize(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
-    auto input                 = inputs[0];
-    const int inputLastDimSize = input->length(2);
-    mHiddenState.reset(Tensor::createDevice<float>(std::vector<int>{1, mNumUnits}));
-    mInputAndState.reset(Tensor::createDevice<float>(std::vector<int>{1, inputLastDimSize + mNumUnits}));
-    mGate.reset(Tensor::createDevice<float>(std::vector<int>{1, 2 * mNumUnits}));
-
-    backend()->onAcquireBuffer(mHiddenState.get(), Backend::DYNAMIC);
-    backend()->onAcquireBuffer(mInputAndState.get(), Backend::DYNAMIC);
-    backend()->onAcquireBuffer(mGate.get(), Backend::DYNAMIC);
-
-    backend()->onReleaseBuffer(mHiddenState.get(), Backend::DYNAMIC);
-    backend()->onReleaseBuffer(mInputAndState.get(), Backend::DYNAMIC);
-    backend()->onReleaseBuffer(mGate.get(), Backend::DYNAMIC);
-
+    auto input    = inputs[0];
+    mBatch        = input->length(0);
+    mSequence     = input->length(1);
+    mInputSize    = input->length(2);
+    mThreadNumber = static_cast<CPUBackend*>(backend())->threadNumber();
+    MNN_ASSERT(mInputSize == mDirections[0].input->l());
+
+    const int directions = (int)mDirections.size();
+    const int total      = mBatch * mSequence;
+    int matmulCache      = 0;
+    for (auto& d : mDirections) {
+        matmulCache = std::max(matmulCache, d.input->cacheSize());
+        matmulCache = std::max(matmulCache, d.gate->cacheSize());
+        matmulCache = std::max(matmulCache, d.candidate->cacheSize());
+    }
+    // hidden state, (r, z), r * h and candidate of all batches for a direction
+    mCacheSize = matmulCache + 5 * mNumUnitsPad * mBatch;
+    mInputC4.reset(Tensor::createDevice<float>({UP_DIV(mInputSize, 4), total, 4}));
+    mProjection.reset(Tensor::createDevice<float>({directions, 3 * mNumUnitsPad / 4, total, 4}));
+    mCache.reset(Tensor::createDevice<float>({std::max(mThreadNumber, directions), mCacheSize}));
+    auto res = backend()->onAcquireBuffer(mInputC4.get(), Backend::DYNAMIC) &&
+               backend()->onAcquireBuffer(mProjection.get(), Backend::DYNAMIC) &&
+               backend()->onAcquireBuffer(mCache.get(), Backend::DYNAMIC);
+    if (!res) {
+        return OUT_OF_MEMORY;
+    }
+    backend()->onReleaseBuffer(mInputC4.get(), Backend::DYNAMIC);
+    backend()->onReleaseBuffer(mProjection.get(), Backend::DYNAMIC);
+    backend()->onReleaseBuffer(mCache.get(), Backend::DYNAMIC);
     return NO_ERROR;
 }
 
-ErrorCode CPURNNSequenceGRU::onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
-    // firstly set the hidden state to zero
-    float* const hiddenStatePtr   = mHiddenState->host<float>();
-    const int hiddenStateDataSize = mHiddenState->size();
-    ::memset(hiddenStatePtr, 0, hiddenStateDataSize);
-
-    auto input                    = inputs[0];
-    auto output                   = outputs[0];
-    float* const inputPtr         = input->host<float>();
-    float* const outputPtr        = output->host<float>();
-    const int batchSize           = input->length(0);
-    const int batchStride         = input->stride(0);
-    const int inputSequenceLength = input->length(1);
-    const int inputCodeLength     = input->length(2);
+// Copy the first units of a row of all batches in C4 to output[b * stride]
+static void _unpackRows(float* output, int stride, const float* srcC4, int units, int batch) {
+    for (int b = 0; b < batch; ++b) {
+        auto dst = output + b * stride;
+        int z    = 0;
+        for (; z < units / 4; ++z) {
+            Vec4::save(dst + 4 * z, Vec4::load(srcC4 + (z * batch + b) * 4));
+        }
+        for (int i = 4 * z; i < units; ++i) {
+            dst[i] = srcC4[(z * batch + b) * 4 + i - 4 * z];
+        }
+    }
+}
 
-    for (int b = 0; b < batchSize; ++b) {
-        for (int i = 0; i < inputSequenceLength; ++i) {
-            const int inputOffset = b * batchStride + i * inputCodeLength;
-            runRNNStep(inputPtr + inputOffset, inputCodeLength, mHiddenState, mNumUnits, mFwGateWeight, mFwGateBias,
-                       mFwCandidateWeight, mFwCandidateBias, mInputAndState, mGate);
-            if (mKeepAllOutputs) {
-                ::memcpy(outputPtr + b * output->stride(0) + i * mNumUnits, hiddenStatePtr, hiddenStateDataSize);
+void CPURNNSequenceGRU::runDirection(int direction, float* cache, float* output, int outputStride0,
+                                     int outputStride1) {
+    auto& weights        = mDirections[direction];
+    const int batch      = mBatch;
+    const int sequence   = mSequence;
+    const int total      = batch * sequence;
+    const int unitC4     = mNumUnitsPad / 4;
+    auto hidden          = cache;
+    auto gate            = hidden + mNumUnitsPad * batch;
+    auto resetHidden     = gate + 2 * mNumUnitsPad * batch;
+    auto candidate       = resetHidden + mNumUnitsPad * batch;
+    auto matmulCache     = candidate + mNumUnitsPad * batch;
+    auto projection      = mProjection->host<float>() + direction * 3 * mNumUnitsPad * total;
+    const bool backward  = direction > 0;
+    // The initial state is zero for every batch
+    ::memset(hidden, 0, mNumUnitsPad * batch * sizeof(float));
+    for (int step = 0; step < sequence; ++step) {
+        const int t = backward ? sequence - 1 - step : step;
+        // (r, z) = sigmoid(x * Wx + b + h * Wh)
+        weights.gate->compute(gate, hidden, 0, batch, batch, matmulCache);
+        for (int z = 0; z < 2 * unitC4; ++z) {
+            for (int b = 0; b < batch; ++b) {
+                auto dst = gate + (z * batch + b) * 4;
+                Vec4::save(dst, Vec4::load(dst) + Vec4::load(projection + (z * total + b * sequence + t) * 4));
+            }
+        }
+        MNNSigmoid(gate, gate, 2 * mNumUnitsPad * batch);
+        for (int i = 0; i < unitC4 * batch; ++i) {
+            Vec4::save(resetHidden + 4 * i, Vec4::load(gate + 4 * i) * Vec4::load(hidden + 4 * i));
+        }
+        // candidate = tanh(x * Wx + b + (r * h) * Wh)
+        weights.candidate->compute(candidate, resetHidden, 0, batch, batch, matmulCache);
+        for (int z = 0; z < unitC4; ++z) {
+            for (int b = 0; b < batch; ++b) {
+                auto dst = candidate + (z * batch + b) * 4;
+                Vec4::save(dst, Vec4::load(dst) +
+                                    Vec4::load(projection + ((2 * unitC4 + z) * total + b * sequence + t) * 4));
             }
         }
+        MNNTanh(candidate, candidate, mNumUnitsPad * batch);
+        // h = z * h + (1 - z) * candidate
+        auto update = gate + unitC4 * batch * 4;
+        for (int i = 0; i < unitC4 * batch; ++i) {
+            auto u = Vec4::load(update + 4 * i);
+            auto h = Vec4::load(hidden + 4 * i);
+            auto c = Vec4::load(candidate + 4 * i);
+            Vec4::save(hidden + 4 * i, c + u * (h - c));
+        }
+        if (mKeepAllOutputs) {
+            _unpackRows(output + step * outputStride1, outputStride0, hidden, mNumUnits, batch);
+        }
     }
-
     if (!mKeepAllOutputs) {
-        ::memcpy(outputPtr, hiddenStatePtr, hiddenStateDataSize);
+        _unpackRows(output, outputStride0, hidden, mNumUnits, batch);
     }
-    // backward rnn
-    if (mIsBidirectionalRNN) {
-        ::memset(hiddenStatePtr, 0, hiddenStateDataSize);
-        auto outputBw            = outputs[1];
-        float* const outputBwPtr = outputBw->host<float>();
-        for (int b = 0; b < batchSize; ++b) {
-            for (int i = inputSequenceLength - 1; i >= 0; i--) {
-                const int inputOffset = b * batchStride + i * inputCodeLength;
-                runRNNStep(inputPtr + inputOffset, inputCodeLength, mHiddenState, mNumUnits, mBwGateWeight, mBwGateBias,
-                           mBwCandidateWeight, mBwCandidateBias, mInputAndState, mGate);
-                if (mKeepAllOutputs) {
-                    ::memcpy(outputBwPtr + b * outputBw->stride(0) + (inputSequenceLength - 1 - i) * mNumUnits,
-                             hiddenStatePtr, hiddenStateDataSize);
-                }
-            }
-        }
+}
 
-        if (!mKeepAllOutputs) {
-            ::memcpy(outputBwPtr, hiddenStatePtr, hiddenStateDataSize);
+ErrorCode CPURNNSequenceGRU::onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
+    auto input           = inputs[0];
+    const int total      = mBatch * mSequence;
+    const int directions = (int)mDirections.size();
+    auto inputC4         = mInputC4->host<float>();
+    auto cache           = mCache->host<float>();
+    // The rows of the GEMM are b * sequence + t, as the input
+    MNNUnpackTranspose(inputC4, input->host<float>(), total, mInputSize);
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    const int tiles = UP_DIV(total, eP);
+    const int tasks = tiles * directions;
+    MNN_CONCURRENCY_BEGIN(tId, mThreadNumber) {
+        for (int task = (int)tId; task < tasks; task += mThreadNumber) {
+            const int d     = task / tiles;
+            const int x     = (task % tiles) * eP;
+            auto projection = mProjection->host<float>() + d * 3 * mNumUnitsPad * total;
+            mDirections[d].input->compute(projection, inputC4, x, std::min(eP, total - x), total,
+                                          cache + tId * mCacheSize);
         }
     }
+    MNN_CONCURRENCY_END();
 
+    // The directions are independent after the input projection
+    MNN_CONCURRENCY_BEGIN(tId, directions) {
+        auto output             = outputs[tId];
+        const int outputStride1 = mKeepAllOutputs ? mNumUnits : 0;
+        runDirection((int)tId, cache + tId * mCacheSize, output->host<float>(), output->stride(0), outputStride1);
+    }
+    MNN_CONCURRENCY_END();
     return NO_ERROR;
 }
 
@@ -10,6 +10,7 @@
 #define CPURNNSequenceGRU_hpp
 
 #include "core/Execution.hpp"
+#include "backend/cpu/compute/RNNFunction.hpp"
 
 namespace MNN {
 
@@ -21,23 +22,32 @@ public:
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
 
 private:
+    // Weights of a direction packed for RNNMatMul, each gate is padded to mNumUnitsPad units
+    struct Direction {
+        // [x, 1] -> (r, z, candidate) of all time steps
+        std::shared_ptr<RNNMatMul> input;
+        // h -> (r, z)
+        std::shared_ptr<RNNMatMul> gate;
+        // r * h -> candidate
+        std::shared_ptr<RNNMatMul> candidate;
+    };
+    void runDirection(int direction, float* cache, float* output, int outputStride0, int outputStride1);
+
     bool mKeepAllOutputs;
     bool mIsBidirectionalRNN;
     int mNumUnits;
-
-    std::shared_ptr<Tensor> mHiddenState;
-    std::shared_ptr<Tensor> mInputAndState;
-    std::shared_ptr<Tensor> mGate;
-    // forward weight and bias
-    std::shared_ptr<Tensor> mFwGateWeight;
-    std::shared_ptr<Tensor> mFwGateBias;
-    std::shared_ptr<Tensor> mFwCandidateWeight;
-    std::shared_ptr<Tensor> mFwCandidateBias;
-    // backward weight and bias
-    std::shared_ptr<Tensor> mBwGateWeight;
-    std::shared_ptr<Tensor> mBwGateBias;
-    std::shared_ptr<Tensor> mBwCandidateWeight;
-    std::shared_ptr<Tensor> mBwCandidateBias;
+    int mNumUnitsPad;
+    int mBatch;
+    int mSequence;
+    int mInputSize;
+    int mThreadNumber;
+
+    std::vector<Direction> mDirections;
+    // Input in C4, input projection of the directions and the caches of threads
+    std::shared_ptr<Tensor> mInputC4;
+    std::shared_ptr<Tensor> mProjection;
+    std::shared_ptr<Tensor> mCache;
+    int mCacheSize;
 };
 
 } // namespace MNN
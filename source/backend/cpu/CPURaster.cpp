@@ -336,45 +336,44 @@ void CPURaster::executeFaster(const std::vector<Tensor *> &inputs, const std::ve
             break;
     }
     auto byteC4 = bytes * 4;
-    MNN_CONCURRENCY_BEGIN(tId, threadNum) {
-        for (int u=(int)tId; u<mFastBlit.size(); u+=threadNum) {
-            auto& iter = mFastBlit[u];
-            auto& slice = iter.second;
-            //Offset use byte
-            auto srcPtr = (uint8_t*)iter.first + slice.src.offset * bytes;
-            auto dstPtr = (uint8_t*)mOutputPtr + slice.dst.offset * bytes;
-            if (slice.src.stride[1] == slice.size[2] && slice.dst.stride[1] == slice.size[2] && slice.src.stride[2] == 1) {
-                for (int z=0; z<slice.size[0]; ++z) {
-                    auto srcZ = srcPtr + z * slice.src.stride[0] * byteC4;
-                    auto dstZ = dstPtr + z * slice.dst.stride[0] * byteC4;
-                    ::memcpy(dstZ, srcZ, slice.size[1] * slice.src.stride[1] * byteC4);
-                }
-                continue;
-            }
-            if (1 == slice.src.stride[2] && 1 == slice.dst.stride[2]) {
-                for (int z=0; z<slice.size[0]; ++z) {
-                    auto srcZ = srcPtr + z * slice.src.stride[0] * byteC4;
-                    auto dstZ = dstPtr + z * slice.dst.stride[0] * byteC4;
-                    for (int y=0; y<slice.size[1]; ++y) {
-                        auto srcY = srcZ + y * slice.src.stride[1] * byteC4;
-                        auto dstY = dstZ + y * slice.dst.stride[1] * byteC4;
-                        ::memcpy(dstY, srcY, slice.size[2] * byteC4);
-                    }
-                }
-                continue;
+    // The sizes of regions differ a lot, schedule them dynamically
+    MNN_CONCURRENCY_DYNAMIC_BEGIN(tId, u, (int)mFastBlit.size(), threadNum, 1) {
+        auto& iter = mFastBlit[u];
+        auto& slice = iter.second;
+        //Offset use byte
+        auto srcPtr = (uint8_t*)iter.first + slice.src.offset * bytes;
+        auto dstPtr = (uint8_t*)mOutputPtr + slice.dst.offset * bytes;
+        if (slice.src.stride[1] == slice.size[2] && slice.dst.stride[1] == slice.size[2] && slice.src.stride[2] == 1) {
+            for (int z=0; z<slice.size[0]; ++z) {
+                auto srcZ = srcPtr + z * slice.src.stride[0] * byteC4;
+                auto dstZ = dstPtr + z * slice.dst.stride[0] * byteC4;
+                ::memcpy(dstZ, srcZ, slice.size[1] * slice.src.stride[1] * byteC4);
             }
+            continue;
+        }
+        if (1 == slice.src.stride[2] && 1 == slice.dst.stride[2]) {
             for (int z=0; z<slice.size[0]; ++z) {
                 auto srcZ = srcPtr + z * slice.src.stride[0] * byteC4;
                 auto dstZ = dstPtr + z * slice.dst.stride[0] * byteC4;
                 for (int y=0; y<slice.size[1]; ++y) {
                     auto srcY = srcZ + y * slice.src.stride[1] * byteC4;
                     auto dstY = dstZ + y * slice.dst.stride[1] * byteC4;
-                    C4proc(dstY, srcY, slice.size[2], slice.src.stride[2], slice.dst.stride[2]);
+                    ::memcpy(dstY, srcY, slice.size[2] * byteC4);
                 }
             }
+            continue;
+        }
+        for (int z=0; z<slice.size[0]; ++z) {
+            auto srcZ = srcPtr + z * slice.src.stride[0] * byteC4;
+            auto dstZ = dstPtr + z * slice.dst.stride[0] * byteC4;
+            for (int y=0; y<slice.size[1]; ++y) {
+                auto srcY = srcZ + y * slice.src.stride[1] * byteC4;
+                auto dstY = dstZ + y * slice.dst.stride[1] * byteC4;
+                C4proc(dstY, srcY, slice.size[2], slice.src.stride[2], slice.dst.stride[2]);
+            }
         }
     }
-    MNN_CONCURRENCY_END();
+    MNN_CONCURRENCY_DYNAMIC_END();
 }
 
 ErrorCode CPURaster::onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
@@ -446,48 +445,46 @@ ErrorCode CPURaster::onExecute(const std::vector<Tensor *> &inputs, const std::v
             MNN_ASSERT(false);
             break;
     }
-    MNN_CONCURRENCY_BEGIN(tId, threadNum) {
-        for (int u=tId; u<mTempInputCopy.size(); u+=threadNum) {
-            auto& iter = mTempInputCopy[u];
-            auto& slice = *(iter.second);
-            auto srcPtr = (uint8_t*)iter.first + slice.src.offset * bytes;
-            auto dstPtr = (uint8_t*)mOutputPtr + slice.dst.offset * bytes;
-            if (slice.src.stride[1] == slice.size[2] && slice.dst.stride[1] == slice.size[2] && slice.src.stride[2] == 1) {
-                for (int z=0; z<slice.size[0]; ++z) {
-                    auto srcZ = srcPtr + z * slice.src.stride[0] * bytes;
-                    auto dstZ = dstPtr + z * slice.dst.stride[0] * bytes;
-                    ::memcpy(dstZ, srcZ, slice.size[1] * slice.src.stride[1] * bytes);
-                }
-                continue;
-            }
-            if (_transpose(slice) && 4 == bytes) {
-                _transpose4Bit((int32_t*)dstPtr, (const int32_t*)srcPtr, slice);
-                continue;
-            }
-            if (1 == slice.src.stride[2] && 1 == slice.dst.stride[2]) {
-                for (int z=0; z<slice.size[0]; ++z) {
-                    auto srcZ = srcPtr + z * slice.src.stride[0] * bytes;
-                    auto dstZ = dstPtr + z * slice.dst.stride[0] * bytes;
-                    for (int y=0; y<slice.size[1]; ++y) {
-                        auto srcY = srcZ + y * slice.src.stride[1] * bytes;
-                        auto dstY = dstZ + y * slice.dst.stride[1] * bytes;
-                        ::memcpy(dstY, srcY, slice.size[2] * bytes);
-                    }
-                }
-                continue;
+    MNN_CONCURRENCY_DYNAMIC_BEGIN(tId, u, (int)mTempInputCopy.size(), threadNum, 1) {
+        auto& iter = mTempInputCopy[u];
+        auto& slice = *(iter.second);
+        auto srcPtr = (uint8_t*)iter.first + slice.src.offset * bytes;
+        auto dstPtr = (uint8_t*)mOutputPtr + slice.dst.offset * bytes;
+        if (slice.src.stride[1] == slice.size[2] && slice.dst.stride[1] == slice.size[2] && slice.src.stride[2] == 1) {
+            for (int z=0; z<slice.size[0]; ++z) {
+                auto srcZ = srcPtr + z * slice.src.stride[0] * bytes;
+                auto dstZ = dstPtr + z * slice.dst.stride[0] * bytes;
+                ::memcpy(dstZ, srcZ, slice.size[1] * slice.src.stride[1] * bytes);
             }
+            continue;
+        }
+        if (_transpose(slice) && 4 == bytes) {
+            _transpose4Bit((int32_t*)dstPtr, (const int32_t*)srcPtr, slice);
+            continue;
+        }
+        if (1 == slice.src.stride[2] && 1 == slice.dst.stride[2]) {
             for (int z=0; z<slice.size[0]; ++z) {
                 auto srcZ = srcPtr + z * slice.src.stride[0] * bytes;
-                auto dstZ = dstPtr + (z) * slice.dst.stride[0] * bytes;
+                auto dstZ = dstPtr + z * slice.dst.stride[0] * bytes;
                 for (int y=0; y<slice.size[1]; ++y) {
                     auto srcY = srcZ + y * slice.src.stride[1] * bytes;
                     auto dstY = dstZ + y * slice.dst.stride[1] * bytes;
-                    proc(dstY, srcY, slice.size[2], slice.src.stride[2], slice.dst.stride[2]);
+                    ::memcpy(dstY, srcY, slice.size[2] * bytes);
                 }
             }
+            continue;
+        }
+        for (int z=0; z<slice.size[0]; ++z) {
+            auto srcZ = srcPtr + z * slice.src.stride[0] * bytes;
+            auto dstZ = dstPtr + (z) * slice.dst.stride[0] * bytes;
+            for (int y=0; y<slice.size[1]; ++y) {
+                auto srcY = srcZ + y * slice.src.stride[1] * bytes;
+                auto dstY = dstZ + y * slice.dst.stride[1] * bytes;
+                proc(dstY, srcY, slice.size[2], slice.src.stride[2], slice.dst.stride[2]);
+            }
         }
     }
-    MNN_CONCURRENCY_END();
+    MNN_CONCURRENCY_DYNAMIC_END();
     if (nullptr != mTempOutput) {
         if (nullptr != mConverter) {
             mConverter->onExecute({mTempOutput.get()}, {output});
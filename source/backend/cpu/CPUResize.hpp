@@ -23,12 +23,17 @@ public:
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) = 0;
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs)  = 0;
 
-    void CPUResizeCubicC4(halide_buffer_t &input, halide_buffer_t &output, float wScale, float hScale, float wOffset, float hOffset);
+    // The output rows of each plane (a batch of 4 channels) are split into blocks for the threads.
+    // widthPosition / heightPosition are the clamped source positions for each output column / row, 4 for cubic and
+    // 2 for bilinear, the factors are the fractions between them.
+    void CPUResizeCubicC4(halide_buffer_t &input, halide_buffer_t &output, const int *widthPosition,
+                          const float *widthFactor, const int *heightPosition, const float *heightFactor,
+                          float *lineBuffer, int threadNumber);
     void CPUResizeBilinearC4(halide_buffer_t &input, halide_buffer_t &output, const int *widthPosition,
                              const float *widthFactor, const int *heightPosition, const float *heightFactor,
                              float *lineBuffer, int threadNumber);
-    void CPUResizeNearestneighborC4(halide_buffer_t &input, halide_buffer_t &output, float wScale, float hScale, float wOffset = 0.f, float hOffset = 0.f);
-    void CPUResizeNearestneighborRoundC4(halide_buffer_t &input, halide_buffer_t &output, float wScale, float hScale, float wOffset = 0.f, float hOffset = 0.f);
+    void CPUResizeNearestneighborC4(halide_buffer_t &input, halide_buffer_t &output, const int *widthPosition,
+                                    const int *heightPosition, int threadNumber);
 };
 
 } // namespace MNN
@@ -8,63 +8,145 @@
 
 #include "backend/cpu/CPUScatterNd.hpp"
 #include "backend/cpu/CPUBackend.hpp"
+#include "core/Concurrency.h"
+#include "core/Macro.h"
+#include "math/Vec.hpp"
+
+// Each thread adds at least so many elements
+#define MNN_SCATTER_THREAD_SIZE (16 * 1024)
 
 namespace MNN {
+using Vec4 = MNN::Math::Vec<float, 4>;
+
+
+// Slices of at least so many elements are split by columns, smaller ones by destination rows
+#define MNN_SCATTER_COLUMN_SPLIT 1024
+
+template <typename T>
+static inline void _addSlice(T* dst, const T* src, int size) {
+    for (int k = 0; k < size; ++k) {
+        dst[k] += src[k];
+    }
+}
+
+template <>
+inline void _addSlice<float>(float* dst, const float* src, int size) {
+    int sizeC4 = size / 4 * 4;
+    for (int k = 0; k < sizeC4; k += 4) {
+        Vec4::save(dst + k, Vec4::load(dst + k) + Vec4::load(src + k));
+    }
+    for (int k = sizeC4; k < size; ++k) {
+        dst[k] += src[k];
+    }
+}
 
 template <typename T>
-void ScatterNdImpl(const Tensor* indices, const Tensor* updates, const Tensor* shape, Tensor* output) {
+void CPUScatterNd::scatter(const Tensor* updates, Tensor* output, int accNumber) {
+    const auto updatesPtr = updates->host<T>();
+    auto outputPtr        = output->host<T>();
+    const int indexes     = (int)mPositions.size();
+    const int threadNumber = mThreadNumber;
+    if (1 == threadNumber) {
+        for (int i = 0; i < indexes; ++i) {
+            _addSlice(outputPtr + mPositions[i], updatesPtr + (size_t)i * accNumber, accNumber);
+        }
+        return;
+    }
+    // Slices are aligned to accNumber, so either split the columns of each slice or own whole destination slices.
+    // Either way one element is only written by one thread in the order of indices, the sums are deterministic.
+    if (accNumber >= MNN_SCATTER_COLUMN_SPLIT) {
+        MNN_CONCURRENCY_BEGIN(tId, threadNumber) {
+            int begin = (int)((int64_t)accNumber * tId / threadNumber);
+            int end   = (int)((int64_t)accNumber * (tId + 1) / threadNumber);
+            for (int i = 0; i < indexes; ++i) {
+                _addSlice(outputPtr + mPositions[i] + begin, updatesPtr + (size_t)i * accNumber + begin, end - begin);
+            }
+        }
+        MNN_CONCURRENCY_END();
+        return;
+    }
+    MNN_CONCURRENCY_BEGIN(tId, threadNumber) {
+        for (int j = mOwnerOffsets[tId]; j < mOwnerOffsets[tId + 1]; ++j) {
+            auto i = mOrder[j];
+            _addSlice(outputPtr + mPositions[i], updatesPtr + (size_t)i * accNumber, accNumber);
+        }
+    }
+    MNN_CONCURRENCY_END();
+}
+
+ErrorCode CPUScatterNd::onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
+    auto indices         = inputs[0];
+    auto updates         = inputs[1];
+    auto output          = outputs[0];
+    const int outputSize = output->size();
+
+    auto outputRawPtr = output->host<int8_t>();
+    memset(outputRawPtr, 0, outputSize);
+
+    auto updatesDataType = updates->getType();
+    if (updatesDataType != halide_type_of<int32_t>() && updatesDataType != halide_type_of<float>()) {
+        MNN_ERROR("TODO, ScatterNd support data type: %d\n", updatesDataType.code);
+        return NOT_SUPPORT;
+    }
+
     const auto indicesPtr      = indices->host<int32_t>();
-    const auto updatesPtr      = updates->host<T>();
-    auto outputPtr             = output->host<T>();
     const int indicesDimension = indices->dimensions();
     const int indicesLastDim   = indices->length(indicesDimension - 1);
-    const int indexes          = indices->elementSize() / indicesLastDim;
+    const int indexes          = indicesLastDim > 0 ? indices->elementSize() / indicesLastDim : 0;
     int accNumber              = 1;
     for (int i = indicesDimension - 1; i < updates->dimensions(); ++i) {
         accNumber *= updates->length(i);
     }
-
     const int outputElementSize = output->elementSize();
+    if (0 == indexes || 0 == accNumber) {
+        return NO_ERROR;
+    }
     int remainSize              = outputElementSize;
     std::vector<int> dimsToCount(indicesLastDim, 0);
     for (int i = 0; i < indicesLastDim; ++i) {
         dimsToCount[i] = remainSize / output->length(i);
         remainSize     = dimsToCount[i];
     }
-
+    mPositions.resize(indexes);
     for (int i = 0; i < indexes; ++i) {
         int pos = 0;
         for (int j = 0; j < indicesLastDim; ++j) {
             auto curIndex = indicesPtr[i * indicesLastDim + j];
-            MNN_ASSERT(curIndex >= 0 && curIndex < output->length(j));
+            if (curIndex < 0 || curIndex >= output->length(j)) {
+                return INPUT_DATA_ERROR;
+            }
             pos += curIndex * dimsToCount[j];
         }
-        for (int k = 0; k < accNumber; ++k) {
-            outputPtr[pos + k] += updatesPtr[i * accNumber + k];
-        }
+        mPositions[i] = pos;
     }
-}
 
-ErrorCode CPUScatterNd::onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
-    auto indices         = inputs[0];
-    auto updates         = inputs[1];
-    auto shape           = inputs[2];
-    auto output          = outputs[0];
-    const int outputSize = output->size();
-
-    auto outputRawPtr = output->host<int8_t>();
-    memset(outputRawPtr, 0, outputSize);
+    int threadNumber = static_cast<CPUBackend*>(backend())->threadNumber();
+    threadNumber     = (int)ALIMIN((int64_t)threadNumber, UP_DIV((int64_t)indexes * accNumber, MNN_SCATTER_THREAD_SIZE));
+    mThreadNumber    = ALIMAX(threadNumber, 1);
+    if (mThreadNumber > 1 && accNumber < MNN_SCATTER_COLUMN_SPLIT) {
+        // Stable counting sort of the indices by the thread owning the destination slice
+        const int slices = outputElementSize / accNumber;
+        mOwnerOffsets.assign(mThreadNumber + 1, 0);
+        mOwners.resize(indexes);
+        for (int i = 0; i < indexes; ++i) {
+            mOwners[i] = (int)((int64_t)(mPositions[i] / accNumber) * mThreadNumber / slices);
+            mOwnerOffsets[mOwners[i] + 1]++;
+        }
+        for (int t = 0; t < mThreadNumber; ++t) {
+            mOwnerOffsets[t + 1] += mOwnerOffsets[t];
+        }
+        std::vector<int> cursor(mOwnerOffsets.begin(), mOwnerOffsets.end() - 1);
+        mOrder.resize(indexes);
+        for (int i = 0; i < indexes; ++i) {
+            mOrder[cursor[mOwners[i]]++] = i;
+        }
+    }
 
-    auto updatesDataType = updates->getType();
     if (updatesDataType == halide_type_of<int32_t>()) {
-        ScatterNdImpl<int32_t>(indices, updates, shape, output);
-    } else if (updatesDataType == halide_type_of<float>()) {
-        ScatterNdImpl<float>(indices, updates, shape, output);
+        scatter<int32_t>(updates, output, accNumber);
     } else {
-        MNN_ERROR("TODO, ScatterNd support data type: %d\n", updatesDataType.code);
-        return NOT_SUPPORT;
+        scatter<float>(updates, output, accNumber);
     }
-
     return NO_ERROR;
 }
 
@@ -18,6 +18,18 @@ public:
     }
     virtual ~CPUScatterNd() = default;
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
+
+private:
+    template <typename T>
+    void scatter(const Tensor *updates, Tensor *output, int accNumber);
+
+    int mThreadNumber = 1;
+    // Offset in output of the slice of each index
+    std::vector<int> mPositions;
+    // Indices sorted by the thread owning their destination, thread t takes [mOwnerOffsets[t], mOwnerOffsets[t + 1])
+    std::vector<int> mOwners;
+    std::vector<int> mOrder;
+    std::vector<int> mOwnerOffsets;
 };
 
 } // namespace MNN
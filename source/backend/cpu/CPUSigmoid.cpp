@@ -9,6 +9,7 @@
 #include "backend/cpu/CPUSigmoid.hpp"
 #include <math.h>
 #include "backend/cpu/CPUBackend.hpp"
+#include "backend/cpu/CPUUnary.hpp"
 #include "backend/cpu/compute/CommonOptFunction.h"
 #include "core/Macro.h"
 
@@ -16,15 +17,7 @@ namespace MNN {
 ErrorCode CPUSigmoid::onExecute(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs) {
     MNN_ASSERT(1 == inputs.size());
     MNN_ASSERT(1 == outputs.size());
-    auto inputData  = inputs[0]->host<float>();
-    auto outputData = outputs[0]->host<float>();
-
-    const int dataSize = outputs[0]->elementSize();
-    MNNExp(outputData, inputData, dataSize);
-    for (int i = 0; i < dataSize; ++i) {
-        outputData[i] = 1.0f / (1.0f + outputData[i]);
-    }
-    return NO_ERROR;
+    return CPUUnary::callVectorFunction(MNNSigmoid, inputs[0], outputs[0], backend());
 }
 
 class CPUSigmoidCreator : public CPUBackend::Creator {
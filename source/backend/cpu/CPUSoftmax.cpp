@@ -60,7 +60,7 @@ int CPUSoftmax::_softmax1(const float *srcData, float *dstData, int outside, int
             }
 
             for (int c = 0; c < channel; ++c) {
-                dstY[c] = -srcY[c] + maxValue;
+                dstY[c] = srcY[c] - maxValue;
             }
         }
     }
@@ -78,7 +78,7 @@ int CPUSoftmax::_softmax1(const float *srcData, float *dstData, int outside, int
             realSize = channel * outside - start;
         }
         if (realSize > 0) {
-            MNNExp(dstData + start, dstData + start, realSize);
+            MNNVectorExp(dstData + start, dstData + start, realSize);
         }
     }
     MNN_CONCURRENCY_END();
@@ -139,7 +139,7 @@ int CPUSoftmax::_softmaxCommon(const float *srcData, float *dstData, int inside,
             float *dst = dstY;
             for (int c = 0; c < channel; ++c, src += inside, dst += inside) {
                 for (int x = 0; x < inside; ++x) {
-                    dst[x] = -src[x] + maxValueSub[x];
+                    dst[x] = src[x] - maxValueSub[x];
                 }
             }
         }
@@ -159,7 +159,7 @@ int CPUSoftmax::_softmaxCommon(const float *srcData, float *dstData, int inside,
             realSize = totalSize - start;
         }
         if (realSize > 0) {
-            MNNExp(dstData + start, dstData + start, realSize);
+            MNNVectorExp(dstData + start, dstData + start, realSize);
         }
     }
     MNN_CONCURRENCY_END();
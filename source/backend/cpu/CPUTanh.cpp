@@ -10,6 +10,7 @@
 #include <math.h>
 #include "backend/cpu/compute/CommonOptFunction.h"
 #include "backend/cpu/CPUBackend.hpp"
+#include "backend/cpu/CPUUnary.hpp"
 #include "core/Macro.h"
 
 namespace MNN {
@@ -17,11 +18,6 @@ namespace MNN {
 ErrorCode CPUTanh::onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
     MNN_ASSERT(1 == inputs.size());
     MNN_ASSERT(1 == outputs.size());
-    auto inputData  = inputs[0]->host<float>();
-    auto outputData = outputs[0]->host<float>();
-
-    const int dataSize = outputs[0]->elementSize();
-    MNNTanh(outputData, inputData, dataSize);
-    return NO_ERROR;
+    return CPUUnary::callVectorFunction(MNNTanh, inputs[0], outputs[0], backend());
 }
 } // namespace MNN
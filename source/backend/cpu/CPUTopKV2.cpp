@@ -10,81 +10,51 @@
 #include "backend/cpu/CPUBackend.hpp"
 #include "core/Macro.h"
 #include "core/Concurrency.h"
-#include "backend/cpu/compute/CommonOptFunction.h"
+#include "backend/cpu/compute/TopK.hpp"
+
+// Each part of a split row has at least so many elements
+#define MNN_TOPK_PART_SIZE (16 * 1024)
 
 namespace MNN {
 
 template <typename T>
-class TopContainer {
-public:
-    TopContainer() = delete;
-    TopContainer(int32_t k, int32_t rowSize) : mK(k) {
-        mContainer.reserve(std::min(k, rowSize) + 1);
-    }
-
-    void startCollecting(const T* values) {
-        mValues = values;
-        mContainer.clear();
-    }
-    void push(int32_t a) {
-        auto comparator = [this](int32_t a, int32_t b) { return compareFunc(a, b); };
-        if (mContainer.size() <= mK) {
-            mContainer.push_back(a);
-            if (mContainer.size() == mK + 1) {
-                std::make_heap(mContainer.begin(), mContainer.end(), comparator);
-                std::pop_heap(mContainer.begin(), mContainer.end(), comparator);
-            }
-        } else if (comparator(a, mContainer.front())) {
-            mContainer.back() = a;
-            std::push_heap(mContainer.begin(), mContainer.end(), comparator);
-            std::pop_heap(mContainer.begin(), mContainer.end(), comparator);
-        }
-    }
-
-    const std::vector<int32_t>& sortedResult() {
-        auto comparator = [this](int32_t a, int32_t b) { return compareFunc(a, b); };
-        if (mContainer.size() <= mK) {
-            std::sort(mContainer.begin(), mContainer.end(), comparator);
-        } else {
-            std::sort_heap(mContainer.begin(), mContainer.end() - 1, comparator);
-            mContainer.resize(mK);
+static void _findTopK(int32_t rowSize, int32_t numRows, const T* data, int32_t k, int32_t* outputIndexes,
+                      T* outputValues, Backend* bn) {
+    auto backend     = [bn]() { return bn; };
+    int threadNumber = static_cast<CPUBackend*>(bn)->threadNumber();
+    auto writeRow    = [=](int row, const std::vector<TopKElement<T>>& topK) {
+        for (int i = 0; i < topK.size(); ++i) {
+            outputValues[(size_t)row * k + i]  = topK[i].first;
+            outputIndexes[(size_t)row * k + i] = topK[i].second;
         }
-        return mContainer;
-    }
-
-private:
-    int32_t mK;
-    std::vector<int32_t> mContainer;
-    const T* mValues = nullptr;
-
-    bool compareFunc(int32_t a, int32_t b) const {
-        if (mValues[b] < mValues[a]) {
-            return true;
-        } else if (mValues[b] > mValues[a]) {
-            return false;
-        } else {
-            return a < b;
+    };
+    const int parts = std::min(threadNumber, rowSize / MNN_TOPK_PART_SIZE);
+    if (numRows < threadNumber && parts > 1) {
+        // Too few rows for the threads, split each row and merge the top k of the parts
+        std::vector<std::vector<TopKElement<T>>> partTopK(parts);
+        std::vector<TopKElement<T>> topK;
+        for (int row = 0; row < numRows; ++row) {
+            const T* valuesRow = data + (size_t)row * rowSize;
+            MNN_CONCURRENCY_BEGIN(tId, parts) {
+                int begin = (int)((int64_t)rowSize * tId / parts);
+                int end   = (int)((int64_t)rowSize * (tId + 1) / parts);
+                TopKSelect(valuesRow, begin, end, k, partTopK[tId]);
+            }
+            MNN_CONCURRENCY_END();
+            TopKMerge(partTopK, k, topK);
+            writeRow(row, topK);
         }
+        return;
     }
-};
-
-template <typename T>
-void findTopK(int32_t rowSize, int32_t numRows, const T* data, int32_t k, int32_t* outputIndexes, T* outputValues) {
-    TopContainer<T> topc(k, rowSize);
-    for (int row = 0; row < numRows; row++) {
-        const T* valuesRow = data + row * rowSize;
-        topc.startCollecting(valuesRow);
-        for (int c = 0; c < rowSize; c++) {
-            topc.push(c);
+    threadNumber = std::max(std::min(threadNumber, numRows), 1);
+    std::vector<std::vector<TopKElement<T>>> topK(threadNumber);
+    MNN_CONCURRENCY_BEGIN(tId, threadNumber) {
+        for (int row = (int)tId; row < numRows; row += threadNumber) {
+            TopKSelect(data + (size_t)row * rowSize, 0, rowSize, k, topK[tId]);
+            writeRow(row, topK[tId]);
         }
-
-        int32_t* indexesRow = outputIndexes + row * k;
-        T* ouputRow         = outputValues + row * k;
-
-        const auto& topK = topc.sortedResult();
-        std::copy(topK.begin(), topK.end(), indexesRow);
-        std::transform(topK.begin(), topK.end(), ouputRow, [valuesRow](const int32_t loc) { return valuesRow[loc]; });
     }
+    MNN_CONCURRENCY_END();
 }
 
 CPUTopKV2::CPUTopKV2(Backend* b) : MNN::Execution(b) {
@@ -100,73 +70,22 @@ ErrorCode CPUTopKV2::onExecute(const std::vector<Tensor*>& inputs, const std::ve
     const int inputDimension = inputTensor->buffer().dimensions;
 
     const int rowSize = inputTensor->buffer().dim[inputDimension - 1].extent;
-    const int rowC4Blocks = rowSize / 4;
-    const int rowRemain = rowSize % 4;
-    const int rowC4ElementSize = rowC4Blocks * 4;
     MNN_ASSERT(k <= rowSize);
     const int numRows = inputTensor->elementSize() / rowSize;
 
-    if (k == 1) {
-        if (halide_type_float == inputTensor->getType().code) {
-            float* inputData   = inputTensor->host<float>();
-            float* topkData    = outputData->host<float>();
-            int32_t* indicesData = outputIndices->host<int32_t>();
-
-            MNN_CONCURRENCY_BEGIN(i, numRows) {
-                float* inputRowData = inputData + i * rowSize;
-                float* rowTopkData = topkData + i * k;
-                int32_t* rowTopkIndexData = indicesData + i * k;
-                MNNVectorTop1Float(inputRowData, rowTopkData, rowTopkIndexData, rowC4Blocks);
-                for (int j = 0; j < rowRemain; j++) {
-                    int index = rowC4ElementSize + j;
-                    float value = inputRowData[index];
-                    if (value > rowTopkData[0]) {
-                        rowTopkData[0] = value;
-                        rowTopkIndexData[0] = index;
-                    }
-                }
-            }
-            MNN_CONCURRENCY_END();
-        } else if (halide_type_int == inputTensor->getType().code && 32 == inputTensor->getType().bits) {
-            int32_t* inputData   = inputTensor->host<int32_t>();
-            int32_t* topkData    = outputData->host<int32_t>();
-            int32_t* indicesData = outputIndices->host<int32_t>();
-            MNN_CONCURRENCY_BEGIN(i, numRows) {
-                int32_t* inputRowData = inputData + i * rowSize;
-                int32_t* rowTopkData = topkData + i * k;
-                int32_t* rowTopkIndexData = indicesData + i * k;
-                MNNVectorTop1Int32(inputRowData, rowTopkData, rowTopkIndexData, rowC4Blocks);
-                for (int j = 0; j < rowRemain; j++) {
-                    int index = rowC4ElementSize + j;
-                    int32_t value = inputRowData[index];
-                    if (value > rowTopkData[0]) {
-                        rowTopkData[0] = value;
-                        rowTopkIndexData[0] = index;
-                    }
-                }
-            }
-            MNN_CONCURRENCY_END();
-        } else {
-            MNN_PRINT("TopKV2 data type not supported\n");
-            MNN_ASSERT(false);
-        }
-
-        return NO_ERROR;
-    }
-
     if (halide_type_float == inputTensor->getType().code) {
         auto inputData   = inputTensor->host<float>();
         auto topkData    = outputData->host<float>();
         int* indicesData = outputIndices->host<int32_t>();
-        findTopK<float>(rowSize, numRows, inputData, k, indicesData, topkData);
+        _findTopK<float>(rowSize, numRows, inputData, k, indicesData, topkData, backend());
     } else if(halide_type_int == inputTensor->getType().code && 32 == inputTensor->getType().bits) {
         auto inputData   = inputTensor->host<int32_t>();
         auto topkData    = outputData->host<int32_t>();
         int* indicesData = outputIndices->host<int32_t>();
-        findTopK<int32_t>(rowSize, numRows, inputData, k, indicesData, topkData);
+        _findTopK<int32_t>(rowSize, numRows, inputData, k, indicesData, topkData, backend());
     } else {
-        MNN_PRINT("TODO\n");
-        MNN_ASSERT(false);
+        MNN_PRINT("TopKV2 data type not supported\n");
+        return NOT_SUPPORT;
     }
     return NO_ERROR;
 }
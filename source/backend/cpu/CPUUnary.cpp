@@ -30,6 +30,29 @@ ErrorCode CPUUnary::onResize(const std::vector<Tensor *> &inputs, const std::vec
     return NO_ERROR;
 }
 
+ErrorCode CPUUnary::callVectorFunction(void (*proc)(float *dst, const float *src, size_t size), const Tensor *input,
+                                       Tensor *output, Backend *bn) {
+    auto backend = [bn]() {
+        return bn;
+    };
+    auto size      = input->elementSize();
+    auto schedule  = ((CPUBackend*)bn)->multiThreadDivide(size);
+    auto inputPtr  = input->host<float>();
+    auto outputPtr = output->host<float>();
+    MNN_CONCURRENCY_BEGIN(tId, schedule.second) {
+        int start    = schedule.first * (int)tId;
+        int realSize = schedule.first;
+        if (tId == schedule.second - 1) {
+            realSize = size - start;
+        }
+        if (realSize > 0) {
+            proc(outputPtr + start, inputPtr + start, realSize);
+        }
+    }
+    MNN_CONCURRENCY_END();
+    return NO_ERROR;
+}
+
 template <typename Func, typename T>
 static ErrorCode _unaryOp(void* inputPtr, void* outputPtr, int elementSize, Backend* bn) {
     Func f;
@@ -76,13 +99,6 @@ struct UnaryNeg {
     }
 };
 
-template <typename T>
-struct UnaryExp : std::unary_function<T, T> {
-    T operator()(const T &x) const {
-        return exp(x);
-    }
-};
-
 template <typename T>
 struct UnaryAbs : std::unary_function<T, T> {
     T operator()(const T &x) const {
@@ -109,12 +125,6 @@ struct UnaryLog1p : std::unary_function<T, T> {
     }
 };
 template <typename T>
-struct UnaryLog : std::unary_function<T, T> {
-    T operator()(const T &x) const {
-        return (T)log((T)(x));
-    }
-};
-template <typename T>
 struct UnaryCos : std::unary_function<T, T> {
     T operator()(const T &x) const {
         return (T)cosf((T)(x));
@@ -268,17 +278,6 @@ T erfcImpl(T x) {
     }
 }
 
-template <typename T>
-struct UnaryErf : std::unary_function<T, T> {
-    T operator()(const T &x) const {
-        if (abs(x) < T(1.)) {
-            return erfImpl(x);
-        } else {
-            return T(1.) - erfcImpl(x);
-        }
-    }
-};
-
 template <typename T>
 struct UnaryErfc : std::unary_function<T, T> {
     T operator()(const T &x) const {
@@ -424,7 +423,7 @@ ErrorCode CPUUnary::onExecute(const std::vector<Tensor *> &inputs, const std::ve
             return NO_ERROR;
         }
         case UnaryOpOperation_EXP:
-            return _unaryOp<UnaryExp<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
+            return callVectorFunction(MNNVectorExp, input, output, backend());
         case UnaryOpOperation_COS:
             return _unaryOp<UnaryCos<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
         case UnaryOpOperation_SIN:
@@ -442,7 +441,7 @@ ErrorCode CPUUnary::onExecute(const std::vector<Tensor *> &inputs, const std::ve
         case UnaryOpOperation_LOG1P:
             return _unaryOp<UnaryLog1p<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
         case UnaryOpOperation_LOG:
-            return _unaryOp<UnaryLog<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
+            return callVectorFunction(MNNVectorLog, input, output, backend());
         case UnaryOpOperation_FLOOR:
             return _unaryOp<UnaryFloor<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
         case UnaryOpOperation_BNLL:
@@ -462,7 +461,7 @@ ErrorCode CPUUnary::onExecute(const std::vector<Tensor *> &inputs, const std::ve
         case UnaryOpOperation_COSH:
             return _unaryOp<UnaryCosh<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
         case UnaryOpOperation_ERF:
-            return _unaryOp<UnaryErf<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
+            return callVectorFunction(MNNVectorErf, input, output, backend());
         case UnaryOpOperation_ERFC:
             return _unaryOp<UnaryErfc<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
         case UnaryOpOperation_ERFINV:
@@ -473,6 +472,12 @@ ErrorCode CPUUnary::onExecute(const std::vector<Tensor *> &inputs, const std::ve
             return _unaryOp<UnaryAsin<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
         case UnaryOpOperation_ACOS:
             return _unaryOp<UnaryAcos<float>, float>(input->host<void>(), output->host<void>(), input->elementSize(), backend());
+        case UnaryOpOperation_GELU:
+            return callVectorFunction(MNNGeluTanh, input, output, backend());
+        case UnaryOpOperation_GELU_STANDARD:
+            return callVectorFunction(MNNGelu, input, output, backend());
+        case UnaryOpOperation_SILU:
+            return callVectorFunction(MNNSiLU, input, output, backend());
         default:
             MNN_ASSERT(false);
             break;
@@ -20,6 +20,10 @@ public:
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
 
+    // Split the elements of float tensors by the threads of backend and call proc, such as MNNSigmoid
+    static ErrorCode callVectorFunction(void (*proc)(float *dst, const float *src, size_t size), const Tensor *input,
+                                        Tensor *output, Backend *bn);
+
 protected:
     UnaryOpOperation mType;
 };
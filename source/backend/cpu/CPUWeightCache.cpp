@@ -0,0 +1,215 @@
+//
+//  CPUWeightCache.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/CPUWeightCache.hpp"
+#include <string.h>
+#include "backend/cpu/compute/CommonOptFunction.h"
+#include "core/Macro.h"
+#include "core/TensorUtils.hpp"
+
+// Change it when the packed format of any execution changed
+#define MNN_CPU_WEIGHT_CACHE_VERSION 2
+#define MNN_CPU_WEIGHT_CACHE_MAGIC 0x574e4e4d
+
+namespace MNN {
+CPUWeightCache::CPUWeightCache(int features) {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    // The bf16 weights are packed by the lP / hP of the selected kernel, 32 / 16 only if AMX is enabled for the process
+    int bf16LP = 0, bf16HP = 0;
+#ifdef MNN_USE_SSE
+    MNNGetBF16PackMode(&bf16LP, &bf16HP);
+#endif
+    mHeader = {MNN_CPU_WEIGHT_CACHE_MAGIC, MNN_CPU_WEIGHT_CACHE_VERSION, features, eP, lP, hP, bf16LP, bf16HP,
+               (int32_t)sizeof(void*)};
+}
+
+// Read-only cursor of cache buffer, all read fails after out of range
+class CacheReader {
+public:
+    CacheReader(const uint8_t* buffer, size_t size) : mCurrent(buffer), mEnd(buffer + size) {
+    }
+    // Return current position and move forward size bytes
+    const uint8_t* skip(size_t size) {
+        if (nullptr == mCurrent || (size_t)(mEnd - mCurrent) < size) {
+            mCurrent = nullptr;
+            return nullptr;
+        }
+        auto res = mCurrent;
+        mCurrent += size;
+        return res;
+    }
+    template <typename T>
+    bool read(T& value) {
+        auto ptr = skip(sizeof(T));
+        if (nullptr == ptr) {
+            return false;
+        }
+        ::memcpy(&value, ptr, sizeof(T));
+        return true;
+    }
+
+private:
+    const uint8_t* mCurrent;
+    const uint8_t* mEnd;
+};
+
+template <typename T>
+static void _write(std::vector<uint8_t>& dst, const T& value) {
+    auto offset = dst.size();
+    dst.resize(offset + sizeof(T));
+    ::memcpy(dst.data() + offset, &value, sizeof(T));
+}
+
+static void _write(std::vector<uint8_t>& dst, const void* src, size_t size) {
+    auto offset = dst.size();
+    dst.resize(offset + size);
+    ::memcpy(dst.data() + offset, src, size);
+}
+
+static bool _skipTensors(CacheReader& reader) {
+    int32_t tensorNumber = 0;
+    if (!reader.read(tensorNumber)) {
+        return false;
+    }
+    for (int t = 0; t < tensorNumber; ++t) {
+        int32_t info[3];
+        if (!reader.read(info) || info[2] < 0 || nullptr == reader.skip(info[2] * sizeof(int32_t))) {
+            return false;
+        }
+        uint64_t bytes = 0;
+        if (!reader.read(bytes) || nullptr == reader.skip(bytes)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CPUWeightCache::load(const void* buffer, size_t size) {
+    mLoaded.clear();
+    mRecords.clear();
+    mBuffer.clear();
+    if (nullptr == buffer) {
+        return false;
+    }
+    CacheReader reader((const uint8_t*)buffer, size);
+    auto headerSize = mHeader.size() * sizeof(int32_t);
+    auto header     = reader.skip(headerSize);
+    if (nullptr == header || 0 != ::memcmp(header, mHeader.data(), headerSize)) {
+        return false;
+    }
+    int32_t entryNumber = 0;
+    if (!reader.read(entryNumber)) {
+        return false;
+    }
+    for (int i = 0; i < entryNumber; ++i) {
+        int32_t keySize = 0;
+        if (!reader.read(keySize) || keySize < 0) {
+            break;
+        }
+        auto key = reader.skip(keySize);
+        if (nullptr == key) {
+            break;
+        }
+        // Check the tensors of this entry, it's parsed again when used
+        auto entry = reader.skip(0);
+        if (!_skipTensors(reader)) {
+            break;
+        }
+        mLoaded.insert(std::make_pair(std::string((const char*)key, keySize),
+                                      std::make_pair(entry, (size_t)(reader.skip(0) - entry))));
+    }
+    if (mLoaded.size() != entryNumber) {
+        MNN_ERROR("CPU weight cache is broken, only %d of %d weights are used\n", (int)mLoaded.size(), entryNumber);
+    }
+    return true;
+}
+
+std::pair<const void*, size_t> CPUWeightCache::save() {
+    mBuffer.clear();
+    std::vector<const Record*> records;
+    for (auto& r : mRecords) {
+        if (!r.owner.expired()) {
+            records.emplace_back(&r);
+        }
+    }
+    if (records.empty()) {
+        return std::make_pair(nullptr, 0);
+    }
+    _write(mBuffer, mHeader.data(), mHeader.size() * sizeof(int32_t));
+    _write(mBuffer, (int32_t)records.size());
+    for (auto r : records) {
+        _write(mBuffer, (int32_t)r->key.size());
+        _write(mBuffer, r->key.data(), r->key.size());
+        _write(mBuffer, (int32_t)r->tensors.size());
+        for (auto t : r->tensors) {
+            auto& buffer    = t->buffer();
+            int32_t info[3] = {(int32_t)buffer.type.code, (int32_t)buffer.type.bits, buffer.dimensions};
+            _write(mBuffer, info);
+            for (int d = 0; d < buffer.dimensions; ++d) {
+                _write(mBuffer, (int32_t)buffer.dim[d].extent);
+            }
+            uint64_t bytes = t->size();
+            _write(mBuffer, bytes);
+            _write(mBuffer, t->host<void>(), bytes);
+        }
+    }
+    return std::make_pair(mBuffer.data(), mBuffer.size());
+}
+
+bool CPUWeightCache::get(const std::string& key, Backend* backend,
+                         std::vector<std::shared_ptr<Tensor>>& tensors) const {
+    auto iter = mLoaded.find(key);
+    if (iter == mLoaded.end()) {
+        return false;
+    }
+    // The entry has been checked in load
+    CacheReader reader(iter->second.first, iter->second.second);
+    int32_t tensorNumber = 0;
+    reader.read(tensorNumber);
+    std::vector<std::shared_ptr<Tensor>> result;
+    bool valid = true;
+    for (int t = 0; t < tensorNumber; ++t) {
+        int32_t info[3];
+        reader.read(info);
+        std::shared_ptr<Tensor> tensor(new Tensor(info[2]));
+        tensor->buffer().type = halide_type_t((halide_type_code_t)info[0], info[1]);
+        for (int d = 0; d < info[2]; ++d) {
+            int32_t extent = 0;
+            reader.read(extent);
+            tensor->setLength(d, extent);
+        }
+        TensorUtils::setLinearLayout(tensor.get());
+        uint64_t bytes = 0;
+        reader.read(bytes);
+        auto src = reader.skip(bytes);
+        if (bytes != tensor->size() || !backend->onAcquireBuffer(tensor.get(), Backend::STATIC)) {
+            valid = false;
+            break;
+        }
+        result.emplace_back(tensor);
+        ::memcpy(tensor->host<void>(), src, bytes);
+    }
+    if (!valid) {
+        for (auto& t : result) {
+            backend->onReleaseBuffer(t.get(), Backend::STATIC);
+        }
+        return false;
+    }
+    tensors = std::move(result);
+    return true;
+}
+
+void CPUWeightCache::put(const std::string& key, std::shared_ptr<void> owner, const std::vector<Tensor*>& tensors) {
+    Record record;
+    record.key     = key;
+    record.owner   = owner;
+    record.tensors = tensors;
+    mRecords.emplace_back(std::move(record));
+}
+} // namespace MNN
@@ -0,0 +1,71 @@
+//
+//  CPUWeightCache.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef CPUWeightCache_hpp
+#define CPUWeightCache_hpp
+
+#include <MNN/Tensor.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/Backend.hpp"
+
+namespace MNN {
+/**
+ * Packed weights of CPU executions, so that the weight transform can be skipped when the session is created again.
+ * Saved by Runtime::onGetCache and loaded by Runtime::onSetCache, the cache is only valid for the same CPU features
+ * and matmul pack modes (eP / lP / hP of float and lP / hP of bf16).
+ */
+class CPUWeightCache {
+public:
+    /**
+     * @brief initializer.
+     * @param features  CPU features that the packed weights depend on.
+     */
+    CPUWeightCache(int features);
+    ~CPUWeightCache() = default;
+
+    /**
+     * @brief use the packed weights in buffer, the buffer must be kept until reset by load(nullptr, 0).
+     * @return false if the buffer is not a cache of this CPU.
+     */
+    bool load(const void* buffer, size_t size);
+
+    /**
+     * @brief serialize the packed weights recorded by put.
+     * @return buffer and size, the buffer is valid until next save or load.
+     */
+    std::pair<const void*, size_t> save();
+
+    /**
+     * @brief create tensors in STATIC memory of backend and copy the cached buffers of key to them.
+     * @return false if key is not cached.
+     */
+    bool get(const std::string& key, Backend* backend, std::vector<std::shared_ptr<Tensor>>& tensors) const;
+
+    /**
+     * @brief record the packed tensors of key, they are serialized by save if owner is still alive.
+     */
+    void put(const std::string& key, std::shared_ptr<void> owner, const std::vector<Tensor*>& tensors);
+
+private:
+    struct Record {
+        std::string key;
+        std::weak_ptr<void> owner;
+        std::vector<Tensor*> tensors;
+    };
+    std::vector<int32_t> mHeader;
+    // key -> (tensors' begin, size) in the loaded buffer
+    std::map<std::string, std::pair<const uint8_t*, size_t>> mLoaded;
+    std::vector<Record> mRecords;
+    std::vector<uint8_t> mBuffer;
+};
+} // namespace MNN
+
+#endif /* CPUWeightCache_hpp */
@@ -7,7 +7,10 @@
 //
 #ifdef MNN_USE_THREAD_POOL
 #include "backend/cpu/ThreadPool.hpp"
+#include "backend/cpu/CPUNuma.hpp"
+#include <stdint.h>
 #include <string.h>
+#include <algorithm>
 #include <MNN/MNNDefine.h>
 #ifdef __ANDROID__
 #include <stdint.h>
@@ -17,9 +20,17 @@
 #endif
 //#define MNN_THREAD_LOCK_CPU
 
-#define MNN_THREAD_POOL_MAX_TASKS 2
+// An enqueued task is split into at most (number of thread * MNN_THREAD_POOL_SPLIT) chunks
+#define MNN_THREAD_POOL_SPLIT 4
+// The nodes of NUMA pools are in [0, MNN_NUMA_MAX_NODE)
+#define MNN_NUMA_MAX_NODE 64
 namespace MNN {
 ThreadPool* ThreadPool::gInstance = nullptr;
+// Pools of NUMA nodes and their references, read without lock by enqueue
+static std::atomic<ThreadPool*> gNumaPools[MNN_NUMA_MAX_NODE];
+static int gNumaReferences[MNN_NUMA_MAX_NODE] = {0};
+// The task running in pool can't enqueue task again, such as the ops dispatched by inter-op parallel
+static thread_local bool gInPool = false;
 static std::mutex gInitMutex;
 int ThreadPool::init(int number) {
     if (1 >= number) {
@@ -43,6 +54,45 @@ void ThreadPool::destroy() {
         gInstance = nullptr;
     }
 }
+int ThreadPool::initNuma(int node, int number) {
+    if (1 >= number) {
+        return 1;
+    }
+    if (node < 0 || node >= MNN_NUMA_MAX_NODE) {
+        MNN_PRINT("NUMA node %d is not supported by thread pool, use the shared pool\n", node);
+        return init(number);
+    }
+    std::lock_guard<std::mutex> _l(gInitMutex);
+    gNumaReferences[node]++;
+    auto pool = gNumaPools[node].load();
+    if (nullptr == pool) {
+        gNumaPools[node] = new ThreadPool(number, node);
+        return number;
+    }
+    return std::min(number, pool->number());
+}
+void ThreadPool::releaseNuma(int node) {
+    if (node < 0 || node >= MNN_NUMA_MAX_NODE) {
+        return;
+    }
+    std::lock_guard<std::mutex> _l(gInitMutex);
+    if (gNumaReferences[node] <= 0) {
+        return;
+    }
+    gNumaReferences[node]--;
+    if (0 == gNumaReferences[node]) {
+        delete gNumaPools[node].exchange(nullptr);
+    }
+}
+ThreadPool* ThreadPool::getPool(int node) {
+    if (node >= 0 && node < MNN_NUMA_MAX_NODE) {
+        auto pool = gNumaPools[node].load();
+        if (nullptr != pool) {
+            return pool;
+        }
+    }
+    return gInstance;
+}
 #ifdef MNN_THREAD_LOCK_CPU
 static int getNumberOfCPU() {
     FILE* fp = fopen("/proc/cpuinfo", "rb");
@@ -149,21 +199,17 @@ static int setSchedAffinity(const std::vector<int>& cpuIDs) {
 }
 
 #endif // arch
-ThreadPool::ThreadPool(int numberThread) {
+ThreadPool::ThreadPool(int numberThread, int node) {
     mNumberThread = numberThread;
     mActiveCount  = 0;
-    mTaskAvailable.resize(MNN_THREAD_POOL_MAX_TASKS);
-    mTasks.resize(MNN_THREAD_POOL_MAX_TASKS);
-    for (int t = 0; t < mTasks.size(); ++t) {
-        mTaskAvailable[t] = true;
-        for (int i = 0; i < mNumberThread; ++i) {
-            mTasks[t].second.emplace_back(new std::atomic_bool{false});
-        }
+    mNode         = node;
+    for (int i = 1; i < mNumberThread; ++i) {
+        mQueues.emplace_back(new Worker);
     }
 #ifdef MNN_THREAD_LOCK_CPU
     std::vector<int> sortedCPUIDs = sortCPUIDByMaxFrequency(numberThread);
 #endif
-    for (int i = 1; i < mNumberThread; ++i) {
+    for (int i = 0; i < mQueues.size(); ++i) {
         int threadIndex = i;
 #ifdef MNN_THREAD_LOCK_CPU
         mWorkers.emplace_back([this, sortedCPUIDs, threadIndex]() {
@@ -173,15 +219,18 @@ ThreadPool::ThreadPool(int numberThread) {
 #ifdef MNN_THREAD_LOCK_CPU
             int res = setSchedAffinity(sortedCPUIDs);
 #endif
+            gInPool = true;
+            if (mNode >= 0) {
+                CPUNuma::get()->bindThread(mNode);
+            }
             while (!mStop) {
-                while (mActiveCount > 0) {
-                    for (int i = 0; i < MNN_THREAD_POOL_MAX_TASKS; ++i) {
-                        if (*mTasks[i].second[threadIndex]) {
-                            mTasks[i].first.first(threadIndex);
-                            { *mTasks[i].second[threadIndex] = false; }
-                        }
+                while (mActiveCount > 0 && !mStop) {
+                    Chunk chunk;
+                    if (popChunk(threadIndex, chunk) || stealChunk(threadIndex + 1, nullptr, chunk)) {
+                        runChunk(chunk);
+                    } else {
+                        std::this_thread::yield();
                     }
-                    std::this_thread::yield();
                 }
                 std::unique_lock<std::mutex> _l(mQueueMutex);
                 mCondition.wait(_l, [this] { return mStop || mActiveCount > 0; });
@@ -192,104 +241,128 @@ ThreadPool::ThreadPool(int numberThread) {
 
 ThreadPool::~ThreadPool() {
     mStop = true;
-    mCondition.notify_all();
+    {
+        std::lock_guard<std::mutex> _l(mQueueMutex);
+        mCondition.notify_all();
+    }
     for (auto& worker : mWorkers) {
         worker.join();
     }
-    for (auto& task : mTasks) {
-        for (auto c : task.second) {
-            delete c;
-        }
-    }
 }
 
 int ThreadPool::acquireWorkIndex() {
-    if (nullptr == gInstance) {
-        return -1;
-    }
-    std::lock_guard<std::mutex> _l(gInstance->mQueueMutex);
-    for (int i = 0; i < MNN_THREAD_POOL_MAX_TASKS; ++i) {
-        if (gInstance->mTaskAvailable[i]) {
-            gInstance->mTaskAvailable[i] = false;
-            return i;
-        }
-    }
-    return -1;
+    // The index only decides which deque receives the first chunk, so that concurrent sessions start on different
+    // workers, there is no limit of concurrent sessions. It is shared by the shared pool and the pools of NUMA nodes
+    static std::atomic_int gWorkIndex = {0};
+    return (gWorkIndex++) & 0x7fffffff;
 }
 void ThreadPool::releaseWorkIndex(int index) {
-    if (nullptr == gInstance) {
+    // Nothing to release, see acquireWorkIndex
+}
+
+void ThreadPool::active(int node) {
+    auto pool = getPool(node);
+    if (nullptr == pool) {
         return;
     }
-    if (index < 0 || index >= MNN_THREAD_POOL_MAX_TASKS) {
+    pool->mActiveCount++;
+    std::lock_guard<std::mutex> _l(pool->mQueueMutex);
+    pool->mCondition.notify_all();
+}
+void ThreadPool::deactive(int node) {
+    auto pool = getPool(node);
+    if (nullptr == pool) {
         return;
     }
-    std::lock_guard<std::mutex> _l(gInstance->mQueueMutex);
-    gInstance->mTaskAvailable[index] = true;
+    pool->mActiveCount--;
 }
 
-void ThreadPool::active() {
-    if (nullptr == gInstance) {
-        return;
+bool ThreadPool::popChunk(int workerIndex, Chunk& chunk) {
+    auto worker = mQueues[workerIndex].get();
+    std::lock_guard<std::mutex> _l(worker->lock);
+    if (worker->chunks.empty()) {
+        return false;
     }
-    gInstance->mActiveCount++;
-    std::lock_guard<std::mutex> _l(gInstance->mQueueMutex);
-    gInstance->mCondition.notify_all();
+    chunk = worker->chunks.back();
+    worker->chunks.pop_back();
+    return true;
 }
-void ThreadPool::deactive() {
-    if (nullptr == gInstance) {
-        return;
+
+bool ThreadPool::stealChunk(int start, const Job* job, Chunk& chunk) {
+    const int queueNumber = (int)mQueues.size();
+    for (int i = 0; i < queueNumber; ++i) {
+        auto worker = mQueues[(start + i) % queueNumber].get();
+        std::lock_guard<std::mutex> _l(worker->lock);
+        for (auto iter = worker->chunks.begin(); iter != worker->chunks.end(); ++iter) {
+            // Steal the oldest chunk, or the chunk of given job
+            if (nullptr == job || iter->job == job) {
+                chunk = *iter;
+                worker->chunks.erase(iter);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ThreadPool::runChunk(const Chunk& chunk) {
+    auto job = chunk.job;
+    for (int i = chunk.begin; i < chunk.end; ++i) {
+        job->task->first(i);
     }
-    gInstance->mActiveCount--;
+    // The job may be released by its owner once pending is zero, don't touch it after this
+    job->pending -= (chunk.end - chunk.begin);
 }
 
-void ThreadPool::enqueue(TASK&& task, int index) {
-    if (1 >= task.second || 0 > index) {
+void ThreadPool::enqueue(TASK&& task, int index, int node) {
+    if (1 >= task.second || 0 > index || gInPool) {
         for (int i = 0; i < task.second; ++i) {
             task.first(i);
         }
         return;
     }
-    MNN_ASSERT(nullptr != gInstance);
-    gInstance->enqueueInternal(std::move(task), index);
+    auto pool = getPool(node);
+    MNN_ASSERT(nullptr != pool);
+    pool->enqueueInternal(std::move(task), index);
 }
 void ThreadPool::enqueueInternal(TASK&& task, int index) {
-    if (mActiveCount == 0) {
+    if (mActiveCount == 0 || mQueues.empty()) {
         for (int i = 0; i < task.second; ++i) {
             task.first(i);
         }
         return;
     }
-    int workSize = task.second;
-    if (workSize > mNumberThread) {
-        mTasks[index].first = std::make_pair(
-            [workSize, &task, this](int tId) {
-                for (int v = tId; v < workSize; v += mNumberThread) {
-                    task.first(v);
-                }
-            },
-            mNumberThread);
-        workSize = mNumberThread;
-    } else {
-        mTasks[index].first = std::move(task);
+    const int workSize = task.second;
+    const int chunkNumber = std::min(workSize, mNumberThread * MNN_THREAD_POOL_SPLIT);
+    Job job;
+    job.task    = &task;
+    job.pending = workSize;
+    // The first chunk is run by the caller, the others are spread over the workers' deques
+    const int queueNumber = (int)mQueues.size();
+    for (int c = 1; c < chunkNumber; ++c) {
+        Chunk chunk;
+        chunk.job   = &job;
+        chunk.begin = (int)((int64_t)workSize * c / chunkNumber);
+        chunk.end   = (int)((int64_t)workSize * (c + 1) / chunkNumber);
+        auto worker = mQueues[(index + c - 1) % queueNumber].get();
+        std::lock_guard<std::mutex> _l(worker->lock);
+        worker->chunks.push_back(chunk);
     }
-    {
-        for (int i = 1; i < workSize; ++i) {
-            *mTasks[index].second[i] = true;
+    Chunk chunk;
+    chunk.job   = &job;
+    chunk.begin = 0;
+    chunk.end   = workSize / chunkNumber;
+    gInPool     = true;
+    runChunk(chunk);
+    // Help with the chunks of this task not taken by workers yet
+    while (job.pending > 0) {
+        if (stealChunk(index, &job, chunk)) {
+            runChunk(chunk);
+        } else {
+            std::this_thread::yield();
         }
     }
-    mTasks[index].first.first(0);
-    bool complete = true;
-    do {
-        std::this_thread::yield();
-        complete = true;
-        for (int i = 1; i < workSize; ++i) {
-            if (*mTasks[index].second[i]) {
-                complete = false;
-                break;
-            }
-        }
-        // FUNC_PRINT(notComplete);
-    } while (!complete);
+    gInPool = false;
 }
 } // namespace MNN
 #endif
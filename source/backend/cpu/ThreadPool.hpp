@@ -10,7 +10,9 @@
 #define CPU_INTHREADPOOL_H
 #ifdef MNN_USE_THREAD_POOL
 #include <condition_variable>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -18,6 +20,13 @@
 #include <MNN/MNNDefine.h>
 namespace MNN {
 
+/**
+ * Work stealing pool shared by all CPU runtimes. Each worker owns a deque of chunks (ranges of task index), an
+ * enqueued task is split into chunks spread over the deques, and idle workers steal chunks from the others, so
+ * any number of sessions can run concurrently and uneven chunks are balanced.
+ * The runtimes bound to a NUMA node use a pool of that node instead, whose workers are bound to the cpus of the node,
+ * so the shared pool is never bound.
+ */
 class MNN_PUBLIC ThreadPool {
 public:
     typedef std::pair<std::function<void(int)>, int> TASK;
@@ -25,29 +34,61 @@ public:
     int number() const {
         return mNumberThread;
     }
-    static void enqueue(TASK&& task, int index);
+    /**
+     * @brief run task, return after all done.
+     * @param index work index from acquireWorkIndex, task runs in caller thread if index < 0.
+     * @param node  NUMA node of initNuma to run task in its pool, -1 means the shared pool.
+     */
+    static void enqueue(TASK&& task, int index, int node = -1);
 
-    static void active();
-    static void deactive();
+    static void active(int node = -1);
+    static void deactive(int node = -1);
 
     static int acquireWorkIndex();
     static void releaseWorkIndex(int index);
 
     static int init(int number);
     static void destroy();
+    /**
+     * @brief create or reference the pool of NUMA node, whose workers are bound to the cpus of node.
+     * @return thread number of the pool, the shared pool is used instead if node is not less than MNN_NUMA_MAX_NODE.
+     */
+    static int initNuma(int node, int number);
+    /** release the reference of initNuma, the pool of node is destroyed with the last reference */
+    static void releaseNuma(int node);
 
 private:
+    struct Job {
+        const TASK* task;
+        // Number of task index not done yet
+        std::atomic_int pending;
+    };
+    struct Chunk {
+        Job* job;
+        int begin;
+        int end;
+    };
+    struct Worker {
+        std::mutex lock;
+        std::deque<Chunk> chunks;
+    };
     void enqueueInternal(TASK&& task, int index);
+    bool popChunk(int workerIndex, Chunk& chunk);
+    bool stealChunk(int start, const Job* job, Chunk& chunk);
+    static void runChunk(const Chunk& chunk);
+    static ThreadPool* getPool(int node);
 
     static ThreadPool* gInstance;
-    ThreadPool(int number = 0);
+    ThreadPool(int number = 0, int node = -1);
     ~ThreadPool();
 
     std::vector<std::thread> mWorkers;
-    std::vector<bool> mTaskAvailable;
+    // One deque for each thread in mWorkers
+    std::vector<std::unique_ptr<Worker>> mQueues;
+    // NUMA node the workers are bound to, -1 for the shared pool
+    int mNode = -1;
     std::atomic<bool> mStop = {false};
 
-    std::vector<std::pair<TASK, std::vector<std::atomic_bool*>>> mTasks;
     std::condition_variable mCondition;
     std::mutex mQueueMutex;
 
@@ -68,6 +68,53 @@ void MNNScaleAndAddBiasOutside(float* dst, const float* src, const float* bias,
     }
 }
 
+#ifndef MNN_USE_SSE
+void MNNLayerNorm(float* dst, const float* src, const float* residual, const float* gamma, const float* beta,
+                  float epsilon, size_t size) {
+    float shift = src[0] + (nullptr != residual ? residual[0] : 0.0f);
+    auto sizeC4 = size / 4;
+    Vec4 shiftV(shift);
+    Vec4 sumV(0.0f);
+    Vec4 squareV(0.0f);
+    for (int i = 0; i < sizeC4; ++i) {
+        auto x = Vec4::load(src + 4 * i);
+        if (nullptr != residual) {
+            x = x + Vec4::load(residual + 4 * i);
+            Vec4::save(dst + 4 * i, x);
+        }
+        x       = x - shiftV;
+        sumV    = sumV + x;
+        squareV = squareV + x * x;
+    }
+    float sum    = sumV[0] + sumV[1] + sumV[2] + sumV[3];
+    float square = squareV[0] + squareV[1] + squareV[2] + squareV[3];
+    for (int i = sizeC4 * 4; i < size; ++i) {
+        auto x = src[i];
+        if (nullptr != residual) {
+            x += residual[i];
+            dst[i] = x;
+        }
+        x -= shift;
+        sum += x;
+        square += x * x;
+    }
+    float mean     = sum / size;
+    float variance = ALIMAX(square / size - mean * mean, 0.0f);
+    float scale    = 1.0f / sqrtf(variance + epsilon);
+    mean += shift;
+    // The sum of residual is saved in dst
+    auto input = nullptr != residual ? dst : src;
+    Vec4 meanV(mean);
+    for (int i = 0; i < sizeC4; ++i) {
+        auto x = (Vec4::load(input + 4 * i) - meanV) * scale;
+        Vec4::save(dst + 4 * i, x * Vec4::load(gamma + 4 * i) + Vec4::load(beta + 4 * i));
+    }
+    for (int i = sizeC4 * 4; i < size; ++i) {
+        dst[i] = (input[i] - mean) * scale * gamma[i] + beta[i];
+    }
+}
+#endif
+
 
 
 #ifndef MNN_USE_NEON
@@ -320,6 +367,13 @@ void MNNExpC8(float* dest, const float* source, const float* parameters, size_t
         dest[i] = expBasic * expRemain;
     }
 }
+
+bool MNNSupportBF16() {
+    return false;
+}
+bool MNNBF16IsFast() {
+    return false;
+}
 #endif // no MNN_USE_SSE
 
 void MNNMaxFloat(float* input, float* maxBuffer, int32_t inputCountUnit) {
@@ -691,6 +745,54 @@ void MNNPackTranspose(float* dst, const float* src, size_t area, size_t depth) {
     }
 }
 
+void MNNPackC4Strided(float* dst, const float* src, size_t area, size_t depth, int areaStride, int depthStride) {
+    int depthC4 = UP_DIV((int)depth, 4);
+    for (int z = 0; z < depthC4; ++z) {
+        auto dstPlane = dst + z * area * 4;
+        int valid     = std::min(4, (int)depth - 4 * z);
+        auto srcPlane = src + 4 * z * depthStride;
+        if (1 == depthStride && valid == 4) {
+            for (int x = 0; x < area; ++x) {
+                Vec4::save(dstPlane + 4 * x, Vec4::load(srcPlane + x * areaStride));
+            }
+            continue;
+        }
+        for (int x = 0; x < area; ++x) {
+            auto srcX = srcPlane + x * areaStride;
+            auto dstX = dstPlane + 4 * x;
+            int i     = 0;
+            for (; i < valid; ++i) {
+                dstX[i] = srcX[i * depthStride];
+            }
+            for (; i < 4; ++i) {
+                dstX[i] = 0.0f;
+            }
+        }
+    }
+}
+
+void MNNPackForMatMul_BStrided(float* dest, const float* source, size_t h, size_t l, int hStride, int lStride) {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    int hC = UP_DIV((int)h, hP);
+    for (int y = 0; y < hC; ++y) {
+        auto dstY = dest + y * hP * l;
+        int valid = std::min(hP, (int)h - y * hP);
+        auto srcY = source + y * hP * hStride;
+        for (int x = 0; x < l; ++x) {
+            auto dstX = dstY + x * hP;
+            auto srcX = srcY + x * lStride;
+            int i     = 0;
+            for (; i < valid; ++i) {
+                dstX[i] = srcX[i * hStride];
+            }
+            for (; i < hP; ++i) {
+                dstX[i] = 0.0f;
+            }
+        }
+    }
+}
+
 void MNNRelu6(float* dst, const float* src, size_t size) {
     int i;
     for (i = 0; i < size; ++i) {
@@ -733,28 +835,6 @@ void MNNExp(float* dst, const float* src, size_t dataSize) {
     }
 }
 
-// Lambert's series with 7 divisions
-// reference from
-// https://varietyofsound.wordpress.com/2011/02/14/efficient-tanh-computation-using-lamberts-continued-fraction/
-inline float tanhf_poly(float value) {
-    if (value > 5.0) {
-        return 1.0;
-    } else if (value <= -5.0) {
-        return -1.0;
-    } else {
-        float x2 = value * value;
-        float a  = value * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
-        float b  = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
-        return a / b;
-    }
-}
-void MNNTanh(float* dst, const float* src, size_t dataSize) {
-    for (int i = 0; i < dataSize; i++) {
-        // outputData[i] = 1 - 2 / (expf(2 * inputData[i]) + 1);
-        dst[i] = tanhf_poly(src[i]);
-    }
-}
-
 void MNNReluWithSlope(float* dst, const float* src, size_t sizeQuad, float slope) {
     float slopeValue[4];
     for (int i=0; i<4; ++i) {
@@ -68,7 +68,18 @@ void MNNPowC8(float* dest, const float* source, const float* powfParam, size_t b
 
 
 void MNNExp(float* dst, const float* src, size_t dataSize);
-void MNNTanh(float* dst, const float* src, size_t dataSize);
+
+// Elementwise math, see VectorMath.hpp for the maximum error
+void MNNVectorExp(float* dst, const float* src, size_t size);
+void MNNVectorLog(float* dst, const float* src, size_t size);
+void MNNVectorErf(float* dst, const float* src, size_t size);
+void MNNTanh(float* dst, const float* src, size_t size);
+void MNNSigmoid(float* dst, const float* src, size_t size);
+void MNNSiLU(float* dst, const float* src, size_t size);
+// 0.5 * x * (1 + erf(x / sqrt(2)))
+void MNNGelu(float* dst, const float* src, size_t size);
+// 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+void MNNGeluTanh(float* dst, const float* src, size_t size);
 void MNNReluWithSlopeCommon(float* dst, const float* src, size_t size, float slope);
 bool MNNReorder4x4ByPlatform(float* dst, size_t size);
 
@@ -76,6 +87,10 @@ bool MNNReorder4x4ByPlatform(float* dst, size_t size);
 void MNNGetMatMulPackMode(int* eP, int *lP, int* hP);
 void MNNPackC4ForMatMul_A(float* dest, const float* source, size_t e, size_t l, size_t eReal);
 void MNNPackForMatMul_B(float* dest, const float* source, size_t h, size_t l, bool transpose);
+// The same as MNNPackC4 and MNNPackForMatMul_B, the element (a, d) or (y, x) of the source is
+// source[a * areaStride + d * depthStride] or source[y * hStride + x * lStride]
+void MNNPackC4Strided(float* dst, const float* src, size_t area, size_t depth, int areaStride, int depthStride);
+void MNNPackForMatMul_BStrided(float* dest, const float* source, size_t h, size_t l, int hStride, int lStride);
 
 // parameters: e, l, h, CStride, AStride, BStride
 void MNNPackedMatMul(float* C, const float* A, const float* B, const size_t* parameter, float* cache, const float* postParameters, const float* bias);
@@ -83,6 +98,23 @@ void MNNFunctionInit();
 void MNNPackedMatMulRemain(float* C, const float* A, const float* B, size_t eSize, const size_t* parameter, float* cache, const float* postParameters, const float* bias);
 int MNNGetC4DivNumber(int hP);
 
+// The GEMM of BackendConfig::bf16Convolution, the bfloat16 products are summed in float, only x86 has the kernels
+// A: the [l, eP] of MNNPackC4ForMatMul_A converted by MNNPackedAToBF16, UP_DIV(l, lP) * lP * eP of int16
+// B: [UP_DIV(h, hP), UP_DIV(l, lP) * lP / 2, hP, 2] of the [h, l] by MNNPackForMatMul_BBF16, padded by zero
+// parameter and C are the same as MNNPackedMatMul, bExtraStride in bytes of int16
+bool MNNSupportBF16();
+// The bf16 GEMM is faster than the float one (AMX), else it only halves the memory of the weight
+bool MNNBF16IsFast();
+#ifdef MNN_USE_SSE
+void MNNGetBF16PackMode(int* lP, int* hP);
+void MNNPackForMatMul_BBF16(int16_t* dest, const float* source, size_t h, size_t l);
+void MNNPackedAToBF16(int16_t* dest, const float* source, size_t eP, size_t l);
+void MNNPackedMatMulBF16(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                         const float* postParameters, const float* bias);
+void MNNPackedMatMulRemainBF16(float* C, const int16_t* A, const int16_t* B, size_t eSize, const size_t* parameter,
+                               const float* postParameters, const float* bias);
+#endif
+
 // C = clamp(alpha * A + beta * B, min, max)
 // paramters: alpha, beta, min, max
 void MNNAxByClamp(float* C, const float* A, const float* B, size_t width, size_t cStride, size_t aStride, size_t bStride, size_t height, const float* parameters);
@@ -92,6 +124,11 @@ void MNNAxByClampBroadcastC4(float* C, const float* A, const float* B, size_t wi
 // dim: 4-element, sizeDW, sizeDH, strideSW, strideDH
 void MNNTranspose32Bit(int32_t* dstO, const int32_t* srcO, int32_t* dim); // not C4
 
+// dst = (x - mean(x)) / sqrt(var(x) + epsilon) * gamma + beta, x = src + residual, residual can be nullptr
+// The statistics are one pass of sum and square sum of x - x[0], the shift keeps the precision for a large mean
+void MNNLayerNorm(float* dst, const float* src, const float* residual, const float* gamma, const float* beta,
+                  float epsilon, size_t size);
+
 void MNNVectorTop1Float(float* input, float* maxValue, int32_t* maxIndex, size_t inputCountUnit);
 void MNNVectorTop1Int32(int32_t* input, int32_t* maxValue, int32_t* maxIndex, size_t inputCountUnit);
 #ifdef __cplusplus
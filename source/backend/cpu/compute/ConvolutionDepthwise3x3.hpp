@@ -16,14 +16,15 @@ class ConvolutionDepthwise3x3 : public CPUConvolution {
 public:
     ConvolutionDepthwise3x3(const Convolution2DCommon *common, Backend *b, const float *originWeight,
                             size_t originWeightSize, const float *bias, size_t biasSize);
+    ConvolutionDepthwise3x3(std::shared_ptr<Resource> resource, const Convolution2DCommon *common, Backend *b);
     virtual ~ConvolutionDepthwise3x3();
 
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
+    virtual bool onClone(Backend *bn, const Op *op, Execution **dst) override;
 
 private:
-    std::unique_ptr<Tensor> mWeight;
-    std::unique_ptr<Tensor> mBias;
+    std::shared_ptr<Resource> mResource;
 
     std::unique_ptr<Tensor> mCacheLine;
     int mSourceStartX = 0;
@@ -8,36 +8,66 @@
 
 #include "backend/cpu/compute/ConvolutionFloatFactory.h"
 #include "backend/cpu/CPUConvolutionDepthwise.hpp"
+#include "backend/cpu/compute/CommonOptFunction.h"
 #include "backend/cpu/compute/ConvOpt.h"
 #include "backend/cpu/compute/Convolution1x1Strassen.hpp"
 #include "backend/cpu/compute/ConvolutionGroup.hpp"
 #include "backend/cpu/compute/ConvolutionIntFactory.hpp"
 #include "backend/cpu/compute/ConvolutionTiledExecutor.hpp"
+#include "backend/cpu/compute/ConvolutionWeightInt8.hpp"
 #include "backend/cpu/compute/ConvolutionWinograd.hpp"
 #include "core/Macro.h"
 namespace MNN {
 
-static Execution* _createUnit(const Tensor* input, const Tensor* output, Backend* backend,
-                              const Convolution2DCommon* common, const float* originWeight, size_t originWeightSize,
-                              const float* bias, size_t biasSize) {
-    auto layer   = common;
-    bool fastWay = layer->kernelY() == 1 && layer->kernelX() == 1;
-    if (fastWay) {
-        return new Convolution1x1Strassen(common, backend, originWeight, originWeightSize, bias, biasSize);
-    }
-    if (!ConvolutionWinograd::canUseWinograd(common)) {
-        return new ConvolutionTiledExecutor(common, backend, originWeight, originWeightSize, bias, biasSize);
+template <typename T>
+static Execution* _createCached(T* execution, Backend* backend, const std::string& key) {
+    if (execution->valid()) {
+        CPUConvolution::saveResource(backend, key, execution->resource());
     }
+    return execution;
+}
+
+static Execution* _createUnit(const Tensor* input, const Tensor* output, Backend* backend, const Op* op, int index,
+                              const float* originWeight, size_t originWeightSize, const float* bias, size_t biasSize) {
+    auto common     = op->main_as_Convolution2D()->common();
     auto cpuBackend = (CPUBackend*)backend;
-    if (cpuBackend->memoryMode() == BackendConfig::Memory_Low) {
-        return new ConvolutionTiledExecutor(common, backend, originWeight, originWeightSize, bias, biasSize);
+    auto sizeKind   = std::to_string(originWeightSize) + "_" + std::to_string(biasSize);
+    bool fastWay    = common->kernelY() == 1 && common->kernelX() == 1;
+    // The bf16 GEMM is in ConvolutionTiledExecutor. If it is slower than the float one, it only halves the weight of
+    // the tiled convolution, and Strassen and Winograd keep the float
+    bool bf16       = cpuBackend->useBF16();
+    bool bf16Fast   = bf16 && MNNBF16IsFast();
+    if (fastWay && !bf16Fast) {
+        auto key      = CPUConvolution::weightCacheKey(op, ("strassen_" + sizeKind).c_str(), index);
+        auto resource = CPUConvolution::loadResource(backend, key);
+        if (nullptr != resource) {
+            return new Convolution1x1Strassen(resource, common, backend);
+        }
+        return _createCached(
+            new Convolution1x1Strassen(common, backend, originWeight, originWeightSize, bias, biasSize), backend, key);
+    }
+    int unit = 0;
+    if (!bf16Fast && ConvolutionWinograd::canUseWinograd(common) && cpuBackend->memoryMode() != BackendConfig::Memory_Low) {
+        unit = ConvolutionWinograd::bestWinogradUnit(common, input, output, cpuBackend->threadNumber());
     }
-    auto unit = ConvolutionWinograd::bestWinogradUnit(common, input, output, cpuBackend->threadNumber());
     if (unit <= 1) {
-        return new ConvolutionTiledExecutor(common, backend, originWeight, originWeightSize, bias, biasSize);
+        auto key      = CPUConvolution::weightCacheKey(op, ((bf16 ? "tiled_bf16_" : "tiled_") + sizeKind).c_str(), index);
+        auto resource = CPUConvolution::loadResource(backend, key);
+        if (nullptr != resource) {
+            return new ConvolutionTiledExecutor(resource, common, backend);
+        }
+        return _createCached(
+            new ConvolutionTiledExecutor(common, backend, originWeight, originWeightSize, bias, biasSize), backend,
+            key);
     }
-    return new ConvolutionWinograd(common, input, output, backend, originWeight, originWeightSize, bias, biasSize,
-                                   unit);
+    auto key = CPUConvolution::weightCacheKey(op, ("winograd" + std::to_string(unit) + "_" + sizeKind).c_str(), index);
+    auto resource = CPUConvolution::loadResource(backend, key);
+    if (nullptr != resource) {
+        return new ConvolutionWinograd(resource, common, input, output, backend, unit);
+    }
+    return _createCached(new ConvolutionWinograd(common, input, output, backend, originWeight, originWeightSize, bias,
+                                                 biasSize, unit),
+                         backend, key);
 }
 
 Execution* ConvolutionFloatFactory::create(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
@@ -50,6 +80,11 @@ Execution* ConvolutionFloatFactory::create(const std::vector<Tensor*>& inputs, c
     const float* originWeight = nullptr;
     size_t originWeightSize   = 0;
     std::shared_ptr<ConvolutionCommon::Int8Common> quanCommon;
+    if (ConvolutionWeightInt8::canUse(op, inputs[0], outputs[0])) {
+        // Keep the weight-only int8 weight compressed instead of the float copy of ConvolutionCommon::load
+        return new ConvolutionWeightInt8(conv2d->common(), backend, conv2d->quanParameter(), conv2d->bias()->data(),
+                                         conv2d->bias()->size());
+    }
     if (nullptr != conv2d->quanParameter()) {
         quanCommon = ConvolutionCommon::load(conv2d->quanParameter());
         if (nullptr == quanCommon) {
@@ -73,7 +108,7 @@ Execution* ConvolutionFloatFactory::create(const std::vector<Tensor*>& inputs, c
     }
 
     if (1 == common->group()) {
-        return _createUnit(inputs[0], outputs[0], backend, common, originWeight, originWeightSize,
+        return _createUnit(inputs[0], outputs[0], backend, op, 0, originWeight, originWeightSize,
                            conv2d->bias()->data(), conv2d->bias()->size());
     }
     // Split
@@ -87,7 +122,7 @@ Execution* ConvolutionFloatFactory::create(const std::vector<Tensor*>& inputs, c
     emptyOutput->setLength(1, outputs[0]->channel() / group);
     for (int i = 0; i < group; ++i) {
         auto newConvolution =
-            _createUnit(emptyInput.get(), emptyOutput.get(), backend, common, originWeight + groupWeightSize * i,
+            _createUnit(emptyInput.get(), emptyOutput.get(), backend, op, i, originWeight + groupWeightSize * i,
                         groupWeightSize, conv2d->bias()->data() + groupOutputCount * i, groupOutputCount);
         subConvolution.push_back(std::shared_ptr<Execution>(newConvolution));
     }
@@ -26,6 +26,25 @@ ConvolutionGroup::ConvolutionGroup(Backend *b, const std::vector<std::shared_ptr
     mOutputUnitWrap.push_back(mOutputUnit.get());
 }
 
+bool ConvolutionGroup::onClone(Backend *bn, const Op *op, Execution **dst) {
+    for (auto &sub : mSubConvolution) {
+        if (!sub->onClone(bn, op, nullptr)) {
+            return false;
+        }
+    }
+    if (nullptr == dst) {
+        return true;
+    }
+    std::vector<std::shared_ptr<Execution>> subConvolution(mSubConvolution.size());
+    for (int i = 0; i < mSubConvolution.size(); ++i) {
+        Execution *sub = nullptr;
+        mSubConvolution[i]->onClone(bn, op, &sub);
+        subConvolution[i].reset(sub);
+    }
+    *dst = new ConvolutionGroup(bn, subConvolution);
+    return true;
+}
+
 ErrorCode ConvolutionGroup::onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
     auto ib = inputs[0]->buffer();
     auto ob = outputs[0]->buffer();
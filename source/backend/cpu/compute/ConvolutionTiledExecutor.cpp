@@ -18,7 +18,7 @@
 
 using Vec4 = MNN::Math::Vec<float, 4>;
 namespace MNN {
-static void _initWeight(float *dest, const float *source, float* cache, int depth, int outputCount, int kernelSize) {
+static void _swapWeight(float* dest, const float *source, int depth, int outputCount, int kernelSize) {
     // Swap k, ic
     int dims[4] = {
         depth,
@@ -27,10 +27,13 @@ static void _initWeight(float *dest, const float *source, float* cache, int dept
         depth
     };
     for (int o=0; o<outputCount; ++o) {
-        auto dO = cache + o * depth * kernelSize;
+        auto dO = dest + o * depth * kernelSize;
         auto sO = source + o * depth * kernelSize;
         MNNTranspose32Bit((int32_t*)dO, (const int32_t*)sO, &dims[0]);
     }
+}
+static void _initWeight(float *dest, const float *source, float* cache, int depth, int outputCount, int kernelSize) {
+    _swapWeight(cache, source, depth, outputCount, kernelSize);
     MNNPackForMatMul_B(dest, cache, outputCount, kernelSize * depth, true);
 }
 ErrorCode ConvolutionTiledExecutorMultiInput::onExecute(const std::vector<Tensor*>& inputs,
@@ -89,31 +92,63 @@ ConvolutionTiledExecutor::ConvolutionTiledExecutor(const Convolution2DCommon* co
 
     // Don't use common->inputCount for old model common->inputCount is zero
     auto srcCount    = (int)originWeightSize / outputCount / common->kernelX() / common->kernelY();
-    mWeight.reset(Tensor::createDevice<float>(
-        {UP_DIV(outputCount, hP), UP_DIV(srcCount, 4), (int)common->kernelX(), common->kernelY(), 4 * hP}));
-    std::shared_ptr<Tensor> cache(Tensor::createDevice<float>({outputCount, srcCount * common->kernelX() * common->kernelY()}));
-    mValid = backend()->onAcquireBuffer(mWeight.get(), Backend::STATIC) && backend()->onAcquireBuffer(cache.get(), Backend::STATIC);
+    auto L           = srcCount * common->kernelX() * common->kernelY();
+    mResource.reset(new CPUConvolution::Resource);
+    mResource->backend = b;
+    bool bf16 = static_cast<CPUBackend*>(b)->useBF16();
+    if (bf16) {
+#ifdef MNN_USE_SSE
+        // The layout of MNNPackedMatMulBF16
+        int bf16LP, bf16HP;
+        MNNGetBF16PackMode(&bf16LP, &bf16HP);
+        mResource->mWeight.reset(Tensor::createDevice<int16_t>(
+            {UP_DIV(outputCount, bf16HP), UP_DIV(L, bf16LP) * bf16LP / 2, 2 * bf16HP}));
+#endif
+    } else {
+        mResource->mWeight.reset(Tensor::createDevice<float>(
+            {UP_DIV(outputCount, hP), UP_DIV(srcCount, 4), (int)common->kernelX(), common->kernelY(), 4 * hP}));
+    }
+    std::shared_ptr<Tensor> cache(Tensor::createDevice<float>({outputCount, L}));
+    mValid = backend()->onAcquireBuffer(mResource->mWeight.get(), Backend::STATIC) && backend()->onAcquireBuffer(cache.get(), Backend::STATIC);
     if (!mValid) {
         return;
     }
-    _initWeight(mWeight->host<float>(), originWeight, cache->host<float>(), srcCount, outputCount, common->kernelX() * common->kernelY());
+    if (bf16) {
+#ifdef MNN_USE_SSE
+        _swapWeight(cache->host<float>(), originWeight, srcCount, outputCount, common->kernelX() * common->kernelY());
+        MNNPackForMatMul_BBF16(mResource->mWeight->host<int16_t>(), cache->host<float>(), outputCount, L);
+#endif
+    } else {
+        _initWeight(mResource->mWeight->host<float>(), originWeight, cache->host<float>(), srcCount, outputCount, common->kernelX() * common->kernelY());
+    }
     backend()->onReleaseBuffer(cache.get(), Backend::STATIC);
-    mBias.reset(Tensor::createDevice<float>({ALIGN_UP4((int)biasSize)}));
-    mValid = backend()->onAcquireBuffer(mBias.get(), Backend::STATIC);
+    mResource->mBias.reset(Tensor::createDevice<float>({ALIGN_UP4((int)biasSize)}));
+    mValid = backend()->onAcquireBuffer(mResource->mBias.get(), Backend::STATIC);
     if (!mValid) {
         return;
     }
-    ::memset(mBias->host<float>(), 0, mBias->size());
-    ::memcpy(mBias->host<float>(), bias, biasSize * sizeof(float));
+    ::memset(mResource->mBias->host<float>(), 0, mResource->mBias->size());
+    ::memcpy(mResource->mBias->host<float>(), bias, biasSize * sizeof(float));
+    mProxy.reset(new ConvolutionTiledExecutorBasic(common, b));
+}
+ConvolutionTiledExecutor::ConvolutionTiledExecutor(std::shared_ptr<CPUConvolution::Resource> res,
+                                                   const Convolution2DCommon* common, Backend* b)
+    : MNN::Execution(b) {
+    mResource = res;
     mProxy.reset(new ConvolutionTiledExecutorBasic(common, b));
 }
 ConvolutionTiledExecutor::~ConvolutionTiledExecutor() {
-    if (nullptr != mBias) {
-        backend()->onReleaseBuffer(mBias.get(), Backend::STATIC);
+    // Do nothing
+}
+bool ConvolutionTiledExecutor::onClone(Backend* bn, const Op* op, Execution** dst) {
+    if (!mValid) {
+        return false;
     }
-    if (nullptr != mWeight) {
-        backend()->onReleaseBuffer(mWeight.get(), Backend::STATIC);
+    if (nullptr == dst) {
+        return true;
     }
+    *dst = new ConvolutionTiledExecutor(mResource, op->main_as_Convolution2D()->common(), bn);
+    return true;
 }
 ErrorCode ConvolutionTiledExecutorBasic::onResize(const std::vector<Tensor*>& inputs,
                                                   const std::vector<Tensor*>& outputs) {
@@ -131,6 +166,9 @@ ErrorCode ConvolutionTiledExecutorBasic::onResize(const std::vector<Tensor*>& in
     auto height = output->height();
     int threadNumber    = ((CPUBackend*)backend())->threadNumber();
     auto weightPtr      = weight->host<float>();
+    // The weight converted by ConvolutionTiledExecutor for BackendConfig::bf16Convolution
+    bool bf16           = weight->getType() == halide_type_of<int16_t>();
+    auto weightBF16     = weight->host<int16_t>();
     auto src_width = input->width();
     auto src_height = input->height();
     int src_z_step      = input->width() * input->height() * 4;
@@ -153,11 +191,25 @@ ErrorCode ConvolutionTiledExecutorBasic::onResize(const std::vector<Tensor*>& in
     mTempBufferTranspose.buffer().dim[0].extent = threadNumber;
     mTempBufferTranspose.buffer().dim[1].extent = L * CONVOLUTION_TILED_NUMBER;
     TensorUtils::setLinearLayout(&mTempBufferTranspose);
+    if (bf16) {
+#ifdef MNN_USE_SSE
+        int bf16LP, bf16HP;
+        MNNGetBF16PackMode(&bf16LP, &bf16HP);
+        mTempBufferBF16.buffer().type          = halide_type_of<int16_t>();
+        mTempBufferBF16.buffer().dimensions    = 2;
+        mTempBufferBF16.buffer().dim[0].extent = threadNumber;
+        mTempBufferBF16.buffer().dim[1].extent = UP_DIV(L, bf16LP) * bf16LP * CONVOLUTION_TILED_NUMBER;
+        TensorUtils::setLinearLayout(&mTempBufferBF16);
+#endif
+    }
 
     int count                             = UP_DIV(width*height, CONVOLUTION_TILED_NUMBER);
     int plane = width * height;
 
     bool success = backend()->onAcquireBuffer(&mTempBuffer, Backend::DYNAMIC) && backend()->onAcquireBuffer(&mTempBufferTranspose, Backend::DYNAMIC);
+    if (bf16) {
+        success = success && backend()->onAcquireBuffer(&mTempBufferBF16, Backend::DYNAMIC);
+    }
     if (!success) {
         return OUT_OF_MEMORY;
     }
@@ -176,6 +228,9 @@ ErrorCode ConvolutionTiledExecutorBasic::onResize(const std::vector<Tensor*>& in
 
     backend()->onReleaseBuffer(&mTempBuffer, Backend::DYNAMIC);
     backend()->onReleaseBuffer(&mTempBufferTranspose, Backend::DYNAMIC);
+    if (bf16) {
+        backend()->onReleaseBuffer(&mTempBufferBF16, Backend::DYNAMIC);
+    }
     std::vector<size_t> parameters(6);
     parameters[0] = eP * sizeof(float);
     parameters[1] = L;
@@ -183,9 +238,12 @@ ErrorCode ConvolutionTiledExecutorBasic::onResize(const std::vector<Tensor*>& in
     parameters[3] = plane * 4 * sizeof(float);
     parameters[4] = 0;
     parameters[5] = 0;
-    auto threadNumberFirst                 = std::min(threadNumber, count);
+    // The tiles of border need less work, schedule the tiles of all batch dynamically
+    auto tileNumber                        = count * input->batch();
+    auto threadNumberFirst                 = std::min(threadNumber, tileNumber);
     auto postParameters = getPostParameters();
     mFunction.first = threadNumberFirst;
+    mCounter.reset(new ConcurrencyCounter(tileNumber, threadNumberFirst));
     auto strideX = mCommon->strideX();
     auto strideY = mCommon->strideY();
     auto dilateX = mCommon->dilateX();
@@ -194,6 +252,8 @@ ErrorCode ConvolutionTiledExecutorBasic::onResize(const std::vector<Tensor*>& in
     auto padX = mPadX;
     auto kernel_width = mCommon->kernelX();
     auto kernel_height = mCommon->kernelY();
+    // The im2col of 1x1 / stride 1 / pad 0 is the input itself
+    bool pointwise = 1 == kernel_width && 1 == kernel_height && 1 == strideX && 1 == strideY && 0 == padX && 0 == padY;
     mFunction.second = [=](int tId) {
         auto colBuffer = mTempBuffer.host<float>() + mTempBuffer.stride(0) * tId;
         auto gemmBuffer = mTempBufferTranspose.host<float>() + mTempBufferTranspose.stride(0) * tId;
@@ -201,59 +261,76 @@ ErrorCode ConvolutionTiledExecutorBasic::onResize(const std::vector<Tensor*>& in
         if (nullptr != cache) {
             cachePtr = cache->host<float>() + tId * cache->stride(0);
         }
-        for (int batchIndex = 0; batchIndex < input->batch(); ++batchIndex) {
-            auto dstOrigin = output->host<float>() + batchIndex * output->stride(0);
-            auto srcOrigin = input->host<float>() + batchIndex * input->stride(0);
-
-            for (int x = (int)tId; x < count; x += threadNumberFirst) {
+        int begin, end;
+        while (mCounter->next(begin, end)) {
+            for (int index = begin; index < end; ++index) {
+                int batchIndex = index / count;
+                int x          = index % count;
+                auto dstOrigin = output->host<float>() + batchIndex * output->stride(0);
+                auto srcOrigin = input->host<float>() + batchIndex * input->stride(0);
                 int start    = (int)x * CONVOLUTION_TILED_NUMBER;
                 int remain   = plane - start;
                 int xC        = remain > CONVOLUTION_TILED_NUMBER ? CONVOLUTION_TILED_NUMBER : remain;
-                // Im2Col
-                ::memset(colBuffer, 0, mTempBuffer.stride(0) * sizeof(float));
-                int oyBegin = start / width;
-                int oxBegin = start % width;
-                int oyEnd = (start + xC-1) / width;
-                remain = xC;
-                auto colIndex = colBuffer;
-                for (int oy=oyBegin; oy <= oyEnd; ++oy) {
-                    int step = std::min(width - oxBegin, remain);
-                    int sySta = oy * strideY - padY;
-                    int kyStart = std::max(0, UP_DIV(-sySta, dilateY));
-                    int kyEnd = std::min(kernel_height, UP_DIV(src_height - sySta, dilateY));
-                    for (int i=0; i<step; ++i) {
-                        int ox = i + oxBegin;
-                        int sxSta = ox * strideX - padX;
-                        int kxStart = std::max(0, UP_DIV(-sxSta, dilateX));
-                        int kxEnd = std::min(kernel_width, UP_DIV(src_width - sxSta, dilateX));
-                        // ivec2 sfxy = max(ivec2(0), (UP_DIV(-s0, uConstant.dilate)));
-                        // ivec2 efxy = min(uConstant.kernelSize, UP_DIV(inputSize.xy-s0, uConstant.dilate));
-                        auto srcStart = srcOrigin + sxSta * 4 + sySta * 4 * src_width;
-                        auto dstStart = colIndex + 4 * i;
-                        for (int sz=0; sz<icC4; ++sz) {
-                            auto srcZ = srcStart + src_z_step * sz;
-                            auto dstZ = dstStart + 4 * CONVOLUTION_TILED_NUMBER * kernel_height * kernel_width * sz;
-                            for (int ky=kyStart; ky<kyEnd; ++ky) {
-                                auto sy = ky * dilateY;
-                                auto srcY = srcZ + sy * 4 * src_width;
-                                auto dstY = dstZ + 4 * CONVOLUTION_TILED_NUMBER * (ky*kernel_width);
-                                for (int kx=kxStart; kx<kxEnd; ++kx) {
-                                    auto sx = kx * dilateX;
-                                    auto srcX = srcY + sx * 4;
-                                    auto dstX = dstY + 4 * CONVOLUTION_TILED_NUMBER * kx;
-                                    Vec4::save(dstX, Vec4::load(srcX));
+                if (pointwise && xC == CONVOLUTION_TILED_NUMBER) {
+                    MNNPackC4ForMatMul_A(gemmBuffer, srcOrigin + start * 4, CONVOLUTION_TILED_NUMBER, ic, plane);
+                } else {
+                    // Im2Col
+                    ::memset(colBuffer, 0, mTempBuffer.stride(0) * sizeof(float));
+                    int oyBegin = start / width;
+                    int oxBegin = start % width;
+                    int oyEnd = (start + xC-1) / width;
+                    remain = xC;
+                    auto colIndex = colBuffer;
+                    for (int oy=oyBegin; oy <= oyEnd; ++oy) {
+                        int step = std::min(width - oxBegin, remain);
+                        int sySta = oy * strideY - padY;
+                        int kyStart = std::max(0, UP_DIV(-sySta, dilateY));
+                        int kyEnd = std::min(kernel_height, UP_DIV(src_height - sySta, dilateY));
+                        for (int i=0; i<step; ++i) {
+                            int ox = i + oxBegin;
+                            int sxSta = ox * strideX - padX;
+                            int kxStart = std::max(0, UP_DIV(-sxSta, dilateX));
+                            int kxEnd = std::min(kernel_width, UP_DIV(src_width - sxSta, dilateX));
+                            // ivec2 sfxy = max(ivec2(0), (UP_DIV(-s0, uConstant.dilate)));
+                            // ivec2 efxy = min(uConstant.kernelSize, UP_DIV(inputSize.xy-s0, uConstant.dilate));
+                            auto srcStart = srcOrigin + sxSta * 4 + sySta * 4 * src_width;
+                            auto dstStart = colIndex + 4 * i;
+                            for (int sz=0; sz<icC4; ++sz) {
+                                auto srcZ = srcStart + src_z_step * sz;
+                                auto dstZ = dstStart + 4 * CONVOLUTION_TILED_NUMBER * kernel_height * kernel_width * sz;
+                                for (int ky=kyStart; ky<kyEnd; ++ky) {
+                                    auto sy = ky * dilateY;
+                                    auto srcY = srcZ + sy * 4 * src_width;
+                                    auto dstY = dstZ + 4 * CONVOLUTION_TILED_NUMBER * (ky*kernel_width);
+                                    for (int kx=kxStart; kx<kxEnd; ++kx) {
+                                        auto sx = kx * dilateX;
+                                        auto srcX = srcY + sx * 4;
+                                        auto dstX = dstY + 4 * CONVOLUTION_TILED_NUMBER * kx;
+                                        Vec4::save(dstX, Vec4::load(srcX));
+                                    }
                                 }
                             }
                         }
+                        oxBegin = 0;
+                        remain -= step;
+                        colIndex += 4 * step;
                     }
-                    oxBegin = 0;
-                    remain -= step;
-                    colIndex += 4 * step;
-                }
 
+                    MNNPackC4ForMatMul_A(gemmBuffer, colBuffer, CONVOLUTION_TILED_NUMBER * kernelSize, ic, CONVOLUTION_TILED_NUMBER * kernelSize);
+                }
                 // GEMM
-                MNNPackC4ForMatMul_A(gemmBuffer, colBuffer, CONVOLUTION_TILED_NUMBER * kernelSize, ic, CONVOLUTION_TILED_NUMBER * kernelSize);
-                if (xC == CONVOLUTION_TILED_NUMBER) {
+                if (bf16) {
+#ifdef MNN_USE_SSE
+                    // Only the operands of the GEMM are in bfloat16, the input and output stay float
+                    auto gemmBufferBF16 = mTempBufferBF16.host<int16_t>() + mTempBufferBF16.stride(0) * tId;
+                    MNNPackedAToBF16(gemmBufferBF16, gemmBuffer, CONVOLUTION_TILED_NUMBER, L);
+                    if (xC == CONVOLUTION_TILED_NUMBER) {
+                        MNNPackedMatMulBF16(dstOrigin + start * 4, gemmBufferBF16, weightBF16, parameters.data(), postParameters.data(), biasPtr);
+                    } else {
+                        MNNPackedMatMulRemainBF16(dstOrigin + start * 4, gemmBufferBF16, weightBF16, xC, parameters.data(), postParameters.data(), biasPtr);
+                    }
+#endif
+                } else if (xC == CONVOLUTION_TILED_NUMBER) {
                     MNNPackedMatMul(dstOrigin + start * 4, gemmBuffer, weightPtr, parameters.data(), cachePtr, postParameters.data(), biasPtr);
                 } else {
                     MNNPackedMatMulRemain(dstOrigin + start * 4, gemmBuffer, weightPtr, xC, parameters.data(), cachePtr, postParameters.data(), biasPtr);
@@ -266,6 +343,7 @@ ErrorCode ConvolutionTiledExecutorBasic::onResize(const std::vector<Tensor*>& in
 
 ErrorCode ConvolutionTiledExecutorBasic::onExecute(const std::vector<Tensor*>& inputs,
                                                    const std::vector<Tensor*>& outputs) {
+    mCounter->reset();
     MNN_CONCURRENCY_BEGIN(tId, mFunction.first) {
         mFunction.second((int)tId);
     }
@@ -13,6 +13,7 @@
 #include "backend/cpu/CPUConvolution.hpp"
 // Tiled Slide Window or Im2Col + GEMM
 namespace MNN {
+class ConcurrencyCounter;
 class ConvolutionTiledExecutorBasic : public CPUConvolution {
 public:
     ConvolutionTiledExecutorBasic(const Convolution2DCommon *common, Backend *b) : CPUConvolution(common, b) {
@@ -24,7 +25,11 @@ public:
 protected:
     Tensor mTempBuffer;
     Tensor mTempBufferTranspose;
+    // The packed A in bfloat16 if the weight is, see MNNPackedMatMulBF16
+    Tensor mTempBufferBF16;
     std::pair<int, std::function<void(int)>> mFunction;
+    // Tiles taken by the threads of mFunction
+    std::shared_ptr<ConcurrencyCounter> mCounter;
 };
 class ConvolutionTiledExecutorMultiInput : public Execution {
 public:
@@ -46,18 +51,22 @@ class ConvolutionTiledExecutor : public Execution {
 public:
     ConvolutionTiledExecutor(const Convolution2DCommon *common, Backend *b, const float *originWeight,
                              size_t originWeightSize, const float *bias, size_t biasSize);
+    ConvolutionTiledExecutor(std::shared_ptr<CPUConvolution::Resource> res, const Convolution2DCommon *common, Backend *b);
     virtual ~ConvolutionTiledExecutor();
+    std::shared_ptr<CPUConvolution::Resource> resource() const {
+        return mResource;
+    }
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override {
         return mProxy->onExecute(inputs, outputs);
     }
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override {
-        mInputs = {inputs[0], mWeight.get(), mBias.get()};
+        mInputs = {inputs[0], mResource->mWeight.get(), mResource->mBias.get()};
         return mProxy->onResize(mInputs, outputs);
     }
+    virtual bool onClone(Backend *bn, const Op *op, Execution **dst) override;
 
 protected:
-    std::shared_ptr<Tensor> mWeight;
-    std::shared_ptr<Tensor> mBias;
+    std::shared_ptr<CPUConvolution::Resource> mResource;
     std::shared_ptr<ConvolutionTiledExecutorBasic> mProxy;
     std::vector<Tensor *> mInputs;
 };
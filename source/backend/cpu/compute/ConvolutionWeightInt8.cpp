@@ -0,0 +1,213 @@
+//
+//  ConvolutionWeightInt8.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/compute/ConvolutionWeightInt8.hpp"
+#include <string.h>
+#include <algorithm>
+#include "backend/cpu/CPUBackend.hpp"
+#include "backend/cpu/compute/CommonOptFunction.h"
+#include "core/Concurrency.h"
+#include "core/ConvolutionCommon.hpp"
+#include "core/Macro.h"
+
+// Floats of the weight dequantized at once by a thread, about the size of L2
+#define MNN_WEIGHT_INT8_TILE (32 * 1024)
+
+namespace MNN {
+// Channels of a tile, aligned to both hP of the packed weight and 4 of the output
+static int _tileUnit(int hP) {
+    int unit = hP;
+    while (unit % 4 != 0) {
+        unit += hP;
+    }
+    return unit;
+}
+
+ConvolutionWeightInt8::ConvolutionWeightInt8(const Convolution2DCommon *common, Backend *b, const IDSTQuan *quan,
+                                             const float *bias, size_t biasSize)
+    : CPUConvolution(common, b) {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    // The weight is packed and dequantized as [h / hP, l, hP], the B of MNNPackedMatMul only when lP is 1
+    MNN_ASSERT(lP == 1);
+    const int h      = (int)biasSize;
+    const int l      = quan->buffer()->size() / h;
+    const int hPad   = ROUND_UP(UP_DIV(h, hP) * hP, 4);
+    mResource.reset(new CPUConvolution::Resource);
+    mResource->backend = b;
+    mResource->mWeight.reset(Tensor::createDevice<int8_t>({UP_DIV(h, hP), l, hP}));
+    mResource->mScale.reset(Tensor::createDevice<float>({2, hPad}));
+    mResource->mBias.reset(Tensor::createDevice<float>({ROUND_UP(h, 4)}));
+    mValid = b->onAcquireBuffer(mResource->mWeight.get(), Backend::STATIC) &&
+             b->onAcquireBuffer(mResource->mScale.get(), Backend::STATIC) &&
+             b->onAcquireBuffer(mResource->mBias.get(), Backend::STATIC);
+    if (!mValid) {
+        MNN_ERROR("Not Enough Memory\n");
+        return;
+    }
+    auto weight = mResource->mWeight->host<int8_t>();
+    auto source = quan->buffer()->data();
+    ::memset(weight, 0, mResource->mWeight->size());
+    for (int y = 0; y < h; ++y) {
+        auto dst = weight + (y / hP) * hP * l + (y % hP);
+        auto src = source + y * l;
+        for (int x = 0; x < l; ++x) {
+            dst[x * hP] = src[x];
+        }
+    }
+    // The padding has zero scale and min, so that its weight is zero
+    auto scale = mResource->mScale->host<float>();
+    ::memset(scale, 0, mResource->mScale->size());
+    auto minAndScale = quan->alpha()->data();
+    for (int y = 0; y < h; ++y) {
+        scale[y]        = minAndScale[2 * y + 1];
+        scale[hPad + y] = minAndScale[2 * y];
+    }
+    ::memset(mResource->mBias->host<float>(), 0, mResource->mBias->size());
+    ::memcpy(mResource->mBias->host<float>(), bias, h * sizeof(float));
+}
+
+ConvolutionWeightInt8::ConvolutionWeightInt8(std::shared_ptr<CPUConvolution::Resource> resource,
+                                             const Convolution2DCommon *common, Backend *b)
+    : CPUConvolution(common, b) {
+    mResource = resource;
+}
+
+bool ConvolutionWeightInt8::canUse(const Op *op, const Tensor *input, const Tensor *output) {
+    auto conv2d = op->main_as_Convolution2D();
+    auto quan   = conv2d->quanParameter();
+    auto common = conv2d->common();
+    if (nullptr == quan || 4 != quan->type() || nullptr == conv2d->bias()) {
+        return false;
+    }
+    if (common->kernelX() != 1 || common->kernelY() != 1 || common->strideX() != 1 || common->strideY() != 1 ||
+        common->group() != 1) {
+        return false;
+    }
+    auto pads = ConvolutionCommon::convolutionPad(input, output, common);
+    if (pads.first != 0 || pads.second != 0) {
+        return false;
+    }
+    const int h = conv2d->bias()->size();
+    return h > 0 && quan->aMax() == h && nullptr != quan->alpha() && quan->alpha()->size() == 2 * h &&
+           quan->buffer()->size() == h * input->channel();
+}
+
+bool ConvolutionWeightInt8::onClone(Backend *bn, const Op *op, Execution **dst) {
+    if (!mValid) {
+        return false;
+    }
+    if (nullptr == dst) {
+        return true;
+    }
+    *dst = new ConvolutionWeightInt8(mResource, op->main_as_Convolution2D()->common(), bn);
+    return true;
+}
+
+ErrorCode ConvolutionWeightInt8::onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
+    CPUConvolution::onResize(inputs, outputs);
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    auto input       = inputs[0];
+    auto output      = outputs[0];
+    int numberThread = static_cast<CPUBackend *>(backend())->threadNumber();
+    const int e      = output->width() * output->height();
+    const int l      = input->channel();
+    const int h      = output->channel();
+    const int unit   = _tileUnit(hP);
+    // Large enough tiles for the reuse of the packed A, and enough tiles for the threads
+    mTileH = std::max(unit, MNN_WEIGHT_INT8_TILE / std::max(l, 1) / unit * unit);
+    mTileH = std::min(mTileH, ROUND_UP(UP_DIV(h, numberThread), unit));
+    // The cache of MNNPackedMatMul, see StrassenMatrixComputor
+    mCacheSize = 0;
+    if (hP % 4 != 0) {
+        mCacheSize = eP * MNNGetC4DivNumber(hP) * 4 + UP_DIV(mTileH, 4) * eP * 4;
+    }
+    mPackedA.reset(Tensor::createDevice<float>({UP_DIV(e, eP), l, eP}));
+    mTileBuffer.reset(Tensor::createDevice<float>({numberThread, UP_DIV(mTileH, hP) * hP * l + mCacheSize}));
+    bool success = backend()->onAcquireBuffer(mPackedA.get(), Backend::DYNAMIC) &&
+                   backend()->onAcquireBuffer(mTileBuffer.get(), Backend::DYNAMIC);
+    if (!success) {
+        return OUT_OF_MEMORY;
+    }
+    backend()->onReleaseBuffer(mPackedA.get(), Backend::DYNAMIC);
+    backend()->onReleaseBuffer(mTileBuffer.get(), Backend::DYNAMIC);
+    return NO_ERROR;
+}
+
+ErrorCode ConvolutionWeightInt8::onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    auto input         = inputs[0];
+    auto output        = outputs[0];
+    int numberThread   = static_cast<CPUBackend *>(backend())->threadNumber();
+    const int e        = output->width() * output->height();
+    const int l        = input->channel();
+    const int h        = output->channel();
+    const int eTiles   = UP_DIV(e, eP);
+    const int hTiles   = UP_DIV(h, mTileH);
+    const int hPad     = mResource->mScale->length(1);
+    const int tileSize = mTileBuffer->length(1);
+    auto weight        = mResource->mWeight->host<int8_t>();
+    auto scale         = mResource->mScale->host<float>();
+    auto bias          = mResource->mBias->host<float>();
+    auto packedA       = mPackedA->host<float>();
+    auto postParameters = getPostParameters();
+    for (int b = 0; b < input->batch(); ++b) {
+        auto src = input->host<float>() + b * UP_DIV(l, 4) * e * 4;
+        auto dst = output->host<float>() + b * UP_DIV(h, 4) * e * 4;
+        MNN_CONCURRENCY_BEGIN(tId, numberThread) {
+            for (int t = (int)tId; t < eTiles; t += numberThread) {
+                MNNPackC4ForMatMul_A(packedA + t * eP * l, src + 4 * t * eP, std::min(eP, e - t * eP), l, e);
+            }
+        }
+        MNN_CONCURRENCY_END();
+        MNN_CONCURRENCY_BEGIN(tId, numberThread) {
+            auto tile  = mTileBuffer->host<float>() + tId * tileSize;
+            auto cache = tile + UP_DIV(mTileH, hP) * hP * l;
+            for (int c = (int)tId; c < hTiles; c += numberThread) {
+                const int hStart = c * mTileH;
+                const int hCount = std::min(mTileH, h - hStart);
+                const int blocks = UP_DIV(hCount, hP);
+                // Dequantize the blocks of hP channels of the tile, (q + 128) * scale + min
+                auto tileWeight = weight + hStart * l;
+                auto tileScale  = scale + hStart;
+                auto tileMin    = scale + hPad + hStart;
+                for (int k = 0; k < blocks; ++k) {
+                    auto srcK   = tileWeight + k * hP * l;
+                    auto dstK   = tile + k * hP * l;
+                    auto scaleK = tileScale + k * hP;
+                    auto minK   = tileMin + k * hP;
+                    for (int x = 0; x < l; ++x) {
+                        for (int j = 0; j < hP; ++j) {
+                            dstK[x * hP + j] = ((float)srcK[x * hP + j] + 128.0f) * scaleK[j] + minK[j];
+                        }
+                    }
+                }
+                // The same as RNNMatMul, the padding of the last C4 plane is computed with zero weights
+                const size_t hCompute = std::min(ROUND_UP(hCount, 4), blocks * hP);
+                for (int t = 0; t < eTiles; ++t) {
+                    int count = std::min(eP, e - t * eP);
+                    // parameters: e, l, h, CStride, hRemain, BExtraStride
+                    size_t parameters[6] = {count * sizeof(float), (size_t)l, hCompute, e * 4 * sizeof(float), 0, 0};
+                    auto C = dst + hStart * e + 4 * t * eP;
+                    auto A = packedA + t * eP * l;
+                    if (count == eP) {
+                        MNNPackedMatMul(C, A, tile, parameters, cache, postParameters.data(), bias + hStart);
+                    } else {
+                        MNNPackedMatMulRemain(C, A, tile, count, parameters, cache, postParameters.data(),
+                                              bias + hStart);
+                    }
+                }
+            }
+        }
+        MNN_CONCURRENCY_END();
+    }
+    return NO_ERROR;
+}
+} // namespace MNN
@@ -0,0 +1,45 @@
+//
+//  ConvolutionWeightInt8.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef ConvolutionWeightInt8_hpp
+#define ConvolutionWeightInt8_hpp
+
+#include "backend/cpu/CPUConvolution.hpp"
+namespace MNN {
+/**
+ * 1x1 convolution of the weight-only int8 quantization (IDSTQuan of type 4), whose weight is
+ * (q + 128) * scale + min per output channel. The int8 weight is kept in the packed B layout of MNNPackedMatMul, and
+ * dequantized to float by tiles of output channels fitting in L2 right before they are used, so that the weight takes
+ * a quarter of the memory of the float one both in RAM and in bandwidth.
+ */
+class ConvolutionWeightInt8 : public CPUConvolution {
+public:
+    ConvolutionWeightInt8(const Convolution2DCommon *common, Backend *b, const IDSTQuan *quan, const float *bias,
+                          size_t biasSize);
+    ConvolutionWeightInt8(std::shared_ptr<CPUConvolution::Resource> resource, const Convolution2DCommon *common,
+                          Backend *b);
+    virtual ~ConvolutionWeightInt8() = default;
+
+    // Whether the convolution of op with the shape of input and output can use it
+    static bool canUse(const Op *op, const Tensor *input, const Tensor *output);
+
+    virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
+    virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
+    virtual bool onClone(Backend *bn, const Op *op, Execution **dst) override;
+
+private:
+    // mWeight : int8 of [UP_DIV(oc, hP), ic, hP], mScale : [2, ROUND_UP(oc, 4)] of scale and min
+    std::shared_ptr<CPUConvolution::Resource> mResource;
+    int mTileH = 0;
+    int mCacheSize = 0;
+    std::shared_ptr<Tensor> mPackedA;
+    std::shared_ptr<Tensor> mTileBuffer;
+};
+} // namespace MNN
+
+#endif /* ConvolutionWeightInt8_hpp */
@@ -28,32 +28,80 @@ ConvolutionWinograd::ConvolutionWinograd(const Convolution2DCommon *convOp, cons
                                          Backend *b, const float *originWeight, size_t originWeightSize,
                                          const float *bias, size_t biasSize, int unit)
     : MNN::CPUConvolution(convOp, b) {
-    mBias.reset(Tensor::createDevice<float>({ALIGN_UP4((int)biasSize)}));
-    mValid = backend()->onAcquireBuffer(mBias.get(), Backend::STATIC);
+    mResource.reset(new CPUConvolution::Resource);
+    mResource->backend = b;
+    mResource->mBias.reset(Tensor::createDevice<float>({ALIGN_UP4((int)biasSize)}));
+    mValid = backend()->onAcquireBuffer(mResource->mBias.get(), Backend::STATIC);
     if (!mValid) {
         return;
     }
 
-    ::memset(mBias->host<float>(), 0, mBias->size());
-    ::memcpy(mBias->host<float>(), bias, biasSize * sizeof(float));
-    mTempBuffer.buffer().type         = halide_type_of<float>();
-    mTransformMidBuffer.buffer().type = halide_type_of<float>();
+    ::memset(mResource->mBias->host<float>(), 0, mResource->mBias->size());
+    ::memcpy(mResource->mBias->host<float>(), bias, biasSize * sizeof(float));
     MNN_ASSERT(mCommon->kernelX() == mCommon->kernelY());
 
-    int threadNumber = ((CPUBackend *)backend())->threadNumber();
-
     auto kernelSize = mCommon->kernelY();
     WinogradGenerater generator(unit, kernelSize, 1, true);
 
     int alpha        = unit + kernelSize - 1;
-    int alpha2       = alpha * alpha;
     mSourceTransform = WinogradFunction::chooseSourceTransform(alpha, alpha);
     mDestTransform   = WinogradFunction::chooseDestTransform(alpha, unit);
 
-    int srcCount                       = input->channel();
-    int outputCount                    = output->channel();
-    auto ic4 = UP_DIV(srcCount, 4);
-    auto oc4 = UP_DIV(outputCount, 4);
+    mSrcCount    = input->channel();
+    mOutputCount = output->channel();
+    int ePack, hPack, lPack;
+    MNNGetMatMulPackMode(&ePack, &lPack, &hPack);
+    _initBuffer(alpha);
+    mA = generator.A();
+    mB = generator.B();
+    
+
+    // Transform Kernel
+    auto G = generator.G();
+    std::shared_ptr<Tensor> sourceWeight(Tensor::create<float>(
+        std::vector<int>{mOutputCount, mSrcCount, kernelSize, kernelSize}, (void *)originWeight, Tensor::CAFFE));
+    mResource->mWeight = generator.allocTransformWeight(sourceWeight.get(), 1, hPack, false);
+    mValid  = backend()->onAcquireBuffer(mResource->mWeight.get(), Backend::STATIC);
+    if (!mValid) {
+        return;
+    }
+    generator.transformWeight(mResource->mWeight.get(), sourceWeight.get());
+}
+ConvolutionWinograd::ConvolutionWinograd(std::shared_ptr<CPUConvolution::Resource> resource,
+                                         const Convolution2DCommon *convOp, const Tensor *input, const Tensor *output,
+                                         Backend *b, int unit)
+    : MNN::CPUConvolution(convOp, b) {
+    mResource = resource;
+    auto kernelSize = mCommon->kernelY();
+    WinogradGenerater generator(unit, kernelSize, 1, true);
+    int alpha        = unit + kernelSize - 1;
+    mSourceTransform = WinogradFunction::chooseSourceTransform(alpha, alpha);
+    mDestTransform   = WinogradFunction::chooseDestTransform(alpha, unit);
+    mSrcCount        = input->channel();
+    mOutputCount     = output->channel();
+    _initBuffer(alpha);
+    mA = generator.A();
+    mB = generator.B();
+}
+ConvolutionWinograd::ConvolutionWinograd(const ConvolutionWinograd *origin, const Convolution2DCommon *convOp,
+                                         Backend *b)
+    : MNN::CPUConvolution(convOp, b) {
+    mResource        = origin->mResource;
+    mA               = origin->mA;
+    mB               = origin->mB;
+    mSrcCount        = origin->mSrcCount;
+    mOutputCount     = origin->mOutputCount;
+    mSourceTransform = origin->mSourceTransform;
+    mDestTransform   = origin->mDestTransform;
+    _initBuffer(mA->length(0));
+}
+void ConvolutionWinograd::_initBuffer(int alpha) {
+    mTempBuffer.buffer().type         = halide_type_of<float>();
+    mTransformMidBuffer.buffer().type = halide_type_of<float>();
+    int threadNumber = ((CPUBackend *)backend())->threadNumber();
+    int alpha2       = alpha * alpha;
+    auto ic4 = UP_DIV(mSrcCount, 4);
+    auto oc4 = UP_DIV(mOutputCount, 4);
     int ePack, hPack, lPack;
     MNNGetMatMulPackMode(&ePack, &lPack, &hPack);
     if (hPack % 4 != 0) {
@@ -82,28 +130,19 @@ ConvolutionWinograd::ConvolutionWinograd(const Convolution2DCommon *convOp, cons
     mGemmMidBuffer.buffer().dim[1].extent = ePack * ic4 * 4;
     mGemmMidBuffer.buffer().dimensions = 2;
     TensorUtils::setLinearLayout(&mGemmMidBuffer);
-    mA = generator.A();
-    mB = generator.B();
-    
-
-    // Transform Kernel
-    auto G = generator.G();
-    std::shared_ptr<Tensor> sourceWeight(Tensor::create<float>(
-        std::vector<int>{outputCount, srcCount, kernelSize, kernelSize}, (void *)originWeight, Tensor::CAFFE));
-    mWeight = generator.allocTransformWeight(sourceWeight.get(), 1, hPack, false);
-    mValid  = backend()->onAcquireBuffer(mWeight.get(), Backend::STATIC);
-    if (!mValid) {
-        return;
-    }
-    generator.transformWeight(mWeight.get(), sourceWeight.get());
 }
 ConvolutionWinograd::~ConvolutionWinograd() {
-    if (nullptr != mBias) {
-        backend()->onReleaseBuffer(mBias.get(), Backend::STATIC);
+    // Do nothing
+}
+bool ConvolutionWinograd::onClone(Backend *bn, const Op *op, Execution **dst) {
+    if (!mValid) {
+        return false;
     }
-    if (nullptr != mWeight) {
-        backend()->onReleaseBuffer(mWeight.get(), Backend::STATIC);
+    if (nullptr == dst) {
+        return true;
     }
+    *dst = new ConvolutionWinograd(this, op->main_as_Convolution2D()->common(), bn);
+    return true;
 }
 ErrorCode ConvolutionWinograd::onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) {
     auto input   = inputs[0];
@@ -152,8 +191,8 @@ ErrorCode ConvolutionWinograd::onExecute(const std::vector<Tensor *> &inputs, co
         auto srcOrigin = input->host<float>() + batchIndex * input->stride(0);
         auto dstOrigin = output->host<float>() + batchIndex * output->stride(0);
 
-        auto weight    = mWeight->host<float>();
-        auto bias      = mBias->host<float>();
+        auto weight    = mResource->mWeight->host<float>();
+        auto bias      = mResource->mBias->host<float>();
         auto tFunction = [&](int tId) {
             auto _srcOrigin = mTempBuffer.host<float>() + tId * mTempBuffer.stride(0);
             auto gemmBuffer = mGemmMidBuffer.host<float>() + tId * mGemmMidBuffer.stride(0);
@@ -240,12 +279,12 @@ ErrorCode ConvolutionWinograd::onExecute(const std::vector<Tensor *> &inputs, co
                 if (xC == ePack) {
                     for (int i = 0; i < srcUnit2; ++i) {
                         MNNPackC4ForMatMul_A(gemmBuffer, _srcOrigin + i * ic_4 * 4 * xC, ePack, ic_4 * 4, ePack);
-                        MNNPackedMatMul(_dstOrigin + i * dc_4 * 4 * xC, gemmBuffer, weight + i * mWeight->stride(0), parameters.data(), cache, nullptr, nullptr);
+                        MNNPackedMatMul(_dstOrigin + i * dc_4 * 4 * xC, gemmBuffer, weight + i * mResource->mWeight->stride(0), parameters.data(), cache, nullptr, nullptr);
                     }
                 } else {
                     for (int i = 0; i < srcUnit2; ++i) {
                         MNNPackC4ForMatMul_A(gemmBuffer, _srcOrigin + i * ic_4 * 4 * xC, xC, ic_4 * 4, xC);
-                        MNNPackedMatMulRemain(_dstOrigin + i * dc_4 * 4 * xC, gemmBuffer, weight + i * mWeight->stride(0), xC, parametersRemain.data(), cache, nullptr, nullptr);
+                        MNNPackedMatMulRemain(_dstOrigin + i * dc_4 * 4 * xC, gemmBuffer, weight + i * mResource->mWeight->stride(0), xC, parametersRemain.data(), cache, nullptr, nullptr);
                     }
                 }
 #ifndef MNN_WINO_TRANFORM_TEST_CLOSE
@@ -19,19 +19,30 @@ public:
     ConvolutionWinograd(const Convolution2DCommon *convOp, const Tensor *input, const Tensor *output, Backend *b,
                         const float *originWeight, size_t originWeightSize, const float *bias, size_t biasSize,
                         int unit);
+    /** use the transformed weight in resource */
+    ConvolutionWinograd(std::shared_ptr<CPUConvolution::Resource> resource, const Convolution2DCommon *convOp,
+                        const Tensor *input, const Tensor *output, Backend *b, int unit);
     virtual ~ConvolutionWinograd();
+    std::shared_ptr<CPUConvolution::Resource> resource() const {
+        return mResource;
+    }
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
     virtual ErrorCode onResize(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) override;
+    virtual bool onClone(Backend *bn, const Op *op, Execution **dst) override;
 
     static bool canUseWinograd(const Convolution2DCommon *convOp);
     static int bestWinogradUnit(const Convolution2DCommon *convOp, const Tensor *input, const Tensor *output,
                                 int threadnumber);
 
 private:
-    std::shared_ptr<Tensor> mBias;
+    ConvolutionWinograd(const ConvolutionWinograd *origin, const Convolution2DCommon *convOp, Backend *b);
+    void _initBuffer(int alpha);
+
+    std::shared_ptr<CPUConvolution::Resource> mResource;
     std::shared_ptr<Tensor> mA;
     std::shared_ptr<Tensor> mB;
-    std::shared_ptr<Tensor> mWeight;
+    int mSrcCount;
+    int mOutputCount;
 
     Tensor mTempBuffer;
     Tensor mTransformMidBuffer;
@@ -21,6 +21,7 @@ int8_t MNNInt32ToInt8(int data, int bias, float scale, float maxValue, float min
     return static_cast<int8_t>(roundf(value));
 }
 
+#ifndef MNN_USE_SSE
 void MNNGemmInt8toFloat32_8x4_Unit(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
                                    size_t dst_step, size_t dst_depth_quad) {
     MNNGemmInt8toFloat32_8x4_Common(dst, src, weight, src_depth_quad, DST_XUNIT, dst_step, dst_depth_quad);
@@ -33,8 +34,8 @@ void MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t
         auto dst_z     = dst + dz * dst_step;
         for (int w = 0; w < width; ++w) {
             auto dst_x     = dst_z + 4 * w;
-            float dst_4[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-            auto src_x     = src + 8 * w;
+            int32_t dst_4[4] = {0, 0, 0, 0};
+            auto src_x       = src + 8 * w;
             for (int sz = 0; sz < src_depth_quad; ++sz) {
                 auto weight_sz = weight_dz + 32 * sz;
                 auto src_z     = src_x + sz * width * 8;
@@ -46,12 +47,11 @@ void MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t
                 }
             }
             for (int j = 0; j < 4; ++j) {
-                dst_x[j] = dst_4[j];
+                dst_x[j] = (float)dst_4[j];
             }
         }
     }
 }
-#ifndef MNN_USE_SSE
 void MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad, size_t dst_step,
                                               size_t dst_depth_quad, const QuanPostTreatParameters* post) {
     const auto dst_step_tmp = dst_step / sizeof(int8_t);
@@ -84,6 +84,11 @@ void MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int
     }
 }
 #endif
+#ifndef MNN_USE_SSE
+int MNNGetInt8GemmSrcOffset() {
+    return 0;
+}
+#endif
 void MNNGemmInt8AddBiasScale_16x4_Unit_FAST(int8_t* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad, size_t dst_step, size_t dst_depth_quad, const QuanPostTreatParameters* post) {
     return MNNGemmInt8AddBiasScale_16x4_Unit(dst, src, weight, src_depth_quad, dst_step, dst_depth_quad, post);
 }
@@ -68,6 +68,9 @@ struct QuanPostTreatParameters {
 };
 void MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad, size_t dst_step, size_t dst_depth_quad, const QuanPostTreatParameters* post);
 void MNNGemmInt8AddBiasScale_16x4_Unit_FAST(int8_t* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad, size_t dst_step, size_t dst_depth_quad, const QuanPostTreatParameters* post);
+// The offset added to the int8 source by MNNGemmInt8AddBiasScale_16x4_Unit, which is 128 for the uint8 x int8 dot
+// product of VNNI. The caller must subtract offset * (sum of the weights of the output channel) from the bias.
+int MNNGetInt8GemmSrcOffset();
 
 #if defined(__aarch64__) && defined(ENABLE_ARMV82)
 void MNNGemmInt8AddBiasScale_ARMV82_Unit(int8_t* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad, size_t dst_step, size_t dst_depth_quad, size_t realDstCount, const QuanPostTreatParameters* parameters);
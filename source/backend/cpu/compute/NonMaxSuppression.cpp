@@ -0,0 +1,120 @@
+//
+//  NonMaxSuppression.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/compute/NonMaxSuppression.hpp"
+#include <algorithm>
+#include "core/Macro.h"
+#include "math/Vec.hpp"
+
+// Candidates are sorted by chunks of at least so many, most of them are never visited when maxOutput is small
+#define MNN_NMS_CHUNK 64
+// Coordinates of the empty slots of the selected boxes, which never intersect a candidate
+#define MNN_NMS_FAR 1e30f
+
+namespace MNN {
+using Vec4 = MNN::Math::Vec<float, 4>;
+
+namespace {
+// The selected boxes in SoA, padded by empty slots to a multiple of 4
+class SelectedBoxes {
+public:
+    SelectedBoxes(int capacity) {
+        auto size = ROUND_UP(capacity, 4);
+        for (int i = 0; i < 2; ++i) {
+            mMin[i].resize(size, MNN_NMS_FAR);
+            mMax[i].resize(size, -MNN_NMS_FAR);
+        }
+        mArea.resize(size, 0.0f);
+    }
+    // A box of zero area leaves an empty slot
+    void add(const float* box, float area) {
+        if (area > 0.0f) {
+            mMin[0][mSize] = box[0];
+            mMin[1][mSize] = box[1];
+            mMax[0][mSize] = box[2];
+            mMax[1][mSize] = box[3];
+            mArea[mSize]   = area;
+        }
+        mSize++;
+    }
+    // box is normalized as [min0, min1, max0, max1]
+    bool suppress(const float* box, float area, float iouThreshold) const {
+        // iou > t is inter > t * (area + areaK - inter), union is positive
+        Vec4 min0(box[0]), min1(box[1]), max0(box[2]), max1(box[3]);
+        Vec4 zero(0.0f);
+        Vec4 scale(1.0f + iouThreshold);
+        Vec4 bias(area);
+        float diff[4];
+        // Overlapping boxes are likely to be selected recently, start from the last ones
+        for (int i = ROUND_UP(mSize, 4) - 4; i >= 0; i -= 4) {
+            auto h     = Vec4::max(Vec4::min(max0, Vec4::load(mMax[0].data() + i)) -
+                                       Vec4::max(min0, Vec4::load(mMin[0].data() + i)), zero);
+            auto w     = Vec4::max(Vec4::min(max1, Vec4::load(mMax[1].data() + i)) -
+                                       Vec4::max(min1, Vec4::load(mMin[1].data() + i)), zero);
+            auto inter = h * w;
+            Vec4::save(diff, inter * scale - (bias + Vec4::load(mArea.data() + i)) * iouThreshold);
+            if (diff[0] > 0.0f || diff[1] > 0.0f || diff[2] > 0.0f || diff[3] > 0.0f) {
+                return true;
+            }
+        }
+        return false;
+    }
+    int size() const {
+        return mSize;
+    }
+
+private:
+    int mSize = 0;
+    std::vector<float> mMin[2];
+    std::vector<float> mMax[2];
+    std::vector<float> mArea;
+};
+} // namespace
+
+void NonMaxSuppression(const float* boxes, const float* scores, int number, int maxOutput, float iouThreshold,
+                       float scoreThreshold, std::vector<int>& selected) {
+    MNN_ASSERT(iouThreshold >= 0.0f && iouThreshold <= 1.0f);
+    std::vector<int> candidates;
+    candidates.reserve(number);
+    for (int i = 0; i < number; ++i) {
+        if (scores[i] > scoreThreshold) {
+            candidates.emplace_back(i);
+        }
+    }
+    const int candidateNumber = (int)candidates.size();
+    maxOutput                 = ALIMIN(maxOutput, candidateNumber);
+    if (maxOutput <= 0) {
+        return;
+    }
+    auto greater = [scores](int i, int j) { return scores[i] > scores[j] || (scores[i] == scores[j] && i < j); };
+    SelectedBoxes kept(maxOutput);
+    int sorted = 0;
+    for (int c = 0; c < candidateNumber && kept.size() < maxOutput; ++c) {
+        if (c == sorted) {
+            // Take the next top candidates, enough for the remaining outputs if none is suppressed
+            auto chunk = ALIMIN(ALIMAX(2 * (maxOutput - kept.size()), MNN_NMS_CHUNK), candidateNumber - sorted);
+            auto begin = candidates.begin() + sorted;
+            if (sorted + chunk < candidateNumber) {
+                std::nth_element(begin, begin + chunk, candidates.end(), greater);
+            }
+            std::sort(begin, begin + chunk, greater);
+            sorted += chunk;
+        }
+        auto index   = candidates[c];
+        auto src     = boxes + 4 * index;
+        float box[4] = {std::min(src[0], src[2]), std::min(src[1], src[3]), std::max(src[0], src[2]),
+                        std::max(src[1], src[3])};
+        float area   = (box[2] - box[0]) * (box[3] - box[1]);
+        if (area > 0.0f && kept.suppress(box, area, iouThreshold)) {
+            continue;
+        }
+        kept.add(box, area);
+        selected.emplace_back(index);
+    }
+}
+} // namespace MNN
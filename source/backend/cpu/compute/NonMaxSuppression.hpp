@@ -0,0 +1,32 @@
+//
+//  NonMaxSuppression.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef NonMaxSuppression_hpp
+#define NonMaxSuppression_hpp
+
+#include <vector>
+
+namespace MNN {
+/**
+ * @brief greedy non max suppression of one class, shared by NonMaxSuppressionV2, DetectionOutput and
+ * DetectionPostProcess. Candidates are visited from the highest score (the lower index first for the same score), one
+ * is selected if its IoU with every selected box is not above iouThreshold. A box of zero area is never suppressed and
+ * never suppresses others.
+ * @param boxes : float*, shape is [number, 4], two corners of each box as [y0, x0, y1, x1] or [x0, y0, x1, y1]
+ * @param scores : float*, length is [number]
+ * @param number : int number of boxes
+ * @param maxOutput : int output at most maxOutput boxes
+ * @param iouThreshold : float
+ * @param scoreThreshold : float only the boxes of scores above it are candidates
+ * @param selected : std::vector<int32_t>&, the indices of the selected boxes are appended from the highest score
+ */
+void NonMaxSuppression(const float* boxes, const float* scores, int number, int maxOutput, float iouThreshold,
+                       float scoreThreshold, std::vector<int>& selected);
+} // namespace MNN
+
+#endif /* NonMaxSuppression_hpp */
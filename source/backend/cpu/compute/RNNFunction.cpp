@@ -0,0 +1,79 @@
+//
+//  RNNFunction.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/compute/RNNFunction.hpp"
+#include <string.h>
+#include <algorithm>
+#include <limits>
+#include "backend/cpu/compute/CommonOptFunction.h"
+#include "core/Macro.h"
+
+namespace MNN {
+
+RNNMatMul::RNNMatMul(const float* B, const float* bias, int l, int h, bool transpose) : mL(l), mH(h) {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    mPackedB.resize(UP_DIV(h, hP) * hP * ROUND_UP(l, lP));
+    MNNPackForMatMul_B(mPackedB.data(), B, h, l, transpose);
+    // The kernels read the bias by C4
+    mBias.resize(ROUND_UP(h, 4), 0.0f);
+    if (nullptr != bias) {
+        ::memcpy(mBias.data(), bias, h * sizeof(float));
+    }
+}
+
+int RNNMatMul::cacheSize(int l, int h) {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    int size = UP_DIV(l, 4) * 4 * eP;
+    if (hP % 4 != 0) {
+        size += eP * MNNGetC4DivNumber(hP) * 4 + UP_DIV(h, 4) * eP * 4;
+    }
+    return size;
+}
+
+void RNNMatMul::compute(float* C, const float* A, int eStart, int e, int eStride, float* cache) const {
+    int eP, lP, hP;
+    MNNGetMatMulPackMode(&eP, &lP, &hP);
+    auto packA       = cache;
+    auto matmulCache = cache + UP_DIV(mL, 4) * 4 * eP;
+    const float postParameters[] = {1.0f, 1.0f, -std::numeric_limits<float>().max(),
+                                    std::numeric_limits<float>().max()};
+    // The same as StrassenMatrixComputor, the padding of the last C4 plane is computed with zero weights
+    const size_t h = std::min(ROUND_UP(mH, 4), UP_DIV(mH, hP) * hP);
+    for (int x = eStart; x < eStart + e; x += eP) {
+        int count = std::min(eP, eStart + e - x);
+        // parameters: e, l, h, CStride, hRemain, BExtraStride
+        size_t parameters[6] = {count * sizeof(float), (size_t)mL, h, eStride * 4 * sizeof(float), 0, 0};
+        MNNPackC4ForMatMul_A(packA, A + 4 * x, count, mL, eStride);
+        if (count == eP) {
+            MNNPackedMatMul(C + 4 * x, packA, mPackedB.data(), parameters, matmulCache, postParameters,
+                            mBias.data());
+        } else {
+            MNNPackedMatMulRemain(C + 4 * x, packA, mPackedB.data(), count, parameters, matmulCache, postParameters,
+                                  mBias.data());
+        }
+    }
+}
+
+std::vector<float> RNNPadGates(const float* weight, int gates, int size, int other, bool rows) {
+    const int sizePad = ROUND_UP(size, 4);
+    std::vector<float> result(gates * sizePad * other, 0.0f);
+    for (int g = 0; g < gates; ++g) {
+        if (rows) {
+            ::memcpy(result.data() + g * sizePad * other, weight + g * size * other, size * other * sizeof(float));
+            continue;
+        }
+        for (int i = 0; i < other; ++i) {
+            ::memcpy(result.data() + i * gates * sizePad + g * sizePad, weight + i * gates * size + g * size,
+                     size * sizeof(float));
+        }
+    }
+    return result;
+}
+} // namespace MNN
@@ -0,0 +1,63 @@
+//
+//  RNNFunction.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef RNNFunction_hpp
+#define RNNFunction_hpp
+
+#include <vector>
+
+namespace MNN {
+/**
+ * GEMM of RNN on data in C4 layout, C of [UP_DIV(h, 4), e, 4] = A of [UP_DIV(l, 4), e, 4] * B + bias. B is packed
+ * once, so that a recurrent step multiplies the hidden state of [batch, l] kept in C4 by it without any transpose, and
+ * the input projection of all time steps is one GEMM of e = batch * time steps.
+ */
+class RNNMatMul {
+public:
+    /**
+     * @param B : [l, h] in row major, or [h, l] if transpose
+     * @param bias : nullptr or h values
+     */
+    RNNMatMul(const float* B, const float* bias, int l, int h, bool transpose);
+    ~RNNMatMul() = default;
+
+    /** floats of the cache of compute */
+    int cacheSize() const {
+        return cacheSize(mL, mH);
+    }
+    static int cacheSize(int l, int h);
+    /**
+     * @brief C = A * B + bias for the rows [eStart, eStart + e) of A and C
+     * @param eStride : rows of A and C, the C4 planes of them are separated by eStride * 4
+     * @param cache : cacheSize() floats, for one thread
+     */
+    void compute(float* C, const float* A, int eStart, int e, int eStride, float* cache) const;
+
+    int l() const {
+        return mL;
+    }
+    int h() const {
+        return mH;
+    }
+
+private:
+    int mL;
+    int mH;
+    std::vector<float> mPackedB;
+    std::vector<float> mBias;
+};
+
+/**
+ * Reorder a weight of gates, each of which has "size" rows (or columns if !rows) in [gates * size, other] (or
+ * [other, gates * size]), so that each gate has ROUND_UP(size, 4) of them, the padding is zero. Then every gate
+ * starts at a C4 plane of the outputs of RNNMatMul.
+ */
+std::vector<float> RNNPadGates(const float* weight, int gates, int size, int other, bool rows);
+} // namespace MNN
+
+#endif /* RNNFunction_hpp */
@@ -133,8 +133,12 @@ ErrorCode StrassenMatrixComputor::_generateTrivalMatMul(const Tensor* AT, const
         }
     }
 
+    // The remain of e is the last unit, units are scheduled dynamically so that the thread of remain isn't the tail
+    std::shared_ptr<ConcurrencyCounter> counter(new ConcurrencyCounter(unitNumber + (xCount > 0 ? 1 : 0), numberThread));
+    mCounters.emplace_back(counter);
+    auto counterPtr = counter.get();
     mFunctions.emplace_back(
-        std::make_pair([xCount, aHost, bHost, cHost, tileHostOrigin, unitNumber, bExtraStride, numberThread, parameters, eReal, CONVOLUTION_TILED_NUMBER, cachePtr, biasPtr, active](int tId) {
+        std::make_pair([xCount, aHost, bHost, cHost, tileHostOrigin, unitNumber, bExtraStride, numberThread, parameters, eReal, CONVOLUTION_TILED_NUMBER, cachePtr, biasPtr, active, counterPtr](int tId) {
             auto tileHost = tileHostOrigin + CONVOLUTION_TILED_NUMBER * parameters[1] * tId;
             const float* postParametersPtr = nullptr;
             if (!active.empty()) {
@@ -142,21 +146,20 @@ ErrorCode StrassenMatrixComputor::_generateTrivalMatMul(const Tensor* AT, const
             }
 
             auto cache = cachePtr[tId];
-            for (int i = tId; i < unitNumber; i+=numberThread) {
-                int xStart    = i * CONVOLUTION_TILED_NUMBER;
-                auto aStart   = aHost + xStart * 4;
-                MNNPackC4ForMatMul_A(tileHost, aStart, CONVOLUTION_TILED_NUMBER, parameters[1], eReal);
-                MNNPackedMatMul(cHost + 4 * xStart, tileHost, bHost, parameters.data(), cache, postParametersPtr, biasPtr);
-            }
-            if (tId != numberThread -1) {
-                return;
-            }
-            if (xCount > 0) {
-                int xStart    = unitNumber * CONVOLUTION_TILED_NUMBER;
-                auto aStart   = aHost + xStart * 4;
-                // Copy
-                MNNPackC4ForMatMul_A(tileHost, aStart, xCount, parameters[1], eReal);
-                MNNPackedMatMulRemain(cHost + 4 * xStart, tileHost, bHost, xCount, parameters.data(), cache, postParametersPtr, biasPtr);
+            int begin, end;
+            while (counterPtr->next(begin, end)) {
+                for (int i = begin; i < end; ++i) {
+                    int xStart    = i * CONVOLUTION_TILED_NUMBER;
+                    auto aStart   = aHost + xStart * 4;
+                    if (i == unitNumber) {
+                        // Copy
+                        MNNPackC4ForMatMul_A(tileHost, aStart, xCount, parameters[1], eReal);
+                        MNNPackedMatMulRemain(cHost + 4 * xStart, tileHost, bHost, xCount, parameters.data(), cache, postParametersPtr, biasPtr);
+                        continue;
+                    }
+                    MNNPackC4ForMatMul_A(tileHost, aStart, CONVOLUTION_TILED_NUMBER, parameters[1], eReal);
+                    MNNPackedMatMul(cHost + 4 * xStart, tileHost, bHost, parameters.data(), cache, postParametersPtr, biasPtr);
+                }
             }
         }, numberThread));
     return NO_ERROR;
@@ -423,6 +426,7 @@ ErrorCode StrassenMatrixComputor::_generateMatMul(const Tensor* AT, const Tensor
 
 void StrassenMatrixComputor::onReset() {
     mFunctions.clear();
+    mCounters.clear();
 }
 
 ErrorCode StrassenMatrixComputor::onEncode(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs, const std::vector<float>& postParameters) {
@@ -439,6 +443,9 @@ ErrorCode StrassenMatrixComputor::onEncode(const std::vector<Tensor*>& inputs, c
 }
 void StrassenMatrixComputor::onExecute() {
     // All is done in onResize, just execute it
+    for (auto& counter : mCounters) {
+        counter->reset();
+    }
     for (auto& f : mFunctions) {
         MNN_CONCURRENCY_BEGIN(tId, f.second) {
             f.first(tId);
@@ -10,8 +10,10 @@
 #define StrassenMatmulComputor_hpp
 
 #include <functional>
+#include <memory>
 #include "core/Backend.hpp"
 namespace MNN {
+class ConcurrencyCounter;
 /**
  Based on
  Boyer, B., Dumas, J.-G., Pernet, C., & Zhou, W. (2007). Memory efficient scheduling of Strassen-Winogradʼs matrix multiplication algorithm. Proceedings of the 2009 international symposium on Symbolic and algebraic computation ISSAC 09, 55. ACM Press. Retrieved from http://arxiv.org/abs/0707.2347
@@ -68,6 +70,8 @@ private:
     ErrorCode _generateTrivalMatMul(const Tensor* AT, const Tensor* BT, const Tensor* CT, const Tensor* COT, const std::vector<float>& postParameters);
 
     std::vector<std::pair<std::function<void(int tId)>, int>> mFunctions;
+    // Counters used by mFunctions for dynamic schedule, reset before each execution
+    std::vector<std::shared_ptr<ConcurrencyCounter>> mCounters;
     int mMaxDepth;
     bool mSupportMultiThread;
 
@@ -0,0 +1,235 @@
+//
+//  TopK.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "backend/cpu/compute/TopK.hpp"
+#include <string.h>
+#include <algorithm>
+#include "core/Macro.h"
+#include "math/Vec.hpp"
+
+// Elements of a block for the max of ArgMaxFloat
+#define MNN_TOPK_ARG_BLOCK 256
+// Elements of a block checked at once by the threshold filter
+#define MNN_TOPK_FILTER_BLOCK 16
+// The threshold filter is used if k * MNN_TOPK_SMALL_RATIO <= size, otherwise the radix select
+#define MNN_TOPK_SMALL_RATIO 16
+
+namespace MNN {
+using Vec4 = MNN::Math::Vec<float, 4>;
+
+template <typename T>
+static inline bool _greater(const TopKElement<T>& a, const TopKElement<T>& b) {
+    return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+
+template <bool MAX>
+static inline float _better(float a, float b) {
+    return MAX ? std::max(a, b) : std::min(a, b);
+}
+
+template <bool MAX>
+static int32_t _argExtreme(const float* values, int size, float& extreme) {
+    // The extreme of each block by Vec4, only the first block reaching the extreme is searched for the index
+    float best    = values[0];
+    int bestBlock = 0;
+    for (int b = 0; b < size; b += MNN_TOPK_ARG_BLOCK) {
+        int end   = std::min(b + MNN_TOPK_ARG_BLOCK, size);
+        int endC4 = b + (end - b) / 4 * 4;
+        float m   = values[b];
+        if (endC4 > b) {
+            auto acc = Vec4::load(values + b);
+            for (int i = b + 4; i < endC4; i += 4) {
+                acc = MAX ? Vec4::max(acc, Vec4::load(values + i)) : Vec4::min(acc, Vec4::load(values + i));
+            }
+            float lanes[4];
+            Vec4::save(lanes, acc);
+            m = _better<MAX>(_better<MAX>(lanes[0], lanes[1]), _better<MAX>(lanes[2], lanes[3]));
+        }
+        for (int i = endC4; i < end; ++i) {
+            m = _better<MAX>(m, values[i]);
+        }
+        if (MAX ? m > best : m < best) {
+            best      = m;
+            bestBlock = b;
+        }
+    }
+    extreme = best;
+    for (int i = bestBlock; i < size; ++i) {
+        if (values[i] == best) {
+            return i;
+        }
+    }
+    // Only for NaN
+    extreme = values[bestBlock];
+    return bestBlock;
+}
+
+int32_t ArgMaxFloat(const float* values, int size, float& extreme) {
+    return _argExtreme<true>(values, size, extreme);
+}
+
+int32_t ArgMinFloat(const float* values, int size, float& extreme) {
+    return _argExtreme<false>(values, size, extreme);
+}
+
+static inline TopKElement<float> _top1(const float* values, int begin, int end) {
+    float value = 0.0f;
+    auto index  = ArgMaxFloat(values + begin, end - begin, value);
+    return std::make_pair(value, index + begin);
+}
+
+static inline TopKElement<int32_t> _top1(const int32_t* values, int begin, int end) {
+    auto index = begin;
+    for (int i = begin + 1; i < end; ++i) {
+        if (values[i] > values[index]) {
+            index = i;
+        }
+    }
+    return std::make_pair(values[index], index);
+}
+
+static inline float _blockMax(const float* values) {
+    auto m = Vec4::max(Vec4::max(Vec4::load(values), Vec4::load(values + 4)),
+                       Vec4::max(Vec4::load(values + 8), Vec4::load(values + 12)));
+    float lanes[4];
+    Vec4::save(lanes, m);
+    return std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+}
+
+static inline int32_t _blockMax(const int32_t* values) {
+    auto m = values[0];
+    for (int i = 1; i < MNN_TOPK_FILTER_BLOCK; ++i) {
+        m = std::max(m, values[i]);
+    }
+    return m;
+}
+
+// Keep the top k, result[k - 1] is the smallest of them
+template <typename T>
+static void _shrink(std::vector<TopKElement<T>>& result, int k) {
+    std::nth_element(result.begin(), result.begin() + (k - 1), result.end(), _greater<T>);
+    result.resize(k);
+}
+
+template <typename T>
+static void _filterSelect(const T* values, int begin, int end, int k, std::vector<TopKElement<T>>& result) {
+    const int capacity = 4 * k;
+    result.reserve(capacity + MNN_TOPK_FILTER_BLOCK);
+    int i = std::min(end, begin + std::max(k, MNN_TOPK_FILTER_BLOCK));
+    for (int j = begin; j < i; ++j) {
+        result.emplace_back(values[j], j);
+    }
+    _shrink(result, k);
+    // The later values equal to the threshold have larger indices than all the kept ones, so they can be skipped
+    auto threshold = result[k - 1].first;
+    for (; i + MNN_TOPK_FILTER_BLOCK <= end; i += MNN_TOPK_FILTER_BLOCK) {
+        if (!(_blockMax(values + i) > threshold)) {
+            continue;
+        }
+        for (int j = i; j < i + MNN_TOPK_FILTER_BLOCK; ++j) {
+            if (values[j] > threshold) {
+                result.emplace_back(values[j], j);
+            }
+        }
+        if ((int)result.size() >= capacity) {
+            _shrink(result, k);
+            threshold = result[k - 1].first;
+        }
+    }
+    for (; i < end; ++i) {
+        if (values[i] > threshold) {
+            result.emplace_back(values[i], i);
+        }
+    }
+    std::partial_sort(result.begin(), result.begin() + k, result.end(), _greater<T>);
+    result.resize(k);
+}
+
+// Bits in the same order as the values
+static inline uint32_t _radixKey(float value) {
+    uint32_t bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+static inline uint32_t _radixKey(int32_t value) {
+    return (uint32_t)value ^ 0x80000000u;
+}
+
+template <typename T>
+static void _radixSelect(const T* values, int begin, int end, int k, std::vector<TopKElement<T>>& result) {
+    // Find the key of the k-th largest from the highest 8 bits, remaining is how many of that key are in the top k
+    uint32_t prefix = 0, mask = 0;
+    int remaining   = k;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        int histogram[256] = {0};
+        for (int i = begin; i < end; ++i) {
+            auto key = _radixKey(values[i]);
+            if ((key & mask) == prefix) {
+                histogram[(key >> shift) & 255]++;
+            }
+        }
+        for (int b = 255; b >= 0; --b) {
+            if (histogram[b] >= remaining) {
+                prefix |= (uint32_t)b << shift;
+                mask |= 255u << shift;
+                break;
+            }
+            remaining -= histogram[b];
+        }
+    }
+    result.reserve(k);
+    for (int i = begin; i < end; ++i) {
+        auto key = _radixKey(values[i]);
+        if (key > prefix) {
+            result.emplace_back(values[i], i);
+        } else if (key == prefix && remaining > 0) {
+            result.emplace_back(values[i], i);
+            remaining--;
+        }
+    }
+    std::sort(result.begin(), result.end(), _greater<T>);
+}
+
+template <typename T>
+void TopKSelect(const T* values, int begin, int end, int k, std::vector<TopKElement<T>>& result) {
+    const int size = end - begin;
+    k              = std::min(k, size);
+    result.clear();
+    if (k <= 0) {
+        return;
+    }
+    if (1 == k) {
+        result.emplace_back(_top1(values, begin, end));
+        return;
+    }
+    if (k * MNN_TOPK_SMALL_RATIO <= size) {
+        _filterSelect(values, begin, end, k, result);
+    } else {
+        _radixSelect(values, begin, end, k, result);
+    }
+}
+
+template <typename T>
+void TopKMerge(const std::vector<std::vector<TopKElement<T>>>& parts, int k, std::vector<TopKElement<T>>& result) {
+    result.clear();
+    for (auto& part : parts) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    k = std::min(k, (int)result.size());
+    std::partial_sort(result.begin(), result.begin() + k, result.end(), _greater<T>);
+    result.resize(k);
+}
+
+template void TopKSelect<float>(const float*, int, int, int, std::vector<TopKElement<float>>&);
+template void TopKSelect<int32_t>(const int32_t*, int, int, int, std::vector<TopKElement<int32_t>>&);
+template void TopKMerge<float>(const std::vector<std::vector<TopKElement<float>>>&, int,
+                               std::vector<TopKElement<float>>&);
+template void TopKMerge<int32_t>(const std::vector<std::vector<TopKElement<int32_t>>>&, int,
+                                 std::vector<TopKElement<int32_t>>&);
+} // namespace MNN
@@ -0,0 +1,47 @@
+//
+//  TopK.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef TopK_hpp
+#define TopK_hpp
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace MNN {
+/**
+ * Top k selection shared by TopKV2 and ArgMax. The results are in descending order of values, the lower index first
+ * for the same value. The strategy is chosen by the size and k:
+ *  - k = 1: the max of blocks by Vec4, then the first index of the max in the first block reaching it.
+ *  - small k: a threshold filter, blocks whose Vec4 max is not above the k-th largest value found so far are skipped,
+ *    the others are collected and shrunk to k by nth_element when there are too many.
+ *  - large k: a radix select of 8 bits per pass on the order-preserving bits of the values.
+ * A huge row can be split into parts, and the top k of the parts are merged by TopKMerge.
+ */
+template <typename T>
+using TopKElement = std::pair<T, int32_t>;
+
+/**
+ * @brief top k of values[begin, end)
+ * @param result : the top min(k, end - begin) of (value, index) in order, index is from values
+ */
+template <typename T>
+void TopKSelect(const T* values, int begin, int end, int k, std::vector<TopKElement<T>>& result);
+
+/**
+ * @brief top k of the concatenation of the results of TopKSelect of parts
+ */
+template <typename T>
+void TopKMerge(const std::vector<std::vector<TopKElement<T>>>& parts, int k, std::vector<TopKElement<T>>& result);
+
+/** index of the first max or min of values, the value is set to extreme */
+int32_t ArgMaxFloat(const float* values, int size, float& extreme);
+int32_t ArgMinFloat(const float* values, int size, float& extreme);
+} // namespace MNN
+
+#endif /* TopK_hpp */
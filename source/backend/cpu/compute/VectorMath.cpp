@@ -0,0 +1,129 @@
+//
+//  VectorMath.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <stdint.h>
+#include "CommonOptFunction.h"
+#include "VectorMath.hpp"
+
+#ifndef MNN_USE_SSE
+namespace {
+struct ScalarOps {
+    typedef float Float;
+    typedef bool Mask;
+    static const int width = 1;
+    static inline Float set(float v) {
+        return v;
+    }
+    static inline Float load(const float* ptr) {
+        return *ptr;
+    }
+    static inline void save(float* ptr, Float v) {
+        *ptr = v;
+    }
+    static inline Float add(Float a, Float b) {
+        return a + b;
+    }
+    static inline Float sub(Float a, Float b) {
+        return a - b;
+    }
+    static inline Float mul(Float a, Float b) {
+        return a * b;
+    }
+    static inline Float div(Float a, Float b) {
+        return a / b;
+    }
+    static inline Float fma(Float a, Float b, Float c) {
+        return a * b + c;
+    }
+    static inline Float min(Float a, Float b) {
+        return a < b ? a : b;
+    }
+    static inline Float max(Float a, Float b) {
+        return a > b ? a : b;
+    }
+    static inline Float abs(Float a) {
+        return fabsf(a);
+    }
+    static inline Mask less(Float a, Float b) {
+        return a < b;
+    }
+    static inline Mask equal(Float a, Float b) {
+        return a == b;
+    }
+    static inline Mask isNan(Float a) {
+        return a != a;
+    }
+    static inline Float select(Mask m, Float a, Float b) {
+        return m ? a : b;
+    }
+    static inline Float round(Float a) {
+        return rintf(a);
+    }
+    static inline Float pow2(Float n) {
+        int32_t bits = ((int32_t)n + 127) << 23;
+        return _fromBits(bits);
+    }
+    static inline Float exponent(Float x) {
+        return (float)((_toBits(x) >> 23) & 0xff);
+    }
+    static inline Float mantissa(Float x) {
+        return _fromBits((_toBits(x) & 0x807fffff) | 0x3f000000);
+    }
+    static inline Float copySign(Float x, Float s) {
+        return _fromBits(_toBits(x) | (_toBits(s) & 0x80000000));
+    }
+    static inline Float truncate(Float x) {
+        return _fromBits(_toBits(x) & 0xfffff000);
+    }
+    static inline uint32_t _toBits(float x) {
+        uint32_t bits;
+        ::memcpy(&bits, &x, sizeof(bits));
+        return bits;
+    }
+    static inline float _fromBits(uint32_t bits) {
+        float x;
+        ::memcpy(&x, &bits, sizeof(x));
+        return x;
+    }
+};
+typedef MNN::VectorMath<ScalarOps> ScalarMath;
+} // namespace
+
+void MNNVectorExp(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<ScalarOps, ScalarMath::exp>(dst, src, size);
+}
+
+void MNNVectorLog(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<ScalarOps, ScalarMath::log>(dst, src, size);
+}
+
+void MNNVectorErf(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<ScalarOps, ScalarMath::erf>(dst, src, size);
+}
+
+void MNNTanh(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<ScalarOps, ScalarMath::tanh>(dst, src, size);
+}
+
+void MNNSigmoid(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<ScalarOps, ScalarMath::sigmoid>(dst, src, size);
+}
+
+void MNNSiLU(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<ScalarOps, ScalarMath::silu>(dst, src, size);
+}
+
+void MNNGelu(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<ScalarOps, ScalarMath::gelu>(dst, src, size);
+}
+
+void MNNGeluTanh(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<ScalarOps, ScalarMath::geluTanh>(dst, src, size);
+}
+#endif
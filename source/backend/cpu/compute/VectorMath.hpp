@@ -0,0 +1,212 @@
+//
+//  VectorMath.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef VectorMath_hpp
+#define VectorMath_hpp
+
+#include <float.h>
+#include <string.h>
+#include <limits>
+
+/*
+ Elementwise float math shared by the generic, SSE and AVX2 kernels. Each instruction set provides an Ops class with
+ the primitives used below, so that the algorithms and their accuracy are the same everywhere. The algorithms are the
+ single precision ones of Cephes with Cody-Waite range reduction.
+
+ Maximum error against double precision, sampled over all floats by test/op/UnaryPrecisionTest.cpp.
+ Results whose magnitude is below FLT_MIN are flushed to zero:
+   exp          2 ulp, +inf above 88.376
+   log          1 ulp
+   erf          3 ulp
+   tanh         2 ulp
+   sigmoid      3 ulp
+   silu         4 ulp, 0 below -87.34
+   gelu         16 ulp, 0.5 * x * (1 + erf(x / sqrt(2))), the largest error is near -1.4 where 1 + erf cancels
+   gelu tanh    3 + 5 * |u| ulp, 0.5 * x * (1 + tanh(u)), u = sqrt(2 / pi) * (x + 0.044715 * x^3). The rounding of u
+                is amplified by exp for negative x, the result is 0 below -10
+
+ The Ops class has:
+   Float, Mask, width
+   set, load, save, add, sub, mul, div, min, max, abs
+   fma(a, b, c)         a * b + c, may be unfused
+   less, equal, isNan   comparison to Mask
+   select(m, a, b)      m ? a : b
+   round                round to nearest integer
+   pow2(n)              2^n for integer n in [-126, 127]
+   exponent(x)          biased exponent of x
+   mantissa(x)          x with the exponent of 0.5, in [0.5, 1)
+   copySign(x, s)       x >= 0 with the sign of s
+   truncate(x)          x with the low 12 bits of mantissa cleared
+*/
+
+#define MNN_EXP_MAX 88.3762626647949f
+#define MNN_EXP_MIN -87.3365447505531f
+// erfc(x) is 0 in float for x above it
+#define MNN_ERFC_MAX 10.0f
+
+namespace MNN {
+template <typename Ops>
+struct VectorMath {
+    typedef typename Ops::Float Float;
+    typedef typename Ops::Mask Mask;
+
+    template <int N>
+    static inline Float poly(Float x, const float (&c)[N]) {
+        Float p = Ops::set(c[0]);
+        for (int i = 1; i < N; ++i) {
+            p = Ops::fma(p, x, Ops::set(c[i]));
+        }
+        return p;
+    }
+
+    // exp(hi + lo) where lo is the rounding error of hi
+    static inline Float expSplit(Float hi, Float lo) {
+        static const float c[] = {1.9875691500E-4f, 1.3981999507E-3f, 8.3334519073E-3f,
+                                  4.1665795894E-2f, 1.6666665459E-1f, 5.0000001201E-1f};
+        auto s = Ops::add(hi, lo);
+        auto x = Ops::min(Ops::max(s, Ops::set(MNN_EXP_MIN)), Ops::set(MNN_EXP_MAX));
+        auto n = Ops::round(Ops::mul(x, Ops::set(1.44269504088896341f)));
+        // ln(2) = 0.693359375 - 2.12194440e-4, n * 0.693359375 is exact
+        auto r = Ops::fma(n, Ops::set(-0.693359375f), Ops::min(Ops::max(hi, Ops::set(MNN_EXP_MIN)), Ops::set(MNN_EXP_MAX)));
+        r      = Ops::add(Ops::fma(n, Ops::set(2.12194440e-4f), r), lo);
+        auto y = Ops::add(Ops::fma(poly(r, c), Ops::mul(r, r), r), Ops::set(1.0f));
+        y      = Ops::mul(y, Ops::pow2(n));
+        y      = Ops::select(Ops::less(Ops::set(MNN_EXP_MAX), s), Ops::set(std::numeric_limits<float>::infinity()), y);
+        y      = Ops::select(Ops::less(s, Ops::set(MNN_EXP_MIN)), Ops::set(0.0f), y);
+        return Ops::select(Ops::isNan(s), s, y);
+    }
+
+    static inline Float exp(Float x) {
+        return expSplit(x, Ops::set(0.0f));
+    }
+
+    static inline Float log(Float x) {
+        static const float c[] = {7.0376836292E-2f,  -1.1514610310E-1f, 1.1676998740E-1f,
+                                  -1.2420140846E-1f, 1.4249322787E-1f,  -1.6668057665E-1f,
+                                  2.0000714765E-1f,  -2.4999993993E-1f, 3.3333331174E-1f};
+        // Scale denormals to normal numbers
+        auto denormal = Ops::less(x, Ops::set(FLT_MIN));
+        auto xs       = Ops::select(denormal, Ops::mul(x, Ops::set(8388608.0f)), x);
+        auto e        = Ops::sub(Ops::exponent(xs), Ops::select(denormal, Ops::set(149.0f), Ops::set(126.0f)));
+        auto m        = Ops::mantissa(xs);
+        // Keep m in [sqrt(0.5), sqrt(2)) - 1
+        auto small = Ops::less(m, Ops::set(0.707106781186547524f));
+        e          = Ops::sub(e, Ops::select(small, Ops::set(1.0f), Ops::set(0.0f)));
+        m          = Ops::add(Ops::sub(m, Ops::set(1.0f)), Ops::select(small, m, Ops::set(0.0f)));
+        auto z     = Ops::mul(m, m);
+        auto y     = Ops::mul(Ops::mul(poly(m, c), m), z);
+        y          = Ops::fma(e, Ops::set(-2.12194440e-4f), y);
+        y          = Ops::fma(z, Ops::set(-0.5f), y);
+        auto r     = Ops::fma(e, Ops::set(0.693359375f), Ops::add(m, y));
+        auto inf   = Ops::set(std::numeric_limits<float>::infinity());
+        r          = Ops::select(Ops::equal(x, inf), inf, r);
+        r          = Ops::select(Ops::equal(x, Ops::set(0.0f)), Ops::set(-std::numeric_limits<float>::infinity()), r);
+        return Ops::select(Ops::less(x, Ops::set(0.0f)), Ops::set(std::numeric_limits<float>::quiet_NaN()),
+                           Ops::select(Ops::isNan(x), x, r));
+    }
+
+    // erfc(z) / exp(-z * z) for z in [1, MNN_ERFC_MAX]
+    static inline Float erfcFactor(Float z) {
+        static const float p[] = {2.326819970068386E-2f, -1.387039388740657E-1f, 3.687424674597105E-1f,
+                                  -5.824733027278666E-1f, 6.210004621745983E-1f, -4.944515323274145E-1f,
+                                  3.404879937665872E-1f,  -2.741127028184656E-1f, 5.638259427386472E-1f};
+        static const float r[] = {-1.047766399936249E+1f, 1.297719955372516E+1f, -7.495518717768503E+0f,
+                                  2.921019019210786E+0f,  -1.015265279202700E+0f, 4.218463358204948E-1f,
+                                  -2.820767439740514E-1f, 5.641895067754075E-1f};
+        auto q = Ops::div(Ops::set(1.0f), z);
+        auto y = Ops::mul(q, q);
+        return Ops::mul(q, Ops::select(Ops::less(z, Ops::set(2.0f)), poly(y, p), poly(y, r)));
+    }
+
+    // erf(x) / x for |x| < 1
+    static inline Float erfSmall(Float x2) {
+        static const float c[] = {7.853861353153693E-5f, -8.010193625184903E-4f, 5.188327685732524E-3f,
+                                  -2.685381193529856E-2f, 1.128358514861418E-1f, -3.761262582423300E-1f,
+                                  1.128379165726710E+0f};
+        return poly(x2, c);
+    }
+
+    static inline Float erf(Float x) {
+        auto z = Ops::min(Ops::abs(x), Ops::set(MNN_ERFC_MAX));
+        // z * z = zh * zh + (z - zh) * (z + zh), zh * zh is exact
+        auto zh    = Ops::truncate(z);
+        auto hi    = Ops::mul(zh, Ops::sub(Ops::set(0.0f), zh));
+        auto lo    = Ops::mul(Ops::sub(zh, z), Ops::add(z, zh));
+        auto erfc  = Ops::mul(expSplit(hi, lo), erfcFactor(z));
+        auto large = Ops::copySign(Ops::sub(Ops::set(1.0f), erfc), x);
+        auto small = Ops::mul(x, erfSmall(Ops::mul(x, x)));
+        auto res   = Ops::select(Ops::less(z, Ops::set(1.0f)), small, large);
+        return Ops::select(Ops::isNan(x), x, res);
+    }
+
+    static inline Float tanh(Float x) {
+        static const float c[] = {-5.70498872745E-3f, 2.06390887954E-2f, -5.37397155531E-2f, 1.33314422036E-1f,
+                                  -3.33332819422E-1f};
+        auto z     = Ops::abs(x);
+        auto x2    = Ops::mul(x, x);
+        auto small = Ops::fma(Ops::mul(poly(x2, c), x2), x, x);
+        // 1 - 2 / (exp(2z) + 1)
+        auto e     = exp(Ops::add(z, z));
+        auto large = Ops::sub(Ops::set(1.0f), Ops::div(Ops::set(2.0f), Ops::add(e, Ops::set(1.0f))));
+        return Ops::select(Ops::less(z, Ops::set(0.625f)), small, Ops::copySign(large, x));
+    }
+
+    // e / (1 + e) for x < 0, 1 / (1 + e) otherwise, e = exp(-|x|) doesn't overflow
+    static inline Float sigmoid(Float x) {
+        auto e = exp(Ops::sub(Ops::set(0.0f), Ops::abs(x)));
+        auto n = Ops::select(Ops::less(x, Ops::set(0.0f)), e, Ops::set(1.0f));
+        return Ops::div(n, Ops::add(e, Ops::set(1.0f)));
+    }
+
+    static inline Float silu(Float x) {
+        return Ops::mul(x, sigmoid(x));
+    }
+
+    static inline Float gelu(Float x) {
+        auto t      = Ops::mul(x, Ops::set(0.707106781186547524f));
+        auto small  = Ops::mul(Ops::fma(t, erfSmall(Ops::mul(t, t)), Ops::set(1.0f)), Ops::mul(x, Ops::set(0.5f)));
+        // 1 + erf(t) = 2 - erfc(|t|) for t > 0 and erfc(|t|) for t < 0, exp(-t * t) is split from x
+        auto a      = Ops::min(Ops::abs(x), Ops::set(MNN_ERFC_MAX * 1.41421356237309505f));
+        auto ah     = Ops::truncate(a);
+        auto hi     = Ops::mul(Ops::mul(ah, ah), Ops::set(-0.5f));
+        auto lo     = Ops::mul(Ops::mul(Ops::sub(ah, a), Ops::add(a, ah)), Ops::set(0.5f));
+        auto e      = expSplit(hi, lo);
+        auto c      = Ops::mul(erfcFactor(Ops::mul(a, Ops::set(0.707106781186547524f))), Ops::set(0.5f));
+        auto pos    = Ops::mul(x, Ops::sub(Ops::set(1.0f), Ops::mul(e, c)));
+        // Multiply e at last so that the result above FLT_MIN isn't flushed to zero
+        auto neg    = Ops::mul(e, Ops::mul(c, Ops::max(x, Ops::set(-MNN_ERFC_MAX * 1.41421356237309505f))));
+        auto large  = Ops::select(Ops::less(Ops::set(0.0f), x), pos, neg);
+        auto res    = Ops::select(Ops::less(Ops::abs(t), Ops::set(1.0f)), small, large);
+        return Ops::select(Ops::isNan(x), x, res);
+    }
+
+    // 0.5 * x * (1 + tanh(u)) = x * sigmoid(2u)
+    static inline Float geluTanh(Float x) {
+        auto x2 = Ops::mul(x, x);
+        auto u2 = Ops::mul(x, Ops::fma(x2, Ops::set(0.0713548162726f), Ops::set(1.59576912160573f)));
+        return Ops::mul(x, sigmoid(u2));
+    }
+};
+
+template <typename Ops, typename Ops::Float (*Func)(typename Ops::Float)>
+void MNNVectorMathApply(float* dst, const float* src, size_t size) {
+    size_t sizeV = size / Ops::width * Ops::width;
+    for (size_t i = 0; i < sizeV; i += Ops::width) {
+        Ops::save(dst + i, Func(Ops::load(src + i)));
+    }
+    if (sizeV < size) {
+        float temp[Ops::width];
+        ::memset(temp, 0, sizeof(temp));
+        ::memcpy(temp, src + sizeV, (size - sizeV) * sizeof(float));
+        Ops::save(temp, Func(Ops::load(temp)));
+        ::memcpy(dst + sizeV, temp, (size - sizeV) * sizeof(float));
+    }
+}
+} // namespace MNN
+
+#endif /* VectorMath_hpp */
@@ -6,13 +6,16 @@
 //  Copyright © 2018, Alibaba Group Holding Limited
 //
 
+#include <cstring>
 #include <limits>
 #include "avx/FunctionSummary.hpp"
+#include "avx512/FunctionSummary.hpp"
 #include "backend/cpu/compute/CommonOptFunction.h"
 #include "backend/cpu/compute/ConvOpt.h"
 #include "backend/cpu/compute/Int8FunctionsOpt.h"
 #include "cpu_id.h"
 #include "sse/FunctionSummary.hpp"
+#include "vnni/FunctionSummary.hpp"
 // https://stackoverflow.com/a/11230437
 #if defined(_MSC_VER)
 #include <intrin.h>
@@ -29,6 +32,7 @@ struct FunctionGroup {
     int eP                                                                                       = 12;
     int lP                                                                                       = 1;
     int hP                                                                                       = 4;
+    int int8GemmSrcOffset                                                                        = 0;
     void (*MNNAddBias)(float* dst, const float* bias, size_t planeNumber, size_t biasNumber)     = _SSE_MNNAddBias;
     void (*MNNAddBiasRelu)(float* dst, const float* bias, size_t planeNumber, size_t biasNumber) = _SSE_MNNAddBiasRelu;
     void (*MNNAddBiasRelu6)(float* dst, const float* bias, size_t planeNumber,
@@ -58,7 +62,34 @@ struct FunctionGroup {
                                        size_t srcHStep, size_t dstHStep) = _SSE_MNNConvRunForLineDepthwise;
     void (*MNNGemmInt8AddBiasScale_16x4_Unit)(int8_t* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad, size_t dst_step,
                                               size_t dst_depth_quad, const QuanPostTreatParameters* post) = _SSE_MNNGemmInt8AddBiasScale_16x4_Unit;
+    void (*MNNLineDepthWiseInt8AddBiasScaleUnit)(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                 const int32_t* bias_z, size_t width, size_t src_w_step, size_t fw,
+                                                 size_t fh, size_t dilateX_step, size_t dilateY_step,
+                                                 const float* scale_z, size_t mode) = _SSE_MNNLineDepthWiseInt8AddBiasScaleUnit;
+    void (*MNNGemmInt8toFloat32_8x4_Common)(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
+                                            size_t width, size_t dst_step,
+                                            size_t dst_depth_quad) = _SSE_MNNGemmInt8toFloat32_8x4_Common;
     void (*MNNExpC8)(float* dest, const float* source, const float* parameters, size_t countC8) = _SSE_MNNExpC8;
+    void (*MNNLayerNorm)(float* dst, const float* src, const float* residual, const float* gamma, const float* beta,
+                         float epsilon, size_t size) = _SSE_MNNLayerNorm;
+    void (*MNNVectorExp)(float* dst, const float* src, size_t size) = _SSE_MNNVectorExp;
+    void (*MNNVectorLog)(float* dst, const float* src, size_t size) = _SSE_MNNVectorLog;
+    void (*MNNVectorErf)(float* dst, const float* src, size_t size) = _SSE_MNNVectorErf;
+    void (*MNNTanh)(float* dst, const float* src, size_t size)      = _SSE_MNNTanh;
+    void (*MNNSigmoid)(float* dst, const float* src, size_t size)   = _SSE_MNNSigmoid;
+    void (*MNNSiLU)(float* dst, const float* src, size_t size)      = _SSE_MNNSiLU;
+    void (*MNNGelu)(float* dst, const float* src, size_t size)      = _SSE_MNNGelu;
+    void (*MNNGeluTanh)(float* dst, const float* src, size_t size)  = _SSE_MNNGeluTanh;
+    // The bf16 GEMM of BackendConfig::bf16Convolution, nullptr if unsupported, see MNNGetBF16PackMode for the lP and hP
+    int bf16LP                                                                        = 2;
+    int bf16HP                                                                        = 4;
+    bool bf16Fast                                                                     = false;
+    void (*MNNPackedAToBF16)(int16_t* dest, const float* source, size_t eP, size_t l) = nullptr;
+    void (*MNNPackedMatMulBF16)(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                                const float* postParameters, const float* bias)     = nullptr;
+    void (*MNNPackedMatMulRemainBF16)(float* C, const int16_t* A, const int16_t* B, size_t eSize,
+                                      const size_t* parameter, const float* postParameters,
+                                      const float* bias)                            = nullptr;
 };
 
 static FunctionGroup gFunc;
@@ -78,13 +109,93 @@ void MNNFunctionInit() {
         gFunc.MNNPackC4ForMatMul_A  = _AVX_MNNPackC4ForMatMul_A;
         gFunc.MNNConvRunForLineDepthwise = _AVX_MNNConvRunForLineDepthwise;
         gFunc.MNNGemmInt8AddBiasScale_16x4_Unit = _AVX_MNNGemmInt8AddBiasScale_16x4_Unit;
+        gFunc.MNNGemmInt8toFloat32_8x4_Common = _AVX_MNNGemmInt8toFloat32_8x4_Common;
         gFunc.MNNExpC8 = _AVX_MNNExpC8;
+        gFunc.MNNLayerNorm = _AVX_MNNLayerNorm;
         if (cpuFlags & libyuv::kCpuHasFMA3) {
             gFunc.MNNGemmFloatUnit_4    = _AVX_MNNGemmFloatUnitFMA_4;
             gFunc.MNNGemmFloatCommon_4  = _AVX_MNNGemmFloatCommonFMA_4;
             gFunc.MNNPackedMatMul       = _AVX_MNNPackedMatMulFMA;
             gFunc.MNNPackedMatMulRemain = _AVX_MNNPackedMatMulRemainFMA;
+            gFunc.MNNVectorExp          = _AVX_MNNVectorExp;
+            gFunc.MNNVectorLog          = _AVX_MNNVectorLog;
+            gFunc.MNNVectorErf          = _AVX_MNNVectorErf;
+            gFunc.MNNTanh               = _AVX_MNNTanh;
+            gFunc.MNNSigmoid            = _AVX_MNNSigmoid;
+            gFunc.MNNSiLU               = _AVX_MNNSiLU;
+            gFunc.MNNGelu               = _AVX_MNNGelu;
+            gFunc.MNNGeluTanh           = _AVX_MNNGeluTanh;
+            // bf16 widened to float on load
+            gFunc.MNNPackedAToBF16          = _AVX_MNNPackedAToBF16;
+            gFunc.MNNPackedMatMulBF16       = _AVX_MNNPackedMatMulBF16;
+            gFunc.MNNPackedMatMulRemainBF16 = _AVX_MNNPackedMatMulRemainBF16;
         }
+#ifdef MNN_AVX512
+        if ((cpuFlags & libyuv::kCpuHasAVX512BW) && (cpuFlags & libyuv::kCpuHasAVX512VL) &&
+            (cpuFlags & libyuv::kCpuHasFMA3)) {
+            gFunc.MNNAddBias                 = _AVX512_MNNAddBias;
+            gFunc.MNNAddBiasRelu             = _AVX512_MNNAddBiasRelu;
+            gFunc.MNNAddBiasRelu6            = _AVX512_MNNAddBiasRelu6;
+            gFunc.MNNMatrixAdd               = _AVX512_MNNMatrixAdd;
+            gFunc.MNNMatrixSub               = _AVX512_MNNMatrixSub;
+            gFunc.MNNPackedMatMul            = _AVX512_MNNPackedMatMul;
+            gFunc.MNNPackedMatMulRemain      = _AVX512_MNNPackedMatMulRemain;
+            gFunc.eP                         = 48;
+            gFunc.MNNPackC4ForMatMul_A       = _AVX512_MNNPackC4ForMatMul_A;
+            gFunc.MNNConvRunForLineDepthwise = _AVX512_MNNConvRunForLineDepthwise;
+            gFunc.MNNExpC8                   = _AVX512_MNNExpC8;
+            gFunc.MNNVectorExp               = _AVX512_MNNVectorExp;
+            gFunc.MNNVectorLog               = _AVX512_MNNVectorLog;
+            gFunc.MNNVectorErf               = _AVX512_MNNVectorErf;
+            gFunc.MNNTanh                    = _AVX512_MNNTanh;
+            gFunc.MNNSigmoid                 = _AVX512_MNNSigmoid;
+            gFunc.MNNSiLU                    = _AVX512_MNNSiLU;
+            gFunc.MNNGelu                    = _AVX512_MNNGelu;
+            gFunc.MNNGeluTanh                = _AVX512_MNNGeluTanh;
+#ifdef MNN_AVX512_BF16
+            if (cpuFlags & libyuv::kCpuHasAVX512BF16) {
+                gFunc.MNNPackedMatMulBF16       = _AVX512_MNNPackedMatMulBF16;
+                gFunc.MNNPackedMatMulRemainBF16 = _AVX512_MNNPackedMatMulRemainBF16;
+            }
+#endif
+#ifdef MNN_AMX_BF16
+            if ((cpuFlags & libyuv::kCpuHasAMXBF16) && _AMX_MNNInit()) {
+                gFunc.bf16LP                    = 32;
+                gFunc.bf16HP                    = 16;
+                gFunc.bf16Fast                  = true;
+                gFunc.MNNPackedAToBF16          = _AMX_MNNPackedAToBF16;
+                gFunc.MNNPackedMatMulBF16       = _AMX_MNNPackedMatMulBF16;
+                gFunc.MNNPackedMatMulRemainBF16 = _AMX_MNNPackedMatMulRemainBF16;
+            }
+#endif
+        }
+#endif
+        // vpdpbusd multiplies uint8 by int8, the source is offset by 128, see MNNGetInt8GemmSrcOffset. The int8 of
+        // MNNGemmInt8toFloat32_8x4_Common are kept, its kernel offsets the weight and compensates it itself
+#ifdef MNN_AVX512_VNNI
+        if ((cpuFlags & libyuv::kCpuHasAVX512VNNI) && (cpuFlags & libyuv::kCpuHasAVX512VL)) {
+            gFunc.MNNGemmInt8AddBiasScale_16x4_Unit    = _AVX512_VNNI_MNNGemmInt8AddBiasScale_16x4_Unit;
+            gFunc.MNNLineDepthWiseInt8AddBiasScaleUnit = _AVX512_VNNI_MNNLineDepthWiseInt8AddBiasScaleUnit;
+            gFunc.MNNGemmInt8toFloat32_8x4_Common      = _AVX512_VNNI_MNNGemmInt8toFloat32_8x4_Common;
+            gFunc.int8GemmSrcOffset                    = 128;
+        }
+#endif
+#ifdef MNN_AVX_VNNI
+        if ((cpuFlags & libyuv::kCpuHasAVXVNNI) && 0 == gFunc.int8GemmSrcOffset) {
+            gFunc.MNNGemmInt8AddBiasScale_16x4_Unit    = _AVX_VNNI_MNNGemmInt8AddBiasScale_16x4_Unit;
+            gFunc.MNNLineDepthWiseInt8AddBiasScaleUnit = _AVX_VNNI_MNNLineDepthWiseInt8AddBiasScaleUnit;
+            gFunc.MNNGemmInt8toFloat32_8x4_Common      = _AVX_VNNI_MNNGemmInt8toFloat32_8x4_Common;
+            gFunc.int8GemmSrcOffset                    = 128;
+        }
+#endif
+#ifdef MNN_VNNI_EMULATE
+        if (0 == gFunc.int8GemmSrcOffset) {
+            gFunc.MNNGemmInt8AddBiasScale_16x4_Unit    = _AVX_VNNIEmulate_MNNGemmInt8AddBiasScale_16x4_Unit;
+            gFunc.MNNLineDepthWiseInt8AddBiasScaleUnit = _AVX_VNNIEmulate_MNNLineDepthWiseInt8AddBiasScaleUnit;
+            gFunc.MNNGemmInt8toFloat32_8x4_Common      = _AVX_VNNIEmulate_MNNGemmInt8toFloat32_8x4_Common;
+            gFunc.int8GemmSrcOffset                    = 128;
+        }
+#endif
     }
 }
 
@@ -161,9 +272,73 @@ void MNNPackedMatMulRemain(float* C, const float* A, const float* B, size_t eSiz
                            float* cache, const float* postParameters, const float* bias) {
     return gFunc.MNNPackedMatMulRemain(C, A, B, eSize, parameter, cache, postParameters, bias);
 }
+bool MNNSupportBF16() {
+    return nullptr != gFunc.MNNPackedMatMulBF16;
+}
+bool MNNBF16IsFast() {
+    return gFunc.bf16Fast;
+}
+void MNNGetBF16PackMode(int* lP, int* hP) {
+    *lP = gFunc.bf16LP;
+    *hP = gFunc.bf16HP;
+}
+void MNNPackForMatMul_BBF16(int16_t* dest, const float* source, size_t h, size_t l) {
+    auto lP   = gFunc.bf16LP;
+    auto hP   = gFunc.bf16HP;
+    auto lPad = UP_DIV(l, lP) * lP;
+    ::memset(dest, 0, UP_DIV(h, hP) * hP * lPad * sizeof(int16_t));
+    for (int y = 0; y < h; ++y) {
+        auto dstY = dest + (y / hP) * hP * lPad + (y % hP) * 2;
+        for (int z = 0; z < l; ++z) {
+            uint32_t bits;
+            ::memcpy(&bits, source + y * l + z, sizeof(float));
+            bits += 0x7fff + ((bits >> 16) & 1);
+            dstY[(z / 2) * hP * 2 + z % 2] = (int16_t)(bits >> 16);
+        }
+    }
+}
+void MNNPackedAToBF16(int16_t* dest, const float* source, size_t eP, size_t l) {
+    gFunc.MNNPackedAToBF16(dest, source, eP, l);
+}
+void MNNPackedMatMulBF16(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                         const float* postParameters, const float* bias) {
+    gFunc.MNNPackedMatMulBF16(C, A, B, parameter, postParameters, bias);
+}
+void MNNPackedMatMulRemainBF16(float* C, const int16_t* A, const int16_t* B, size_t eSize, const size_t* parameter,
+                               const float* postParameters, const float* bias) {
+    gFunc.MNNPackedMatMulRemainBF16(C, A, B, eSize, parameter, postParameters, bias);
+}
 void MNNExpC8(float* dest, const float* source, const float* parameters, size_t countC8) {
     gFunc.MNNExpC8(dest, source, parameters, countC8);
 }
+void MNNLayerNorm(float* dst, const float* src, const float* residual, const float* gamma, const float* beta,
+                  float epsilon, size_t size) {
+    gFunc.MNNLayerNorm(dst, src, residual, gamma, beta, epsilon, size);
+}
+void MNNVectorExp(float* dst, const float* src, size_t size) {
+    gFunc.MNNVectorExp(dst, src, size);
+}
+void MNNVectorLog(float* dst, const float* src, size_t size) {
+    gFunc.MNNVectorLog(dst, src, size);
+}
+void MNNVectorErf(float* dst, const float* src, size_t size) {
+    gFunc.MNNVectorErf(dst, src, size);
+}
+void MNNTanh(float* dst, const float* src, size_t size) {
+    gFunc.MNNTanh(dst, src, size);
+}
+void MNNSigmoid(float* dst, const float* src, size_t size) {
+    gFunc.MNNSigmoid(dst, src, size);
+}
+void MNNSiLU(float* dst, const float* src, size_t size) {
+    gFunc.MNNSiLU(dst, src, size);
+}
+void MNNGelu(float* dst, const float* src, size_t size) {
+    gFunc.MNNGelu(dst, src, size);
+}
+void MNNGeluTanh(float* dst, const float* src, size_t size) {
+    gFunc.MNNGeluTanh(dst, src, size);
+}
 void MNNConvRunForLineDepthwise(float* dst, const float* src, const float* weight, size_t width, size_t src_w_setup,
                                 size_t fw, size_t fh, size_t dilateX_step, size_t dilateY_step, size_t height,
                                 size_t srcHStep, size_t dstHStep) {
@@ -173,3 +348,22 @@ void MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int
                                               size_t dst_depth_quad, const QuanPostTreatParameters* post) {
     return gFunc.MNNGemmInt8AddBiasScale_16x4_Unit(dst, src, weight, src_depth_quad, dst_step, dst_depth_quad, post);
 }
+int MNNGetInt8GemmSrcOffset() {
+    return gFunc.int8GemmSrcOffset;
+}
+extern "C" {
+void MNNGemmInt8toFloat32_8x4_Unit(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
+                                   size_t dst_step, size_t dst_depth_quad) {
+    return gFunc.MNNGemmInt8toFloat32_8x4_Common(dst, src, weight, src_depth_quad, DST_XUNIT, dst_step, dst_depth_quad);
+}
+void MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
+                                     size_t width, size_t dst_step, size_t dst_depth_quad) {
+    return gFunc.MNNGemmInt8toFloat32_8x4_Common(dst, src, weight, src_depth_quad, width, dst_step, dst_depth_quad);
+}
+void MNNLineDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_t* bias_z,
+                                          size_t width, size_t src_w_step, size_t fw, size_t fh, size_t dilateX_step,
+                                          size_t dilateY_step, const float* scale_z, size_t mode) {
+    return gFunc.MNNLineDepthWiseInt8AddBiasScaleUnit(dst, src, weight, bias_z, width, src_w_step, fw, fh,
+                                                      dilateX_step, dilateY_step, scale_z, mode);
+}
+}
@@ -7,6 +7,7 @@
 //
 
 #include <float.h>
+#include <math.h>
 #include <string.h>
 #include <algorithm>
 #include <limits>
@@ -328,3 +329,57 @@ void _AVX_MNNConvRunForLineDepthwise(float* dst, const float* src, const float*
         }
     }
 }
+
+void _AVX_MNNLayerNorm(float* dst, const float* src, const float* residual, const float* gamma, const float* beta,
+                       float epsilon, size_t size) {
+    float shift  = src[0] + (nullptr != residual ? residual[0] : 0.0f);
+    auto sizeC8  = size / 8;
+    auto shiftV  = _mm256_set1_ps(shift);
+    auto sumV    = _mm256_set1_ps(0.0f);
+    auto squareV = _mm256_set1_ps(0.0f);
+    for (int i = 0; i < sizeC8; ++i) {
+        auto x = _mm256_loadu_ps(src + 8 * i);
+        if (nullptr != residual) {
+            x = _mm256_add_ps(x, _mm256_loadu_ps(residual + 8 * i));
+            _mm256_storeu_ps(dst + 8 * i, x);
+        }
+        x       = _mm256_sub_ps(x, shiftV);
+        sumV    = _mm256_add_ps(sumV, x);
+        squareV = _mm256_add_ps(squareV, _mm256_mul_ps(x, x));
+    }
+    float sumTemp[8], squareTemp[8];
+    _mm256_storeu_ps(sumTemp, sumV);
+    _mm256_storeu_ps(squareTemp, squareV);
+    float sum    = 0.0f;
+    float square = 0.0f;
+    for (int i = 0; i < 8; ++i) {
+        sum += sumTemp[i];
+        square += squareTemp[i];
+    }
+    for (int i = sizeC8 * 8; i < size; ++i) {
+        auto x = src[i];
+        if (nullptr != residual) {
+            x += residual[i];
+            dst[i] = x;
+        }
+        x -= shift;
+        sum += x;
+        square += x * x;
+    }
+    float mean     = sum / size;
+    float variance = ALIMAX(square / size - mean * mean, 0.0f);
+    float scale    = 1.0f / sqrtf(variance + epsilon);
+    mean += shift;
+    // The sum of residual is saved in dst
+    auto input  = nullptr != residual ? dst : src;
+    auto meanV  = _mm256_set1_ps(mean);
+    auto scaleV = _mm256_set1_ps(scale);
+    for (int i = 0; i < sizeC8; ++i) {
+        auto x = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(input + 8 * i), meanV), scaleV);
+        x      = _mm256_add_ps(_mm256_mul_ps(x, _mm256_loadu_ps(gamma + 8 * i)), _mm256_loadu_ps(beta + 8 * i));
+        _mm256_storeu_ps(dst + 8 * i, x);
+    }
+    for (int i = sizeC8 * 8; i < size; ++i) {
+        dst[i] = (input[i] - mean) * scale * gamma[i] + beta[i];
+    }
+}
@@ -85,11 +85,30 @@ void _AVX_MNNPackedMatMulRemainFMA(float* C, const float* A, const float* B, siz
 
 void _AVX_MNNPackC4ForMatMul_A(float* dest, const float* source, size_t e, size_t l, size_t eReal);
 
+// ========= GemmBF16.cpp ===========
+void _AVX_MNNPackedAToBF16(int16_t* dest, const float* source, size_t eP, size_t l);
+void _AVX_MNNPackedMatMulBF16(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                              const float* postParameters, const float* bias);
+void _AVX_MNNPackedMatMulRemainBF16(float* C, const int16_t* A, const int16_t* B, size_t eSize,
+                                    const size_t* parameter, const float* postParameters, const float* bias);
+
 void _AVX_MNNConvRunForLineDepthwise(float* dst, const float* src, const float* weight, size_t width, size_t src_w_setup,
                                 size_t fw, size_t fh, size_t dilateX_step, size_t dilateY_step, size_t height,
                                      size_t srcHStep, size_t dstHStep);
 void _AVX_MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad, size_t dst_step, size_t dst_depth_quad, const QuanPostTreatParameters* post);
+void _AVX_MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
+                                          size_t width, size_t dst_step, size_t dst_depth_quad);
 
 void _AVX_MNNExpC8(float* dest, const float* source, const float* parameters, size_t countC8);
+void _AVX_MNNLayerNorm(float* dst, const float* src, const float* residual, const float* gamma, const float* beta,
+                       float epsilon, size_t size);
+void _AVX_MNNVectorExp(float* dst, const float* src, size_t size);
+void _AVX_MNNVectorLog(float* dst, const float* src, size_t size);
+void _AVX_MNNVectorErf(float* dst, const float* src, size_t size);
+void _AVX_MNNTanh(float* dst, const float* src, size_t size);
+void _AVX_MNNSigmoid(float* dst, const float* src, size_t size);
+void _AVX_MNNSiLU(float* dst, const float* src, size_t size);
+void _AVX_MNNGelu(float* dst, const float* src, size_t size);
+void _AVX_MNNGeluTanh(float* dst, const float* src, size_t size);
 
 }
@@ -0,0 +1,177 @@
+//
+//  GemmBF16.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <algorithm>
+#include <cstring>
+#include "FunctionSummary.hpp"
+#include "core/Macro.h"
+
+// The high 16 bits of the float v rounded to the nearest even bfloat16
+static inline __m256i _roundBF16(__m256 v) {
+    auto u   = _mm256_castps_si256(v);
+    auto odd = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(1));
+    u        = _mm256_add_epi32(u, _mm256_add_epi32(odd, _mm256_set1_epi32(0x7fff)));
+    return _mm256_and_si256(u, _mm256_set1_epi32((int)0xffff0000));
+}
+
+static inline int32_t _roundBF16(float v) {
+    uint32_t u;
+    ::memcpy(&u, &v, sizeof(float));
+    u += 0x7fff + ((u >> 16) & 1);
+    return (int32_t)(u & 0xffff0000);
+}
+
+void _AVX_MNNPackedAToBF16(int16_t* dest, const float* source, size_t eP, size_t l) {
+    auto lPair = UP_DIV(l, 2);
+    for (int p = 0; p < lPair; ++p) {
+        auto s0      = source + 2 * p * eP;
+        auto s1      = s0 + eP;
+        bool hasOdd  = 2 * p + 1 < l;
+        auto dstP    = (int32_t*)dest + p * eP;
+        int e        = 0;
+        for (; e + 8 <= eP; e += 8) {
+            auto even = _mm256_srli_epi32(_roundBF16(_mm256_loadu_ps(s0 + e)), 16);
+            auto odd  = hasOdd ? _roundBF16(_mm256_loadu_ps(s1 + e)) : _mm256_setzero_si256();
+            _mm256_storeu_si256((__m256i*)(dstP + e), _mm256_or_si256(even, odd));
+        }
+        for (; e < eP; ++e) {
+            auto even = (uint32_t)_roundBF16(s0[e]) >> 16;
+            dstP[e]   = (int32_t)even | (hasOdd ? _roundBF16(s1[e]) : 0);
+        }
+    }
+}
+
+// The bfloat16 of the even l in the low 16 bits and the odd l in the high 16 bits -> floats
+#define BF16_WIDEN(pair, even, odd)                                       \
+    auto even = _mm256_castsi256_ps(_mm256_slli_epi32(pair, 16));         \
+    auto odd  = _mm256_castsi256_ps(_mm256_and_si256(pair, highMask));
+
+#define BF16_FMA_J(j)                                          \
+    {                                                          \
+        auto w = _mm256_set1_epi32(B_p[j]);                    \
+        BF16_WIDEN(w, w0, w1);                                 \
+        z##j##0 = _mm256_fmadd_ps(a00, w0, z##j##0);           \
+        z##j##0 = _mm256_fmadd_ps(a01, w1, z##j##0);           \
+        if (EU > 1) {                                          \
+            z##j##1 = _mm256_fmadd_ps(a10, w0, z##j##1);       \
+            z##j##1 = _mm256_fmadd_ps(a11, w1, z##j##1);       \
+        }                                                      \
+    }
+
+// count (may be <= 0 or > 2) of e in C4 of v, with the bias and the clamp
+static inline void _storeC4x2(float* dst, __m256 v, int count, bool post, __m256 biasValue, __m256 minValue,
+                              __m256 maxValue) {
+    if (count <= 0) {
+        return;
+    }
+    if (post) {
+        v = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(v, biasValue), minValue), maxValue);
+    }
+    if (count >= 2) {
+        _mm256_storeu_ps(dst, v);
+    } else {
+        _mm_storeu_ps(dst, _mm256_castps256_ps128(v));
+    }
+}
+
+// r_j of the 8 e of the channel j -> count of e in C4
+static inline void _storeC4x8(float* dst, __m256 r0, __m256 r1, __m256 r2, __m256 r3, int count, bool post,
+                              __m256 biasValue, __m256 minValue, __m256 maxValue) {
+    auto t0 = _mm256_unpacklo_ps(r0, r1);
+    auto t1 = _mm256_unpackhi_ps(r0, r1);
+    auto t2 = _mm256_unpacklo_ps(r2, r3);
+    auto t3 = _mm256_unpackhi_ps(r2, r3);
+    // e of c0 ~ c3: 0 | 4, 1 | 5, 2 | 6, 3 | 7
+    auto c0 = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t2)));
+    auto c1 = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t0), _mm256_castps_pd(t2)));
+    auto c2 = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(t1), _mm256_castps_pd(t3)));
+    auto c3 = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(t1), _mm256_castps_pd(t3)));
+    _storeC4x2(dst + 8 * 0, _mm256_permute2f128_ps(c0, c1, 0x20), count - 0, post, biasValue, minValue, maxValue);
+    _storeC4x2(dst + 8 * 1, _mm256_permute2f128_ps(c2, c3, 0x20), count - 2, post, biasValue, minValue, maxValue);
+    _storeC4x2(dst + 8 * 2, _mm256_permute2f128_ps(c0, c1, 0x31), count - 4, post, biasValue, minValue, maxValue);
+    _storeC4x2(dst + 8 * 3, _mm256_permute2f128_ps(c2, c3, 0x31), count - 6, post, biasValue, minValue, maxValue);
+}
+
+// eSize (<= 8 * EU) of A [lPair, aStride, 2] x B [lPair, 4, 2], the accumulators are 8 e of a channel
+template <int EU>
+static void _AVX_MNNPackedMatMulBF16Unit(float* C, const int16_t* A, const int16_t* B, size_t lPair, size_t aStride,
+                                         int eSize, const float* postParameters, const float* bias) {
+    const auto highMask = _mm256_set1_epi32((int)0xffff0000);
+    const auto lastMask = _mm256_cmpgt_epi32(_mm256_set1_epi32(eSize - 8 * (EU - 1)),
+                                             _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    auto z00 = _mm256_setzero_ps();
+    auto z01 = _mm256_setzero_ps();
+    auto z10 = _mm256_setzero_ps();
+    auto z11 = _mm256_setzero_ps();
+    auto z20 = _mm256_setzero_ps();
+    auto z21 = _mm256_setzero_ps();
+    auto z30 = _mm256_setzero_ps();
+    auto z31 = _mm256_setzero_ps();
+    for (size_t p = 0; p < lPair; ++p) {
+        auto A_p = (const int32_t*)A + p * aStride;
+        auto B_p = (const int32_t*)B + p * 4;
+        auto s0  = EU > 1 ? _mm256_loadu_si256((const __m256i*)A_p) : _mm256_maskload_epi32(A_p, lastMask);
+        BF16_WIDEN(s0, a00, a01);
+        auto s1 = EU > 1 ? _mm256_maskload_epi32(A_p + 8, lastMask) : _mm256_setzero_si256();
+        BF16_WIDEN(s1, a10, a11);
+        BF16_FMA_J(0);
+        BF16_FMA_J(1);
+        BF16_FMA_J(2);
+        BF16_FMA_J(3);
+    }
+    const bool post = nullptr != postParameters;
+    auto minValue   = _mm256_set1_ps(post ? postParameters[2] : 0.0f);
+    auto maxValue   = _mm256_set1_ps(post ? postParameters[3] : 0.0f);
+    auto biasValue  = _mm256_setzero_ps();
+    if (post && nullptr != bias) {
+        biasValue = _mm256_broadcast_ps((const __m128*)bias);
+    }
+    _storeC4x8(C, z00, z10, z20, z30, eSize, post, biasValue, minValue, maxValue);
+    if (EU > 1) {
+        _storeC4x8(C + 32, z01, z11, z21, z31, eSize - 8, post, biasValue, minValue, maxValue);
+    }
+}
+
+static void _AVX_MNNPackedMatMulBF16E(float* C, const int16_t* A, const int16_t* B, size_t eSize,
+                                      const size_t* parameter, const float* postParameters, const float* bias) {
+    auto h            = parameter[2];
+    auto l            = parameter[1];
+    auto cStride      = parameter[3] / sizeof(float);
+    auto aStride      = parameter[0] / sizeof(float);
+    auto bExtraStride = parameter[5] / sizeof(int16_t);
+    auto lPair        = UP_DIV(l, 2);
+    auto bStride      = bExtraStride + lPair * 8;
+    auto hC4          = UP_DIV(h, 4);
+    for (int y = 0; y < hC4; ++y) {
+        auto C_y    = C + y * cStride;
+        auto B_y    = B + y * bStride;
+        auto bias_y = nullptr == bias ? nullptr : bias + 4 * y;
+        int e       = 0;
+        for (; e + 16 <= eSize; e += 16) {
+            _AVX_MNNPackedMatMulBF16Unit<2>(C_y + 4 * e, A + 2 * e, B_y, lPair, aStride, 16, postParameters, bias_y);
+        }
+        int remain = (int)eSize - e;
+        if (remain > 8) {
+            _AVX_MNNPackedMatMulBF16Unit<2>(C_y + 4 * e, A + 2 * e, B_y, lPair, aStride, remain, postParameters,
+                                            bias_y);
+        } else if (remain > 0) {
+            _AVX_MNNPackedMatMulBF16Unit<1>(C_y + 4 * e, A + 2 * e, B_y, lPair, aStride, remain, postParameters,
+                                            bias_y);
+        }
+    }
+}
+
+void _AVX_MNNPackedMatMulBF16(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                              const float* postParameters, const float* bias) {
+    _AVX_MNNPackedMatMulBF16E(C, A, B, parameter[0] / sizeof(float), parameter, postParameters, bias);
+}
+
+void _AVX_MNNPackedMatMulRemainBF16(float* C, const int16_t* A, const int16_t* B, size_t eSize,
+                                    const size_t* parameter, const float* postParameters, const float* bias) {
+    _AVX_MNNPackedMatMulBF16E(C, A, B, eSize, parameter, postParameters, bias);
+}
@@ -369,3 +369,68 @@ auto d##i = _mm_add_epi32(d##i##0, d##i##1);
     }
 #endif
 }
+
+// The products of int8 widened to int16 are summed by vpmaddwd, exact for -128 too. Each accumulator of a row has the
+// partial sums of the channels [0, 1] or [2, 3] in its two lanes, reduced once by vphaddd
+void _AVX_MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
+                                          size_t width, size_t dst_step, size_t dst_depth_quad) {
+    // The result of vphaddd is [c0 c2 ...] in the low lane and [c1 c3 ...] in the high lane
+    const auto order = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+#define LOAD_SRC(i) _mm256_broadcastsi128_si256(_mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*)(src_z + 8 * (i)))))
+#define STORE_DST_TWO(i, d0, d1, e0, e1)                                                                    \
+    _mm256_storeu_ps(dst_z + 4 * (i),                                                                     \
+                     _mm256_cvtepi32_ps(_mm256_permutevar8x32_epi32(                                      \
+                         _mm256_hadd_epi32(_mm256_hadd_epi32(d0, d1), _mm256_hadd_epi32(e0, e1)), order)))
+    for (int dz = 0; dz < dst_depth_quad; ++dz) {
+        auto weight_dz = weight + src_depth_quad * dz * 32;
+        auto dst_z     = dst + dz * dst_step;
+        int w          = 0;
+        for (; w + 3 < width; w += 4) {
+            auto d0 = _mm256_setzero_si256();
+            auto d1 = _mm256_setzero_si256();
+            auto d2 = _mm256_setzero_si256();
+            auto d3 = _mm256_setzero_si256();
+            auto d4 = _mm256_setzero_si256();
+            auto d5 = _mm256_setzero_si256();
+            auto d6 = _mm256_setzero_si256();
+            auto d7 = _mm256_setzero_si256();
+            for (int sz = 0; sz < src_depth_quad; ++sz) {
+                auto weight_sz = weight_dz + 32 * sz;
+                auto src_z     = src + sz * width * 8 + 8 * w;
+                auto w01       = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)weight_sz));
+                auto w23       = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(weight_sz + 16)));
+                auto s0        = LOAD_SRC(0);
+                auto s1        = LOAD_SRC(1);
+                d0 = _mm256_add_epi32(d0, _mm256_madd_epi16(w01, s0));
+                d1 = _mm256_add_epi32(d1, _mm256_madd_epi16(w23, s0));
+                d2 = _mm256_add_epi32(d2, _mm256_madd_epi16(w01, s1));
+                d3 = _mm256_add_epi32(d3, _mm256_madd_epi16(w23, s1));
+                auto s2 = LOAD_SRC(2);
+                auto s3 = LOAD_SRC(3);
+                d4 = _mm256_add_epi32(d4, _mm256_madd_epi16(w01, s2));
+                d5 = _mm256_add_epi32(d5, _mm256_madd_epi16(w23, s2));
+                d6 = _mm256_add_epi32(d6, _mm256_madd_epi16(w01, s3));
+                d7 = _mm256_add_epi32(d7, _mm256_madd_epi16(w23, s3));
+            }
+            STORE_DST_TWO(w, d0, d1, d2, d3);
+            STORE_DST_TWO(w + 2, d4, d5, d6, d7);
+        }
+        for (; w < width; ++w) {
+            auto d0 = _mm256_setzero_si256();
+            auto d1 = _mm256_setzero_si256();
+            for (int sz = 0; sz < src_depth_quad; ++sz) {
+                auto weight_sz = weight_dz + 32 * sz;
+                auto src_z     = src + sz * width * 8 + 8 * w;
+                auto s0        = LOAD_SRC(0);
+                d0 = _mm256_add_epi32(
+                    d0, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)weight_sz)), s0));
+                d1 = _mm256_add_epi32(
+                    d1, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(weight_sz + 16))), s0));
+            }
+            auto d = _mm256_permutevar8x32_epi32(_mm256_hadd_epi32(_mm256_hadd_epi32(d0, d1), d0), order);
+            _mm_storeu_ps(dst_z + 4 * w, _mm_cvtepi32_ps(_mm256_castsi256_si128(d)));
+        }
+    }
+#undef LOAD_SRC
+#undef STORE_DST_TWO
+}
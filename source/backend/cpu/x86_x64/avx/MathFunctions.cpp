@@ -0,0 +1,117 @@
+//
+//  MathFunctions.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "FunctionSummary.hpp"
+#include "backend/cpu/compute/VectorMath.hpp"
+
+namespace {
+struct AVX2Ops {
+    typedef __m256 Float;
+    typedef __m256 Mask;
+    static const int width = 8;
+    static inline Float set(float v) {
+        return _mm256_set1_ps(v);
+    }
+    static inline Float load(const float* ptr) {
+        return _mm256_loadu_ps(ptr);
+    }
+    static inline void save(float* ptr, Float v) {
+        _mm256_storeu_ps(ptr, v);
+    }
+    static inline Float add(Float a, Float b) {
+        return _mm256_add_ps(a, b);
+    }
+    static inline Float sub(Float a, Float b) {
+        return _mm256_sub_ps(a, b);
+    }
+    static inline Float mul(Float a, Float b) {
+        return _mm256_mul_ps(a, b);
+    }
+    static inline Float div(Float a, Float b) {
+        return _mm256_div_ps(a, b);
+    }
+    static inline Float fma(Float a, Float b, Float c) {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+    static inline Float min(Float a, Float b) {
+        return _mm256_min_ps(a, b);
+    }
+    static inline Float max(Float a, Float b) {
+        return _mm256_max_ps(a, b);
+    }
+    static inline Float abs(Float a) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+    }
+    static inline Mask less(Float a, Float b) {
+        return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+    }
+    static inline Mask equal(Float a, Float b) {
+        return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+    }
+    static inline Mask isNan(Float a) {
+        return _mm256_cmp_ps(a, a, _CMP_UNORD_Q);
+    }
+    static inline Float select(Mask m, Float a, Float b) {
+        return _mm256_blendv_ps(b, a, m);
+    }
+    static inline Float round(Float a) {
+        return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+    static inline Float pow2(Float n) {
+        auto bits = _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(bits, 23));
+    }
+    static inline Float exponent(Float x) {
+        auto bits = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+        return _mm256_cvtepi32_ps(_mm256_and_si256(bits, _mm256_set1_epi32(0xff)));
+    }
+    static inline Float mantissa(Float x) {
+        auto bits = _mm256_and_si256(_mm256_castps_si256(x), _mm256_set1_epi32(0x807fffff));
+        return _mm256_castsi256_ps(_mm256_or_si256(bits, _mm256_set1_epi32(0x3f000000)));
+    }
+    static inline Float copySign(Float x, Float s) {
+        return _mm256_or_ps(x, _mm256_and_ps(s, _mm256_set1_ps(-0.0f)));
+    }
+    static inline Float truncate(Float x) {
+        return _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0xfffff000)));
+    }
+};
+typedef MNN::VectorMath<AVX2Ops> AVX2Math;
+} // namespace
+
+void _AVX_MNNVectorExp(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX2Ops, AVX2Math::exp>(dst, src, size);
+}
+
+void _AVX_MNNVectorLog(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX2Ops, AVX2Math::log>(dst, src, size);
+}
+
+void _AVX_MNNVectorErf(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX2Ops, AVX2Math::erf>(dst, src, size);
+}
+
+void _AVX_MNNTanh(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX2Ops, AVX2Math::tanh>(dst, src, size);
+}
+
+void _AVX_MNNSigmoid(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX2Ops, AVX2Math::sigmoid>(dst, src, size);
+}
+
+void _AVX_MNNSiLU(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX2Ops, AVX2Math::silu>(dst, src, size);
+}
+
+void _AVX_MNNGelu(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX2Ops, AVX2Math::gelu>(dst, src, size);
+}
+
+void _AVX_MNNGeluTanh(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX2Ops, AVX2Math::geluTanh>(dst, src, size);
+}
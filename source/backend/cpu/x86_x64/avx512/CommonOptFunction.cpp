@@ -0,0 +1,202 @@
+//
+//  CommonOptFunction.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <algorithm>
+#include <limits>
+#include "FunctionSummary.hpp"
+#include "GemmCommon.hpp"
+#include "core/Macro.h"
+
+// Four pixels of C4 in a __m512, each 4 * planeNumber floats of a bias are added and clamped to [minV, maxV]
+template <bool clamp>
+static void _addBias(float* dst, const float* bias, size_t planeNumber, size_t biasNumber, float minV, float maxV) {
+    auto minValue = _mm512_set1_ps(minV);
+    auto maxValue = _mm512_set1_ps(maxV);
+    const int size = (int)planeNumber * 4;
+    for (int z = 0; z < biasNumber; ++z) {
+        auto biasValue = _mm512_broadcast_f32x4(_mm_loadu_ps(bias + 4 * z));
+        float* dst_z   = dst + planeNumber * 4 * z;
+        for (int p = 0; p < size; p += 16) {
+            auto mask = _floatMask(std::min(16, size - p));
+            auto v    = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, dst_z + p), biasValue);
+            if (clamp) {
+                v = _mm512_min_ps(_mm512_max_ps(v, minValue), maxValue);
+            }
+            _mm512_mask_storeu_ps(dst_z + p, mask, v);
+        }
+    }
+}
+
+void _AVX512_MNNAddBias(float* dst, const float* bias, size_t planeNumber, size_t biasNumber) {
+    _addBias<false>(dst, bias, planeNumber, biasNumber, 0.0f, 0.0f);
+}
+
+void _AVX512_MNNAddBiasRelu(float* dst, const float* bias, size_t planeNumber, size_t biasNumber) {
+    _addBias<true>(dst, bias, planeNumber, biasNumber, 0.0f, std::numeric_limits<float>::max());
+}
+
+void _AVX512_MNNAddBiasRelu6(float* dst, const float* bias, size_t planeNumber, size_t biasNumber) {
+    _addBias<true>(dst, bias, planeNumber, biasNumber, 0.0f, 6.0f);
+}
+
+void _AVX512_MNNMatrixAdd(float* C, const float* A, const float* B, size_t widthC4, size_t cStride, size_t aStride,
+                          size_t bStride, size_t height) {
+    const int size = (int)widthC4 * 4;
+    for (int y = 0; y < height; ++y) {
+        auto a = A + aStride * y;
+        auto b = B + bStride * y;
+        auto c = C + cStride * y;
+        for (int x = 0; x < size; x += 16) {
+            auto mask = _floatMask(std::min(16, size - x));
+            _mm512_mask_storeu_ps(c + x, mask,
+                                  _mm512_add_ps(_mm512_maskz_loadu_ps(mask, a + x), _mm512_maskz_loadu_ps(mask, b + x)));
+        }
+    }
+}
+
+void _AVX512_MNNMatrixSub(float* C, const float* A, const float* B, size_t widthC4, size_t cStride, size_t aStride,
+                          size_t bStride, size_t height) {
+    const int size = (int)widthC4 * 4;
+    for (int y = 0; y < height; ++y) {
+        auto a = A + aStride * y;
+        auto b = B + bStride * y;
+        auto c = C + cStride * y;
+        for (int x = 0; x < size; x += 16) {
+            auto mask = _floatMask(std::min(16, size - x));
+            _mm512_mask_storeu_ps(c + x, mask,
+                                  _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, a + x), _mm512_maskz_loadu_ps(mask, b + x)));
+        }
+    }
+}
+
+// The same as _AVX_MNNExpC8: exp(-x) of 2^n * the polynomial of the remain
+void _AVX512_MNNExpC8(float* dest, const float* source, const float* parameters, size_t countC8) {
+    auto p0      = _mm512_set1_ps(parameters[0]);
+    auto p1      = _mm512_set1_ps(parameters[1]);
+    auto p2      = _mm512_set1_ps(parameters[2]);
+    auto p3      = _mm512_set1_ps(parameters[3]);
+    auto p4      = _mm512_set1_ps(parameters[4]);
+    auto p5      = _mm512_set1_ps(parameters[5]);
+    auto p6      = _mm512_set1_ps(parameters[6]);
+    auto p7      = _mm512_set1_ps(parameters[7]);
+    auto xMax    = _mm512_set1_ps(87);
+    auto xMin    = _mm512_set1_ps(-87);
+    auto temp127 = _mm512_set1_epi32(127);
+    auto negZero = _mm512_set1_epi32(0x80000000);
+    const int size = (int)countC8 * 8;
+    for (int i = 0; i < size; i += 16) {
+        auto mask      = _floatMask(std::min(16, size - i));
+        auto x         = _mm512_castsi512_ps(
+            _mm512_xor_si512(_mm512_castps_si512(_mm512_maskz_loadu_ps(mask, source + i)), negZero));
+        x              = _mm512_max_ps(x, xMin);
+        x              = _mm512_min_ps(x, xMax);
+        auto div       = _mm512_mul_ps(x, p1);
+        auto divInt    = _mm512_cvtps_epi32(div);
+        div            = _mm512_cvtepi32_ps(divInt);
+        auto expBasic  = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(divInt, temp127), 23));
+        auto t         = _mm512_sub_ps(x, _mm512_mul_ps(div, p0));
+        auto expRemain = _mm512_fmadd_ps(p7, t, p6);
+        expRemain      = _mm512_fmadd_ps(expRemain, t, p5);
+        expRemain      = _mm512_fmadd_ps(expRemain, t, p4);
+        expRemain      = _mm512_fmadd_ps(expRemain, t, p3);
+        expRemain      = _mm512_fmadd_ps(expRemain, t, p2);
+        _mm512_mask_storeu_ps(dest + i, mask, _mm512_mul_ps(expBasic, expRemain));
+    }
+}
+
+// Four pixels of C4 apart src_w_setup
+template <bool contiguous>
+static inline __m512 _loadPixels(const float* src, size_t src_w_setup) {
+    if (contiguous) {
+        return _mm512_loadu_ps(src);
+    }
+    auto v = _mm512_castps128_ps512(_mm_loadu_ps(src));
+    v      = _mm512_insertf32x4(v, _mm_loadu_ps(src + 1 * src_w_setup), 1);
+    v      = _mm512_insertf32x4(v, _mm_loadu_ps(src + 2 * src_w_setup), 2);
+    v      = _mm512_insertf32x4(v, _mm_loadu_ps(src + 3 * src_w_setup), 3);
+    return v;
+}
+
+template <bool contiguous>
+static void _convRunForLineDepthwise(float* dst, const float* src, const float* weight, size_t width,
+                                     size_t src_w_setup, size_t fw, size_t fh, size_t dilateX_step,
+                                     size_t dilateY_step, size_t height, size_t srcHStep, size_t dstHStep) {
+    for (int y = 0; y < height; ++y) {
+        auto srcY = src + y * srcHStep;
+        auto dstY = dst + y * dstHStep;
+        int dx    = 0;
+        // 16 pixels
+        for (; dx + 16 <= width; dx += 16) {
+            auto srcX      = srcY + dx * src_w_setup;
+            auto dstValue0 = _mm512_setzero_ps();
+            auto dstValue1 = _mm512_setzero_ps();
+            auto dstValue2 = _mm512_setzero_ps();
+            auto dstValue3 = _mm512_setzero_ps();
+            for (int fy = 0; fy < fh; ++fy) {
+                const float* src_y    = srcX + fy * dilateY_step;
+                const float* weight_y = weight + fy * fw * 4;
+                for (int fx = 0; fx < fw; ++fx) {
+                    const float* src_x = src_y + fx * dilateX_step;
+                    auto weightValue   = _mm512_broadcast_f32x4(_mm_loadu_ps(weight_y + 4 * fx));
+                    dstValue0 = _mm512_fmadd_ps(_loadPixels<contiguous>(src_x + 0 * src_w_setup, src_w_setup),
+                                                weightValue, dstValue0);
+                    dstValue1 = _mm512_fmadd_ps(_loadPixels<contiguous>(src_x + 4 * src_w_setup, src_w_setup),
+                                                weightValue, dstValue1);
+                    dstValue2 = _mm512_fmadd_ps(_loadPixels<contiguous>(src_x + 8 * src_w_setup, src_w_setup),
+                                                weightValue, dstValue2);
+                    dstValue3 = _mm512_fmadd_ps(_loadPixels<contiguous>(src_x + 12 * src_w_setup, src_w_setup),
+                                                weightValue, dstValue3);
+                }
+            }
+            _mm512_storeu_ps(dstY + 4 * dx + 16 * 0, dstValue0);
+            _mm512_storeu_ps(dstY + 4 * dx + 16 * 1, dstValue1);
+            _mm512_storeu_ps(dstY + 4 * dx + 16 * 2, dstValue2);
+            _mm512_storeu_ps(dstY + 4 * dx + 16 * 3, dstValue3);
+        }
+        // 4 pixels
+        for (; dx + 4 <= width; dx += 4) {
+            auto srcX     = srcY + dx * src_w_setup;
+            auto dstValue = _mm512_setzero_ps();
+            for (int fy = 0; fy < fh; ++fy) {
+                const float* src_y    = srcX + fy * dilateY_step;
+                const float* weight_y = weight + fy * fw * 4;
+                for (int fx = 0; fx < fw; ++fx) {
+                    auto weightValue = _mm512_broadcast_f32x4(_mm_loadu_ps(weight_y + 4 * fx));
+                    dstValue = _mm512_fmadd_ps(_loadPixels<contiguous>(src_y + fx * dilateX_step, src_w_setup),
+                                               weightValue, dstValue);
+                }
+            }
+            _mm512_storeu_ps(dstY + 4 * dx, dstValue);
+        }
+        for (; dx < width; ++dx) {
+            auto srcX     = srcY + dx * src_w_setup;
+            auto dstValue = _mm_setzero_ps();
+            for (int fy = 0; fy < fh; ++fy) {
+                const float* src_y    = srcX + fy * dilateY_step;
+                const float* weight_y = weight + fy * fw * 4;
+                for (int fx = 0; fx < fw; ++fx) {
+                    dstValue = _mm_fmadd_ps(_mm_loadu_ps(src_y + fx * dilateX_step), _mm_loadu_ps(weight_y + 4 * fx),
+                                            dstValue);
+                }
+            }
+            _mm_storeu_ps(dstY + 4 * dx, dstValue);
+        }
+    }
+}
+
+void _AVX512_MNNConvRunForLineDepthwise(float* dst, const float* src, const float* weight, size_t width,
+                                        size_t src_w_setup, size_t fw, size_t fh, size_t dilateX_step,
+                                        size_t dilateY_step, size_t height, size_t srcHStep, size_t dstHStep) {
+    if (src_w_setup == 4) {
+        _convRunForLineDepthwise<true>(dst, src, weight, width, src_w_setup, fw, fh, dilateX_step, dilateY_step,
+                                       height, srcHStep, dstHStep);
+        return;
+    }
+    _convRunForLineDepthwise<false>(dst, src, weight, width, src_w_setup, fw, fh, dilateX_step, dilateY_step, height,
+                                    srcHStep, dstHStep);
+}
@@ -0,0 +1,63 @@
+//
+//  FunctionSummary.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#include <MNN/MNNDefine.h>
+#include <stdint.h>
+
+// The float kernels of AVX-512, eP = 48 of three __m512 and hP = 4 of the C4 output and the packed weight
+extern "C" {
+// ========= GemmAVX512.cpp ===========
+void _AVX512_MNNPackC4ForMatMul_A(float* dest, const float* source, size_t e, size_t l, size_t eReal);
+void _AVX512_MNNPackedMatMul(float* C, const float* A, const float* B, const size_t* parameter, float* cache,
+                             const float* postParameters, const float* bias);
+void _AVX512_MNNPackedMatMulRemain(float* C, const float* A, const float* B, size_t eSize, const size_t* parameter,
+                                   float* cache, const float* postParameters, const float* bias);
+
+// ========= GemmBF16AVX512.cpp ===========
+void _AVX512_MNNPackedMatMulBF16(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                                 const float* postParameters, const float* bias);
+void _AVX512_MNNPackedMatMulRemainBF16(float* C, const int16_t* A, const int16_t* B, size_t eSize,
+                                       const size_t* parameter, const float* postParameters, const float* bias);
+
+// ========= GemmBF16AMX.cpp ===========
+// The bf16 GEMM of AMX tiles, lP = 32 and hP = 16, _AMX_MNNInit requests the tile data from the OS
+bool _AMX_MNNInit();
+void _AMX_MNNPackedAToBF16(int16_t* dest, const float* source, size_t eP, size_t l);
+void _AMX_MNNPackedMatMulBF16(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                              const float* postParameters, const float* bias);
+void _AMX_MNNPackedMatMulRemainBF16(float* C, const int16_t* A, const int16_t* B, size_t eSize,
+                                    const size_t* parameter, const float* postParameters, const float* bias);
+
+// ========= CommonOptFunction.cpp ===========
+void _AVX512_MNNAddBias(float* dst, const float* bias, size_t planeNumber, size_t biasNumber);
+void _AVX512_MNNAddBiasRelu(float* dst, const float* bias, size_t planeNumber, size_t biasNumber);
+void _AVX512_MNNAddBiasRelu6(float* dst, const float* bias, size_t planeNumber, size_t biasNumber);
+void _AVX512_MNNMatrixAdd(float* C, const float* A, const float* B, size_t widthC4, size_t cStride, size_t aStride,
+                          size_t bStride, size_t height);
+void _AVX512_MNNMatrixSub(float* C, const float* A, const float* B, size_t widthC4, size_t cStride, size_t aStride,
+                          size_t bStride, size_t height);
+void _AVX512_MNNConvRunForLineDepthwise(float* dst, const float* src, const float* weight, size_t width,
+                                        size_t src_w_setup, size_t fw, size_t fh, size_t dilateX_step,
+                                        size_t dilateY_step, size_t height, size_t srcHStep, size_t dstHStep);
+void _AVX512_MNNExpC8(float* dest, const float* source, const float* parameters, size_t countC8);
+
+// ========= MathFunctions.cpp ===========
+void _AVX512_MNNVectorExp(float* dst, const float* src, size_t size);
+void _AVX512_MNNVectorLog(float* dst, const float* src, size_t size);
+void _AVX512_MNNVectorErf(float* dst, const float* src, size_t size);
+void _AVX512_MNNTanh(float* dst, const float* src, size_t size);
+void _AVX512_MNNSigmoid(float* dst, const float* src, size_t size);
+void _AVX512_MNNSiLU(float* dst, const float* src, size_t size);
+void _AVX512_MNNGelu(float* dst, const float* src, size_t size);
+void _AVX512_MNNGeluTanh(float* dst, const float* src, size_t size);
+}
@@ -0,0 +1,163 @@
+//
+//  GemmAVX512.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <algorithm>
+#include "FunctionSummary.hpp"
+#include "GemmCommon.hpp"
+#include "core/Macro.h"
+
+// [lC4, eReal, 4] -> [l, eCount] of eCount <= eP
+static void _packC4Block(float* dest, const float* source, int eCount, size_t l, size_t eReal) {
+    auto lDiv = UP_DIV(l, 4);
+    for (int x = 0; x < lDiv; ++x) {
+        auto srcX   = source + x * 4 * eReal;
+        auto dstX   = dest + x * 4 * eCount;
+        int lCount  = std::min(4, (int)l - 4 * x);
+        for (int k = 0; k < eCount; k += AVX512_E_UNIT) {
+            int n = std::min(AVX512_E_UNIT, eCount - k);
+            __m512 r[4];
+            for (int i = 0; i < 4; ++i) {
+                int count = std::max(0, std::min(4, n - 4 * i));
+                r[i]      = _mm512_maskz_loadu_ps(_floatMask(4 * count), srcX + 4 * k + 16 * i);
+            }
+            _transposeC4ToE(r[0], r[1], r[2], r[3]);
+            auto mask = _floatMask(n);
+            for (int j = 0; j < lCount; ++j) {
+                _mm512_mask_storeu_ps(dstX + j * eCount + k, mask, r[j]);
+            }
+        }
+    }
+}
+
+void _AVX512_MNNPackC4ForMatMul_A(float* dest, const float* source, size_t e, size_t l, size_t eReal) {
+    const int pack = AVX512_PACK_E;
+    auto ePack     = e / pack;
+    auto eRemain   = e - ePack * pack;
+    for (int y = 0; y < ePack; ++y) {
+        _packC4Block(dest + y * l * pack, source + y * pack * 4, pack, l, eReal);
+    }
+    if (eRemain > 0) {
+        _packC4Block(dest + ePack * l * pack, source + ePack * pack * 4, (int)eRemain, l, eReal);
+    }
+}
+
+#define AVX512_FMA_J(u, j)                                       \
+    {                                                            \
+        auto w     = _mm512_set1_ps(B_##u[j]);                   \
+        z##u##j##0 = _mm512_fmadd_ps(s0, w, z##u##j##0);         \
+        if (EU > 1) {                                            \
+            z##u##j##1 = _mm512_fmadd_ps(s1, w, z##u##j##1);     \
+        }                                                        \
+        if (EU > 2) {                                            \
+            z##u##j##2 = _mm512_fmadd_ps(s2, w, z##u##j##2);     \
+        }                                                        \
+    }
+
+// eSize (<= 16 * EU) of A [l, aStride] x HU blocks of B [l, 4], the accumulators are 16 e of a channel and turned to
+// C4 at the store, where the bias and the clamp are applied
+template <int EU, int HU>
+static inline void _AVX512_MNNPackedMatMulUnit(float* C, const float* A, const float* B, size_t l, size_t aStride,
+                                               size_t bStride, size_t cStride, int eSize,
+                                               const float* postParameters, const float* bias) {
+    AVX512_INIT_J(0, 0);
+    AVX512_INIT_J(0, 1);
+    AVX512_INIT_J(0, 2);
+    AVX512_INIT_J(0, 3);
+    AVX512_INIT_J(1, 0);
+    AVX512_INIT_J(1, 1);
+    AVX512_INIT_J(1, 2);
+    AVX512_INIT_J(1, 3);
+    const auto lastMask = _floatMask(eSize - (EU - 1) * AVX512_E_UNIT);
+    for (size_t sy = 0; sy < l; ++sy) {
+        auto A_y = A + sy * aStride;
+        auto B_0 = B + 4 * sy;
+        auto B_1 = B_0 + bStride;
+        auto s0  = EU > 1 ? _mm512_loadu_ps(A_y) : _mm512_maskz_loadu_ps(lastMask, A_y);
+        auto s1  = _mm512_setzero_ps();
+        auto s2  = _mm512_setzero_ps();
+        if (EU > 1) {
+            s1 = EU > 2 ? _mm512_loadu_ps(A_y + AVX512_E_UNIT) : _mm512_maskz_loadu_ps(lastMask, A_y + AVX512_E_UNIT);
+        }
+        if (EU > 2) {
+            s2 = _mm512_maskz_loadu_ps(lastMask, A_y + 2 * AVX512_E_UNIT);
+        }
+        AVX512_FMA_J(0, 0);
+        AVX512_FMA_J(0, 1);
+        AVX512_FMA_J(0, 2);
+        AVX512_FMA_J(0, 3);
+        if (HU > 1) {
+            AVX512_FMA_J(1, 0);
+            AVX512_FMA_J(1, 1);
+            AVX512_FMA_J(1, 2);
+            AVX512_FMA_J(1, 3);
+        }
+    }
+    const bool post = nullptr != postParameters;
+    auto minValue   = _mm512_set1_ps(post ? postParameters[2] : 0.0f);
+    auto maxValue   = _mm512_set1_ps(post ? postParameters[3] : 0.0f);
+    auto biasValue0 = _mm512_setzero_ps();
+    auto biasValue1 = _mm512_setzero_ps();
+    if (post && nullptr != bias) {
+        biasValue0 = _mm512_broadcast_f32x4(_mm_loadu_ps(bias));
+        if (HU > 1) {
+            biasValue1 = _mm512_broadcast_f32x4(_mm_loadu_ps(bias + 4));
+        }
+    }
+    AVX512_STORE_K(0, 0);
+    AVX512_STORE_K(0, 1);
+    AVX512_STORE_K(0, 2);
+    if (HU > 1) {
+        AVX512_STORE_K(1, 0);
+        AVX512_STORE_K(1, 1);
+        AVX512_STORE_K(1, 2);
+    }
+}
+
+// Two blocks of h for each load of A: 24 accumulators of EU = 3
+template <int EU>
+static void _AVX512_MNNPackedMatMulE(float* C, const float* A, const float* B, const size_t* parameter,
+                                     size_t aStride, int eSize, const float* postParameters, const float* bias) {
+    auto h            = parameter[2];
+    auto l            = parameter[1];
+    auto cStride      = parameter[3] / sizeof(float);
+    auto bExtraStride = parameter[5] / sizeof(float);
+    auto bStride      = bExtraStride + l * 4;
+    int hC4           = UP_DIV(h, 4);
+    int y             = 0;
+    for (; y + 1 < hC4; y += 2) {
+        _AVX512_MNNPackedMatMulUnit<EU, 2>(C + y * cStride, A, B + y * bStride, l, aStride, bStride, cStride, eSize,
+                                           postParameters, nullptr == bias ? nullptr : bias + 4 * y);
+    }
+    if (y < hC4) {
+        _AVX512_MNNPackedMatMulUnit<EU, 1>(C + y * cStride, A, B + y * bStride, l, aStride, bStride, cStride, eSize,
+                                           postParameters, nullptr == bias ? nullptr : bias + 4 * y);
+    }
+}
+
+void _AVX512_MNNPackedMatMul(float* C, const float* A, const float* B, const size_t* parameter, float* cache,
+                             const float* postParameters, const float* bias) {
+    _AVX512_MNNPackedMatMulE<3>(C, A, B, parameter, AVX512_PACK_E, AVX512_PACK_E, postParameters, bias);
+}
+
+void _AVX512_MNNPackedMatMulRemain(float* C, const float* A, const float* B, size_t eSize, const size_t* parameter,
+                                   float* cache, const float* postParameters, const float* bias) {
+    auto aStride = parameter[0] / sizeof(float);
+    switch (UP_DIV(eSize, AVX512_E_UNIT)) {
+        case 1:
+            _AVX512_MNNPackedMatMulE<1>(C, A, B, parameter, aStride, (int)eSize, postParameters, bias);
+            break;
+        case 2:
+            _AVX512_MNNPackedMatMulE<2>(C, A, B, parameter, aStride, (int)eSize, postParameters, bias);
+            break;
+        case 3:
+            _AVX512_MNNPackedMatMulE<3>(C, A, B, parameter, aStride, (int)eSize, postParameters, bias);
+            break;
+        default:
+            break;
+    }
+}
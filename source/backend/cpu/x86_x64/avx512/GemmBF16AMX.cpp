@@ -0,0 +1,205 @@
+//
+//  GemmBF16AMX.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <algorithm>
+#include <cstring>
+#include "FunctionSummary.hpp"
+#include "GemmCommon.hpp"
+#include "core/Macro.h"
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// A tile is 16 rows of 16 pairs of l, the rows of A are e and the rows of B are the pairs of l
+#define AMX_L_UNIT 32
+#define AMX_TILE_ROWS 16
+#define AMX_TILE_BYTES 64
+
+struct AMXTileConfig {
+    uint8_t paletteId;
+    uint8_t startRow;
+    uint8_t reserved[14];
+    uint16_t colsb[16];
+    uint8_t rows[16];
+};
+
+bool _AMX_MNNInit() {
+#if defined(__linux__)
+    // The tile data is disabled for the process until requested, see arch_prctl(ARCH_REQ_XCOMP_PERM)
+    const int archReqXcompPerm = 0x1023;
+    const int xfeatureXTileData = 18;
+    return 0 == syscall(SYS_arch_prctl, archReqXcompPerm, xfeatureXTileData);
+#else
+    return false;
+#endif
+}
+
+// 16 rows of 16 int32 -> 16 columns
+static inline void _transpose16x16(__m512i* r) {
+    __m512i t[16], u[16];
+    for (int i = 0; i < 16; i += 2) {
+        t[i]     = _mm512_unpacklo_epi32(r[i], r[i + 1]);
+        t[i + 1] = _mm512_unpackhi_epi32(r[i], r[i + 1]);
+    }
+    for (int i = 0; i < 16; i += 4) {
+        u[i]     = _mm512_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm512_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm512_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm512_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    // u[4 * g + j] has the column 4 * lane + j of the rows 4 * g ~ 4 * g + 3 in each lane
+    for (int j = 0; j < 4; ++j) {
+        auto v0 = _mm512_shuffle_i32x4(u[j], u[4 + j], 0x88);
+        auto v1 = _mm512_shuffle_i32x4(u[8 + j], u[12 + j], 0x88);
+        auto w0 = _mm512_shuffle_i32x4(u[j], u[4 + j], 0xdd);
+        auto w1 = _mm512_shuffle_i32x4(u[8 + j], u[12 + j], 0xdd);
+        r[j]      = _mm512_shuffle_i32x4(v0, v1, 0x88);
+        r[8 + j]  = _mm512_shuffle_i32x4(v0, v1, 0xdd);
+        r[4 + j]  = _mm512_shuffle_i32x4(w0, w1, 0x88);
+        r[12 + j] = _mm512_shuffle_i32x4(w0, w1, 0xdd);
+    }
+}
+
+// The high 16 bits of the float v rounded to the nearest even bfloat16
+static inline __m512i _roundBF16(__m512 v) {
+    auto u   = _mm512_castps_si512(v);
+    auto odd = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(1));
+    u        = _mm512_add_epi32(u, _mm512_add_epi32(odd, _mm512_set1_epi32(0x7fff)));
+    return _mm512_and_si512(u, _mm512_set1_epi32((int)0xffff0000));
+}
+
+// [l, eP] -> [UP_DIV(l, 32), eP, 32], a row of the tile of A is 32 l of an e
+void _AMX_MNNPackedAToBF16(int16_t* dest, const float* source, size_t eP, size_t l) {
+    MNN_ASSERT(eP % AVX512_E_UNIT == 0);
+    auto lBlock = UP_DIV(l, AMX_L_UNIT);
+    __m512i r[16];
+    for (int b = 0; b < lBlock; ++b) {
+        auto dstB = (int32_t*)dest + b * eP * AMX_TILE_ROWS;
+        for (int e = 0; e < eP; e += AVX512_E_UNIT) {
+            for (int p = 0; p < 16; ++p) {
+                int z = b * AMX_L_UNIT + 2 * p;
+                auto even = z < l ? _roundBF16(_mm512_loadu_ps(source + z * eP + e)) : _mm512_setzero_si512();
+                auto odd  = z + 1 < l ? _roundBF16(_mm512_loadu_ps(source + (z + 1) * eP + e)) : _mm512_setzero_si512();
+                r[p]      = _mm512_or_si512(_mm512_srli_epi32(even, 16), odd);
+            }
+            _transpose16x16(r);
+            for (int x = 0; x < AVX512_E_UNIT; ++x) {
+                _mm512_storeu_si512(dstB + (e + x) * AMX_TILE_ROWS, r[x]);
+            }
+        }
+    }
+}
+
+// EU tiles of 16 e of A [lBlock, aStride, 32] x B [lBlock * 16, 16, 2] of 16 channels -> tmp [EU, 16 e, 16 h]
+template <int EU>
+static inline void _AMX_MNNPackedMatMulBF16Unit(float* tmp, const int16_t* A, const int16_t* B, size_t lBlock,
+                                                size_t aStride) {
+    _tile_zero(0);
+    if (EU > 1) {
+        _tile_zero(1);
+    }
+    if (EU > 2) {
+        _tile_zero(2);
+    }
+    for (int b = 0; b < lBlock; ++b) {
+        auto A_b = A + b * aStride * AMX_L_UNIT;
+        _tile_loadd(6, B + b * AMX_TILE_ROWS * AMX_L_UNIT, AMX_TILE_BYTES);
+        _tile_loadd(3, A_b, AMX_TILE_BYTES);
+        _tile_dpbf16ps(0, 3, 6);
+        if (EU > 1) {
+            _tile_loadd(4, A_b + AVX512_E_UNIT * AMX_L_UNIT, AMX_TILE_BYTES);
+            _tile_dpbf16ps(1, 4, 6);
+        }
+        if (EU > 2) {
+            _tile_loadd(5, A_b + 2 * AVX512_E_UNIT * AMX_L_UNIT, AMX_TILE_BYTES);
+            _tile_dpbf16ps(2, 5, 6);
+        }
+    }
+    _tile_stored(0, tmp, AMX_TILE_BYTES);
+    if (EU > 1) {
+        _tile_stored(1, tmp + AMX_TILE_ROWS * AVX512_E_UNIT, AMX_TILE_BYTES);
+    }
+    if (EU > 2) {
+        _tile_stored(2, tmp + 2 * AMX_TILE_ROWS * AVX512_E_UNIT, AMX_TILE_BYTES);
+    }
+}
+
+void _AMX_MNNPackedMatMulRemainBF16(float* C, const int16_t* A, const int16_t* B, size_t eSize,
+                                    const size_t* parameter, const float* postParameters, const float* bias) {
+    auto aStride      = parameter[0] / sizeof(float);
+    auto l            = parameter[1];
+    auto h            = parameter[2];
+    auto cStride      = parameter[3] / sizeof(float);
+    auto bExtraStride = parameter[5] / sizeof(int16_t);
+    auto lBlock       = UP_DIV(l, AMX_L_UNIT);
+    auto bStride      = bExtraStride + lBlock * AMX_TILE_ROWS * AMX_L_UNIT;
+    int hC4           = UP_DIV(h, 4);
+    int hC16          = UP_DIV(h, 16);
+    AMXTileConfig config;
+    ::memset(&config, 0, sizeof(config));
+    config.paletteId = 1;
+    for (int i = 0; i < 7; ++i) {
+        config.colsb[i] = AMX_TILE_BYTES;
+        config.rows[i]  = AMX_TILE_ROWS;
+    }
+    _tile_loadconfig(&config);
+    const bool post = nullptr != postParameters;
+    auto minValue   = _mm512_set1_ps(post ? postParameters[2] : 0.0f);
+    auto maxValue   = _mm512_set1_ps(post ? postParameters[3] : 0.0f);
+    alignas(64) float tmp[AVX512_PACK_E * 16];
+    // The e beyond a pass of 48 only happen for a larger eP of the caller
+    for (int e = 0; e < eSize; e += AVX512_PACK_E) {
+        int eCount = std::min((int)eSize - e, AVX512_PACK_E);
+        auto A_e   = A + AMX_L_UNIT * e;
+        for (int y = 0; y < hC16; ++y) {
+            auto B_y = B + y * bStride;
+            switch (UP_DIV(eCount, AVX512_E_UNIT)) {
+                case 1:
+                    _AMX_MNNPackedMatMulBF16Unit<1>(tmp, A_e, B_y, lBlock, aStride);
+                    break;
+                case 2:
+                    _AMX_MNNPackedMatMulBF16Unit<2>(tmp, A_e, B_y, lBlock, aStride);
+                    break;
+                default:
+                    _AMX_MNNPackedMatMulBF16Unit<3>(tmp, A_e, B_y, lBlock, aStride);
+                    break;
+            }
+            // tmp [e, 16 h] -> C4 of C, the bias is ALIGN_UP4(h)
+            int count      = std::min(4, hC4 - 4 * y);
+            auto biasValue = _mm512_setzero_ps();
+            if (post && nullptr != bias) {
+                biasValue = _mm512_maskz_loadu_ps(_floatMask(4 * count), bias + 16 * y);
+            }
+            auto C_y = C + 4 * y * cStride + 4 * e;
+            for (int x = 0; x < eCount; ++x) {
+                auto v = _mm512_load_ps(tmp + 16 * x);
+                if (post) {
+                    v = _mm512_min_ps(_mm512_max_ps(_mm512_add_ps(v, biasValue), minValue), maxValue);
+                }
+                auto dst = C_y + 4 * x;
+                _mm_storeu_ps(dst, _mm512_extractf32x4_ps(v, 0));
+                if (count > 1) {
+                    _mm_storeu_ps(dst + cStride, _mm512_extractf32x4_ps(v, 1));
+                }
+                if (count > 2) {
+                    _mm_storeu_ps(dst + 2 * cStride, _mm512_extractf32x4_ps(v, 2));
+                }
+                if (count > 3) {
+                    _mm_storeu_ps(dst + 3 * cStride, _mm512_extractf32x4_ps(v, 3));
+                }
+            }
+        }
+    }
+    _tile_release();
+}
+
+void _AMX_MNNPackedMatMulBF16(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                              const float* postParameters, const float* bias) {
+    _AMX_MNNPackedMatMulRemainBF16(C, A, B, parameter[0] / sizeof(float), parameter, postParameters, bias);
+}
@@ -0,0 +1,133 @@
+//
+//  GemmBF16AVX512.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <algorithm>
+#include "FunctionSummary.hpp"
+#include "GemmCommon.hpp"
+#include "core/Macro.h"
+
+// The pair of l of A times the pair of l of the channel j, summed in float
+#define AVX512_BF16_DOT_J(u, j)                                             \
+    {                                                                       \
+        auto w     = (__m512bh)_mm512_set1_epi32(B_##u[j]);                 \
+        z##u##j##0 = _mm512_dpbf16_ps(z##u##j##0, s0, w);                   \
+        if (EU > 1) {                                                       \
+            z##u##j##1 = _mm512_dpbf16_ps(z##u##j##1, s1, w);               \
+        }                                                                   \
+        if (EU > 2) {                                                       \
+            z##u##j##2 = _mm512_dpbf16_ps(z##u##j##2, s2, w);               \
+        }                                                                   \
+    }
+
+// eSize (<= 16 * EU) of A [lPair, aStride, 2] x HU blocks of B [lPair, 4, 2]
+template <int EU, int HU>
+static inline void _AVX512_MNNPackedMatMulBF16Unit(float* C, const int16_t* A, const int16_t* B, size_t lPair,
+                                                   size_t aStride, size_t bStride, size_t cStride, int eSize,
+                                                   const float* postParameters, const float* bias) {
+    AVX512_INIT_J(0, 0);
+    AVX512_INIT_J(0, 1);
+    AVX512_INIT_J(0, 2);
+    AVX512_INIT_J(0, 3);
+    AVX512_INIT_J(1, 0);
+    AVX512_INIT_J(1, 1);
+    AVX512_INIT_J(1, 2);
+    AVX512_INIT_J(1, 3);
+    const auto lastMask = _floatMask(eSize - (EU - 1) * AVX512_E_UNIT);
+    for (size_t p = 0; p < lPair; ++p) {
+        auto A_p = (const int32_t*)A + p * aStride;
+        auto B_0 = (const int32_t*)B + 4 * p;
+        auto B_1 = B_0 + bStride / 2;
+        auto s0  = (__m512bh)(EU > 1 ? _mm512_loadu_si512(A_p) : _mm512_maskz_loadu_epi32(lastMask, A_p));
+        auto s1  = (__m512bh)_mm512_setzero_si512();
+        auto s2  = (__m512bh)_mm512_setzero_si512();
+        if (EU > 1) {
+            s1 = (__m512bh)(EU > 2 ? _mm512_loadu_si512(A_p + AVX512_E_UNIT)
+                                   : _mm512_maskz_loadu_epi32(lastMask, A_p + AVX512_E_UNIT));
+        }
+        if (EU > 2) {
+            s2 = (__m512bh)_mm512_maskz_loadu_epi32(lastMask, A_p + 2 * AVX512_E_UNIT);
+        }
+        AVX512_BF16_DOT_J(0, 0);
+        AVX512_BF16_DOT_J(0, 1);
+        AVX512_BF16_DOT_J(0, 2);
+        AVX512_BF16_DOT_J(0, 3);
+        if (HU > 1) {
+            AVX512_BF16_DOT_J(1, 0);
+            AVX512_BF16_DOT_J(1, 1);
+            AVX512_BF16_DOT_J(1, 2);
+            AVX512_BF16_DOT_J(1, 3);
+        }
+    }
+    const bool post = nullptr != postParameters;
+    auto minValue   = _mm512_set1_ps(post ? postParameters[2] : 0.0f);
+    auto maxValue   = _mm512_set1_ps(post ? postParameters[3] : 0.0f);
+    auto biasValue0 = _mm512_setzero_ps();
+    auto biasValue1 = _mm512_setzero_ps();
+    if (post && nullptr != bias) {
+        biasValue0 = _mm512_broadcast_f32x4(_mm_loadu_ps(bias));
+        if (HU > 1) {
+            biasValue1 = _mm512_broadcast_f32x4(_mm_loadu_ps(bias + 4));
+        }
+    }
+    AVX512_STORE_K(0, 0);
+    AVX512_STORE_K(0, 1);
+    AVX512_STORE_K(0, 2);
+    if (HU > 1) {
+        AVX512_STORE_K(1, 0);
+        AVX512_STORE_K(1, 1);
+        AVX512_STORE_K(1, 2);
+    }
+}
+
+template <int EU>
+static void _AVX512_MNNPackedMatMulBF16E(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                                         size_t aStride, int eSize, const float* postParameters, const float* bias) {
+    auto h            = parameter[2];
+    auto l            = parameter[1];
+    auto cStride      = parameter[3] / sizeof(float);
+    auto bExtraStride = parameter[5] / sizeof(int16_t);
+    auto lPair        = UP_DIV(l, 2);
+    auto bStride      = bExtraStride + lPair * 8;
+    int hC4           = UP_DIV(h, 4);
+    int y             = 0;
+    for (; y + 1 < hC4; y += 2) {
+        _AVX512_MNNPackedMatMulBF16Unit<EU, 2>(C + y * cStride, A, B + y * bStride, lPair, aStride, bStride, cStride,
+                                               eSize, postParameters, nullptr == bias ? nullptr : bias + 4 * y);
+    }
+    if (y < hC4) {
+        _AVX512_MNNPackedMatMulBF16Unit<EU, 1>(C + y * cStride, A, B + y * bStride, lPair, aStride, bStride, cStride,
+                                               eSize, postParameters, nullptr == bias ? nullptr : bias + 4 * y);
+    }
+}
+
+void _AVX512_MNNPackedMatMulRemainBF16(float* C, const int16_t* A, const int16_t* B, size_t eSize,
+                                       const size_t* parameter, const float* postParameters, const float* bias) {
+    auto aStride = parameter[0] / sizeof(float);
+    // The e beyond a pass of 48 only happen for a larger eP of the caller
+    for (int e = 0; e < eSize; e += AVX512_PACK_E) {
+        int eCount = std::min((int)eSize - e, AVX512_PACK_E);
+        auto C_e   = C + 4 * e;
+        auto A_e   = A + 2 * e;
+        switch (UP_DIV(eCount, AVX512_E_UNIT)) {
+            case 1:
+                _AVX512_MNNPackedMatMulBF16E<1>(C_e, A_e, B, parameter, aStride, eCount, postParameters, bias);
+                break;
+            case 2:
+                _AVX512_MNNPackedMatMulBF16E<2>(C_e, A_e, B, parameter, aStride, eCount, postParameters, bias);
+                break;
+            default:
+                _AVX512_MNNPackedMatMulBF16E<3>(C_e, A_e, B, parameter, aStride, eCount, postParameters, bias);
+                break;
+        }
+    }
+}
+
+void _AVX512_MNNPackedMatMulBF16(float* C, const int16_t* A, const int16_t* B, const size_t* parameter,
+                                 const float* postParameters, const float* bias) {
+    _AVX512_MNNPackedMatMulRemainBF16(C, A, B, parameter[0] / sizeof(float), parameter, postParameters, bias);
+}
@@ -0,0 +1,96 @@
+//
+//  GemmCommon.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#ifndef GemmCommon_hpp
+#define GemmCommon_hpp
+#include "FunctionSummary.hpp"
+
+// e of a __m512, and eP of the packed A
+#define AVX512_E_UNIT 16
+#define AVX512_PACK_E (3 * AVX512_E_UNIT)
+
+// The first n floats
+static inline __mmask16 _floatMask(int n) {
+    return (__mmask16)((1 << n) - 1);
+}
+
+// The 4x4 transpose in each 128 bits of r0 ~ r3
+static inline void _transposeInLanes(__m512& r0, __m512& r1, __m512& r2, __m512& r3) {
+    auto t0 = _mm512_unpacklo_ps(r0, r1);
+    auto t1 = _mm512_unpackhi_ps(r0, r1);
+    auto t2 = _mm512_unpacklo_ps(r2, r3);
+    auto t3 = _mm512_unpackhi_ps(r2, r3);
+    r0      = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t0), _mm512_castps_pd(t2)));
+    r1      = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t0), _mm512_castps_pd(t2)));
+    r2      = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t1), _mm512_castps_pd(t3)));
+    r3      = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t1), _mm512_castps_pd(t3)));
+}
+
+// The 4x4 transpose of the 128 bits of r0 ~ r3
+static inline void _transposeLanes(__m512& r0, __m512& r1, __m512& r2, __m512& r3) {
+    auto u0 = _mm512_shuffle_f32x4(r0, r1, _MM_SHUFFLE(2, 0, 2, 0));
+    auto u1 = _mm512_shuffle_f32x4(r0, r1, _MM_SHUFFLE(3, 1, 3, 1));
+    auto u2 = _mm512_shuffle_f32x4(r2, r3, _MM_SHUFFLE(2, 0, 2, 0));
+    auto u3 = _mm512_shuffle_f32x4(r2, r3, _MM_SHUFFLE(3, 1, 3, 1));
+    r0      = _mm512_shuffle_f32x4(u0, u2, _MM_SHUFFLE(2, 0, 2, 0));
+    r1      = _mm512_shuffle_f32x4(u1, u3, _MM_SHUFFLE(2, 0, 2, 0));
+    r2      = _mm512_shuffle_f32x4(u0, u2, _MM_SHUFFLE(3, 1, 3, 1));
+    r3      = _mm512_shuffle_f32x4(u1, u3, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// r_k of the e 4k ~ 4k + 3 in C4 -> r_j of the 16 e of the channel j
+static inline void _transposeC4ToE(__m512& r0, __m512& r1, __m512& r2, __m512& r3) {
+    _transposeLanes(r0, r1, r2, r3);
+    _transposeInLanes(r0, r1, r2, r3);
+}
+
+// The inverse of _transposeC4ToE
+static inline void _transposeEToC4(__m512& r0, __m512& r1, __m512& r2, __m512& r3) {
+    _transposeInLanes(r0, r1, r2, r3);
+    _transposeLanes(r0, r1, r2, r3);
+}
+
+// count (may be <= 0 or > 4) of e in C4 of v, with the bias and the clamp
+static inline void _storeC4(float* dst, __m512 v, int count, bool post, __m512 biasValue, __m512 minValue,
+                            __m512 maxValue) {
+    if (count <= 0) {
+        return;
+    }
+    if (post) {
+        v = _mm512_min_ps(_mm512_max_ps(_mm512_add_ps(v, biasValue), minValue), maxValue);
+    }
+    if (count >= 4) {
+        _mm512_storeu_ps(dst, v);
+    } else {
+        _mm512_mask_storeu_ps(dst, _floatMask(4 * count), v);
+    }
+}
+
+// The accumulators of 16 e of the channel j in the block u of h
+#define AVX512_INIT_J(u, j)                   \
+    auto z##u##j##0 = _mm512_setzero_ps(); \
+    auto z##u##j##1 = _mm512_setzero_ps(); \
+    auto z##u##j##2 = _mm512_setzero_ps();
+
+// The e 16k ~ 16k + 15 of the block u of h in C4, from the accumulators z##u##j##k of 16 e of the channel j
+#define AVX512_STORE_K(u, k)                                                                     \
+    if (k < EU) {                                                                                \
+        auto r0 = z##u##0##k;                                                                    \
+        auto r1 = z##u##1##k;                                                                    \
+        auto r2 = z##u##2##k;                                                                    \
+        auto r3 = z##u##3##k;                                                                    \
+        _transposeEToC4(r0, r1, r2, r3);                                                         \
+        auto dstK  = C + u * cStride + 4 * AVX512_E_UNIT * k;                                    \
+        int eCount = eSize - AVX512_E_UNIT * k;                                                  \
+        _storeC4(dstK + 16 * 0, r0, eCount - 4 * 0, post, biasValue##u, minValue, maxValue);    \
+        _storeC4(dstK + 16 * 1, r1, eCount - 4 * 1, post, biasValue##u, minValue, maxValue);    \
+        _storeC4(dstK + 16 * 2, r2, eCount - 4 * 2, post, biasValue##u, minValue, maxValue);    \
+        _storeC4(dstK + 16 * 3, r3, eCount - 4 * 3, post, biasValue##u, minValue, maxValue);    \
+    }
+
+#endif
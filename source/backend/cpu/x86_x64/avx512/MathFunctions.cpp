@@ -0,0 +1,119 @@
+//
+//  MathFunctions.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "FunctionSummary.hpp"
+#include "backend/cpu/compute/VectorMath.hpp"
+
+namespace {
+// The bitwise float operations of AVX-512 need AVX512DQ, those of the integers are in AVX512F
+struct AVX512Ops {
+    typedef __m512 Float;
+    typedef __mmask16 Mask;
+    static const int width = 16;
+    static inline Float set(float v) {
+        return _mm512_set1_ps(v);
+    }
+    static inline Float load(const float* ptr) {
+        return _mm512_loadu_ps(ptr);
+    }
+    static inline void save(float* ptr, Float v) {
+        _mm512_storeu_ps(ptr, v);
+    }
+    static inline Float add(Float a, Float b) {
+        return _mm512_add_ps(a, b);
+    }
+    static inline Float sub(Float a, Float b) {
+        return _mm512_sub_ps(a, b);
+    }
+    static inline Float mul(Float a, Float b) {
+        return _mm512_mul_ps(a, b);
+    }
+    static inline Float div(Float a, Float b) {
+        return _mm512_div_ps(a, b);
+    }
+    static inline Float fma(Float a, Float b, Float c) {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+    static inline Float min(Float a, Float b) {
+        return _mm512_min_ps(a, b);
+    }
+    static inline Float max(Float a, Float b) {
+        return _mm512_max_ps(a, b);
+    }
+    static inline Float abs(Float a) {
+        return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(0x7fffffff)));
+    }
+    static inline Mask less(Float a, Float b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+    }
+    static inline Mask equal(Float a, Float b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+    }
+    static inline Mask isNan(Float a) {
+        return _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q);
+    }
+    static inline Float select(Mask m, Float a, Float b) {
+        return _mm512_mask_blend_ps(m, b, a);
+    }
+    static inline Float round(Float a) {
+        return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+    static inline Float pow2(Float n) {
+        auto bits = _mm512_add_epi32(_mm512_cvtps_epi32(n), _mm512_set1_epi32(127));
+        return _mm512_castsi512_ps(_mm512_slli_epi32(bits, 23));
+    }
+    static inline Float exponent(Float x) {
+        auto bits = _mm512_srli_epi32(_mm512_castps_si512(x), 23);
+        return _mm512_cvtepi32_ps(_mm512_and_si512(bits, _mm512_set1_epi32(0xff)));
+    }
+    static inline Float mantissa(Float x) {
+        auto bits = _mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(0x807fffff));
+        return _mm512_castsi512_ps(_mm512_or_si512(bits, _mm512_set1_epi32(0x3f000000)));
+    }
+    static inline Float copySign(Float x, Float s) {
+        auto sign = _mm512_and_si512(_mm512_castps_si512(s), _mm512_set1_epi32(0x80000000));
+        return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(x), sign));
+    }
+    static inline Float truncate(Float x) {
+        return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(0xfffff000)));
+    }
+};
+typedef MNN::VectorMath<AVX512Ops> AVX512Math;
+} // namespace
+
+void _AVX512_MNNVectorExp(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX512Ops, AVX512Math::exp>(dst, src, size);
+}
+
+void _AVX512_MNNVectorLog(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX512Ops, AVX512Math::log>(dst, src, size);
+}
+
+void _AVX512_MNNVectorErf(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX512Ops, AVX512Math::erf>(dst, src, size);
+}
+
+void _AVX512_MNNTanh(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX512Ops, AVX512Math::tanh>(dst, src, size);
+}
+
+void _AVX512_MNNSigmoid(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX512Ops, AVX512Math::sigmoid>(dst, src, size);
+}
+
+void _AVX512_MNNSiLU(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX512Ops, AVX512Math::silu>(dst, src, size);
+}
+
+void _AVX512_MNNGelu(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX512Ops, AVX512Math::gelu>(dst, src, size);
+}
+
+void _AVX512_MNNGeluTanh(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<AVX512Ops, AVX512Math::geluTanh>(dst, src, size);
+}
@@ -44,6 +44,10 @@ static const int kCpuHasAVX512VBMI = 0x20000;
 static const int kCpuHasAVX512VBMI2 = 0x40000;
 static const int kCpuHasAVX512VBITALG = 0x80000;
 static const int kCpuHasAVX512VPOPCNTDQ = 0x100000;
+static const int kCpuHasAVX512VNNI = 0x1000000;
+static const int kCpuHasAVXVNNI = 0x2000000;
+static const int kCpuHasAVX512BF16 = 0x4000000;
+static const int kCpuHasAMXBF16 = 0x8000000;
 
 // These flags are only valid on MIPS processors.
 static const int kCpuHasMIPS = 0x200000;
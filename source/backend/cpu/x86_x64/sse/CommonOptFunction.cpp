@@ -7,6 +7,7 @@
 //
 
 #include <emmintrin.h>
+#include <math.h>
 #include <string.h>
 #include <algorithm>
 #include "core/Macro.h"
@@ -218,3 +219,53 @@ void _SSE_MNNExpC8(float* dest, const float* source, const float* parameters, si
         _mm_store_ps(dest + 4 * i, _mm_mul_ps(expBasic, expRemain));
     }
 }
+
+void _SSE_MNNLayerNorm(float* dst, const float* src, const float* residual, const float* gamma, const float* beta,
+                       float epsilon, size_t size) {
+    float shift  = src[0] + (nullptr != residual ? residual[0] : 0.0f);
+    auto sizeC4  = size / 4;
+    auto shiftV  = _mm_set1_ps(shift);
+    auto sumV    = _mm_set1_ps(0.0f);
+    auto squareV = _mm_set1_ps(0.0f);
+    for (int i = 0; i < sizeC4; ++i) {
+        auto x = _mm_loadu_ps(src + 4 * i);
+        if (nullptr != residual) {
+            x = _mm_add_ps(x, _mm_loadu_ps(residual + 4 * i));
+            _mm_storeu_ps(dst + 4 * i, x);
+        }
+        x       = _mm_sub_ps(x, shiftV);
+        sumV    = _mm_add_ps(sumV, x);
+        squareV = _mm_add_ps(squareV, _mm_mul_ps(x, x));
+    }
+    float sumTemp[4], squareTemp[4];
+    _mm_storeu_ps(sumTemp, sumV);
+    _mm_storeu_ps(squareTemp, squareV);
+    float sum    = sumTemp[0] + sumTemp[1] + sumTemp[2] + sumTemp[3];
+    float square = squareTemp[0] + squareTemp[1] + squareTemp[2] + squareTemp[3];
+    for (int i = sizeC4 * 4; i < size; ++i) {
+        auto x = src[i];
+        if (nullptr != residual) {
+            x += residual[i];
+            dst[i] = x;
+        }
+        x -= shift;
+        sum += x;
+        square += x * x;
+    }
+    float mean     = sum / size;
+    float variance = ALIMAX(square / size - mean * mean, 0.0f);
+    float scale    = 1.0f / sqrtf(variance + epsilon);
+    mean += shift;
+    // The sum of residual is saved in dst
+    auto input  = nullptr != residual ? dst : src;
+    auto meanV  = _mm_set1_ps(mean);
+    auto scaleV = _mm_set1_ps(scale);
+    for (int i = 0; i < sizeC4; ++i) {
+        auto x = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(input + 4 * i), meanV), scaleV);
+        x      = _mm_add_ps(_mm_mul_ps(x, _mm_loadu_ps(gamma + 4 * i)), _mm_loadu_ps(beta + 4 * i));
+        _mm_storeu_ps(dst + 4 * i, x);
+    }
+    for (int i = sizeC4 * 4; i < size; ++i) {
+        dst[i] = (input[i] - mean) * scale * gamma[i] + beta[i];
+    }
+}
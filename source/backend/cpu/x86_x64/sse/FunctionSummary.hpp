@@ -74,6 +74,22 @@ void _SSE_MNNConvRunForLineDepthwise(float* dst, const float* src, const float*
                                 size_t srcHStep, size_t dstHStep);
 void _SSE_MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad, size_t dst_step,
                                             size_t dst_depth_quad, const QuanPostTreatParameters* post);
+void _SSE_MNNLineDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_t* bias_z,
+                                              size_t width, size_t src_w_step, size_t fw, size_t fh,
+                                              size_t dilateX_step, size_t dilateY_step, const float* scale_z,
+                                              size_t mode);
+void _SSE_MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
+                                          size_t width, size_t dst_step, size_t dst_depth_quad);
 void _SSE_MNNExpC8(float* dest, const float* source, const float* parameters, size_t countC8);
 void _SSE_MNNPackForMatMul_B(float* dest, const float* source, size_t h, size_t l, bool transpose);
 bool _SSE_MNNReorder4x4ByPlatform(float* dst, size_t number);
+void _SSE_MNNLayerNorm(float* dst, const float* src, const float* residual, const float* gamma, const float* beta,
+                       float epsilon, size_t size);
+void _SSE_MNNVectorExp(float* dst, const float* src, size_t size);
+void _SSE_MNNVectorLog(float* dst, const float* src, size_t size);
+void _SSE_MNNVectorErf(float* dst, const float* src, size_t size);
+void _SSE_MNNTanh(float* dst, const float* src, size_t size);
+void _SSE_MNNSigmoid(float* dst, const float* src, size_t size);
+void _SSE_MNNSiLU(float* dst, const float* src, size_t size);
+void _SSE_MNNGelu(float* dst, const float* src, size_t size);
+void _SSE_MNNGeluTanh(float* dst, const float* src, size_t size);
@@ -301,6 +301,106 @@ E##u = _mm_add_epi32(E##u, _mm_madd_epi16(w##u##v, s3##v));\
     }
 }
 
+void _SSE_MNNLineDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src, const int8_t* weight, const int32_t* bias_z,
+                                              size_t width, size_t src_w_step, size_t fw, size_t fh,
+                                              size_t dilateX_step, size_t dilateY_step, const float* scale_z,
+                                              size_t mode) {
+    auto biasValue  = _mm_loadu_si128((const __m128i*)bias_z);
+    auto scaleValue = _mm_loadu_ps(scale_z);
+    __m128 minValue = _mm_set1_ps(-128.0f);
+    __m128 maxValue = _mm_set1_ps(127.0f);
+    for (int dx = 0; dx < width; ++dx) {
+        const auto src_z = src + src_w_step * dx;
+        __m128i d0       = biasValue;
+        for (int fy = 0; fy < fh; ++fy) {
+            const auto src_y    = src_z + fy * dilateY_step;
+            const auto weight_y = weight + fy * fw * 4;
+            for (int fx = 0; fx < fw; ++fx) {
+                auto s = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(*(const int32_t*)(src_y + fx * dilateX_step)));
+                auto w = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(*(const int32_t*)(weight_y + 4 * fx)));
+                d0     = _mm_add_epi32(d0, _mm_mullo_epi32(s, w));
+            }
+        }
+        __m128 f0 = _mm_mul_ps(_mm_cvtepi32_ps(d0), scaleValue);
+        f0        = _mm_min_ps(f0, maxValue);
+        f0        = _mm_max_ps(f0, minValue);
+        // Round half away from zero as roundf: t + trunc(2 * (f - t)), t = trunc(f). 3: _MM_FROUND_TO_ZERO
+        __m128 t0 = _mm_round_ps(f0, 3);
+        f0        = _mm_sub_ps(f0, t0);
+        f0        = _mm_add_ps(t0, _mm_round_ps(_mm_add_ps(f0, f0), 3));
+        d0        = _mm_cvtps_epi32(f0);
+        // Int32 -> Int8
+        d0 = _mm_packs_epi32(d0, d0);
+        d0 = _mm_packs_epi16(d0, d0);
+        *(int32_t*)(dst + 4 * dx) = _mm_cvtsi128_si32(d0);
+    }
+}
+
+// The products of int8 widened to int16 are summed by pmaddwd, exact for -128 too
+void _SSE_MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
+                                          size_t width, size_t dst_step, size_t dst_depth_quad) {
+#define LOAD_SRC(i) _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*)(src_z + 8 * (i))))
+#define STORE_DST(i, d0, d1, d2, d3) \
+    _mm_storeu_ps(dst_z + 4 * (i), _mm_cvtepi32_ps(_mm_hadd_epi32(_mm_hadd_epi32(d0, d1), _mm_hadd_epi32(d2, d3))))
+    for (int dz = 0; dz < dst_depth_quad; ++dz) {
+        auto weight_dz = weight + src_depth_quad * dz * 32;
+        auto dst_z     = dst + dz * dst_step;
+        int w          = 0;
+        for (; w + 1 < width; w += 2) {
+            auto d0 = _mm_setzero_si128();
+            auto d1 = _mm_setzero_si128();
+            auto d2 = _mm_setzero_si128();
+            auto d3 = _mm_setzero_si128();
+            auto e0 = _mm_setzero_si128();
+            auto e1 = _mm_setzero_si128();
+            auto e2 = _mm_setzero_si128();
+            auto e3 = _mm_setzero_si128();
+            for (int sz = 0; sz < src_depth_quad; ++sz) {
+                auto weight_sz = weight_dz + 32 * sz;
+                auto src_z     = src + sz * width * 8 + 8 * w;
+                auto w01       = _mm_loadu_si128((const __m128i*)weight_sz);
+                auto w23       = _mm_loadu_si128((const __m128i*)(weight_sz + 16));
+                auto w0        = _mm_cvtepi8_epi16(w01);
+                auto w1        = _mm_cvtepi8_epi16(_mm_srli_si128(w01, 8));
+                auto w2        = _mm_cvtepi8_epi16(w23);
+                auto w3        = _mm_cvtepi8_epi16(_mm_srli_si128(w23, 8));
+                auto s0        = LOAD_SRC(0);
+                auto s1        = LOAD_SRC(1);
+                d0 = _mm_add_epi32(d0, _mm_madd_epi16(w0, s0));
+                d1 = _mm_add_epi32(d1, _mm_madd_epi16(w1, s0));
+                d2 = _mm_add_epi32(d2, _mm_madd_epi16(w2, s0));
+                d3 = _mm_add_epi32(d3, _mm_madd_epi16(w3, s0));
+                e0 = _mm_add_epi32(e0, _mm_madd_epi16(w0, s1));
+                e1 = _mm_add_epi32(e1, _mm_madd_epi16(w1, s1));
+                e2 = _mm_add_epi32(e2, _mm_madd_epi16(w2, s1));
+                e3 = _mm_add_epi32(e3, _mm_madd_epi16(w3, s1));
+            }
+            STORE_DST(w, d0, d1, d2, d3);
+            STORE_DST(w + 1, e0, e1, e2, e3);
+        }
+        for (; w < width; ++w) {
+            auto d0 = _mm_setzero_si128();
+            auto d1 = _mm_setzero_si128();
+            auto d2 = _mm_setzero_si128();
+            auto d3 = _mm_setzero_si128();
+            for (int sz = 0; sz < src_depth_quad; ++sz) {
+                auto weight_sz = weight_dz + 32 * sz;
+                auto src_z     = src + sz * width * 8 + 8 * w;
+                auto w01       = _mm_loadu_si128((const __m128i*)weight_sz);
+                auto w23       = _mm_loadu_si128((const __m128i*)(weight_sz + 16));
+                auto s0        = LOAD_SRC(0);
+                d0 = _mm_add_epi32(d0, _mm_madd_epi16(_mm_cvtepi8_epi16(w01), s0));
+                d1 = _mm_add_epi32(d1, _mm_madd_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(w01, 8)), s0));
+                d2 = _mm_add_epi32(d2, _mm_madd_epi16(_mm_cvtepi8_epi16(w23), s0));
+                d3 = _mm_add_epi32(d3, _mm_madd_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(w23, 8)), s0));
+            }
+            STORE_DST(w, d0, d1, d2, d3);
+        }
+    }
+#undef LOAD_SRC
+#undef STORE_DST
+}
+
 void MNNPackC4(float* dst, const float* src, size_t area, size_t depth) {
     auto areaC4  = area / 4;
     auto depthC4 = depth / 4;
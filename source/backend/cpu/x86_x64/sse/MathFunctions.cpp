@@ -0,0 +1,118 @@
+//
+//  MathFunctions.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <smmintrin.h>
+#include "FunctionSummary.hpp"
+#include "backend/cpu/compute/VectorMath.hpp"
+
+namespace {
+struct SSEOps {
+    typedef __m128 Float;
+    typedef __m128 Mask;
+    static const int width = 4;
+    static inline Float set(float v) {
+        return _mm_set1_ps(v);
+    }
+    static inline Float load(const float* ptr) {
+        return _mm_loadu_ps(ptr);
+    }
+    static inline void save(float* ptr, Float v) {
+        _mm_storeu_ps(ptr, v);
+    }
+    static inline Float add(Float a, Float b) {
+        return _mm_add_ps(a, b);
+    }
+    static inline Float sub(Float a, Float b) {
+        return _mm_sub_ps(a, b);
+    }
+    static inline Float mul(Float a, Float b) {
+        return _mm_mul_ps(a, b);
+    }
+    static inline Float div(Float a, Float b) {
+        return _mm_div_ps(a, b);
+    }
+    static inline Float fma(Float a, Float b, Float c) {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+    static inline Float min(Float a, Float b) {
+        return _mm_min_ps(a, b);
+    }
+    static inline Float max(Float a, Float b) {
+        return _mm_max_ps(a, b);
+    }
+    static inline Float abs(Float a) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+    }
+    static inline Mask less(Float a, Float b) {
+        return _mm_cmplt_ps(a, b);
+    }
+    static inline Mask equal(Float a, Float b) {
+        return _mm_cmpeq_ps(a, b);
+    }
+    static inline Mask isNan(Float a) {
+        return _mm_cmpunord_ps(a, a);
+    }
+    static inline Float select(Mask m, Float a, Float b) {
+        return _mm_blendv_ps(b, a, m);
+    }
+    static inline Float round(Float a) {
+        return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+    static inline Float pow2(Float n) {
+        auto bits = _mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127));
+        return _mm_castsi128_ps(_mm_slli_epi32(bits, 23));
+    }
+    static inline Float exponent(Float x) {
+        auto bits = _mm_srli_epi32(_mm_castps_si128(x), 23);
+        return _mm_cvtepi32_ps(_mm_and_si128(bits, _mm_set1_epi32(0xff)));
+    }
+    static inline Float mantissa(Float x) {
+        auto bits = _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(0x807fffff));
+        return _mm_castsi128_ps(_mm_or_si128(bits, _mm_set1_epi32(0x3f000000)));
+    }
+    static inline Float copySign(Float x, Float s) {
+        return _mm_or_ps(x, _mm_and_ps(s, _mm_set1_ps(-0.0f)));
+    }
+    static inline Float truncate(Float x) {
+        return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0xfffff000)));
+    }
+};
+typedef MNN::VectorMath<SSEOps> SSEMath;
+} // namespace
+
+void _SSE_MNNVectorExp(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<SSEOps, SSEMath::exp>(dst, src, size);
+}
+
+void _SSE_MNNVectorLog(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<SSEOps, SSEMath::log>(dst, src, size);
+}
+
+void _SSE_MNNVectorErf(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<SSEOps, SSEMath::erf>(dst, src, size);
+}
+
+void _SSE_MNNTanh(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<SSEOps, SSEMath::tanh>(dst, src, size);
+}
+
+void _SSE_MNNSigmoid(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<SSEOps, SSEMath::sigmoid>(dst, src, size);
+}
+
+void _SSE_MNNSiLU(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<SSEOps, SSEMath::silu>(dst, src, size);
+}
+
+void _SSE_MNNGelu(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<SSEOps, SSEMath::gelu>(dst, src, size);
+}
+
+void _SSE_MNNGeluTanh(float* dst, const float* src, size_t size) {
+    MNN::MNNVectorMathApply<SSEOps, SSEMath::geluTanh>(dst, src, size);
+}
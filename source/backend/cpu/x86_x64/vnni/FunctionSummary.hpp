@@ -0,0 +1,54 @@
+//
+//  FunctionSummary.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#include <MNN/MNNDefine.h>
+#include <stdint.h>
+#include "backend/cpu/compute/Int8FunctionsOpt.h"
+
+// The int8 kernels of vpdpbusd, which multiplies uint8 by int8. The source is offset by 128 to uint8, so the bias of
+// MNNGemmInt8AddBiasScale_16x4_Unit must be subtracted by 128 * (sum of the weights), see MNNGetInt8GemmSrcOffset.
+extern "C" {
+void _AVX_VNNI_MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                 size_t src_depth_quad, size_t dst_step, size_t dst_depth_quad,
+                                                 const QuanPostTreatParameters* post);
+void _AVX_VNNI_MNNLineDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                    const int32_t* bias_z, size_t width, size_t src_w_step, size_t fw,
+                                                    size_t fh, size_t dilateX_step, size_t dilateY_step,
+                                                    const float* scale_z, size_t mode);
+void _AVX_VNNI_MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t* weight,
+                                               size_t src_depth_quad, size_t width, size_t dst_step,
+                                               size_t dst_depth_quad);
+
+void _AVX512_VNNI_MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                    size_t src_depth_quad, size_t dst_step, size_t dst_depth_quad,
+                                                    const QuanPostTreatParameters* post);
+void _AVX512_VNNI_MNNLineDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                       const int32_t* bias_z, size_t width, size_t src_w_step,
+                                                       size_t fw, size_t fh, size_t dilateX_step, size_t dilateY_step,
+                                                       const float* scale_z, size_t mode);
+void _AVX512_VNNI_MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t* weight,
+                                                  size_t src_depth_quad, size_t width, size_t dst_step,
+                                                  size_t dst_depth_quad);
+
+// vpdpbusd emulated by AVX2, only to run the kernels above on the machines without VNNI, see MNN_VNNI_EMULATE
+void _AVX_VNNIEmulate_MNNGemmInt8AddBiasScale_16x4_Unit(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                        size_t src_depth_quad, size_t dst_step,
+                                                        size_t dst_depth_quad, const QuanPostTreatParameters* post);
+void _AVX_VNNIEmulate_MNNLineDepthWiseInt8AddBiasScaleUnit(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                           const int32_t* bias_z, size_t width, size_t src_w_step,
+                                                           size_t fw, size_t fh, size_t dilateX_step,
+                                                           size_t dilateY_step, const float* scale_z, size_t mode);
+void _AVX_VNNIEmulate_MNNGemmInt8toFloat32_8x4_Common(float* dst, const int8_t* src, const int8_t* weight,
+                                                      size_t src_depth_quad, size_t width, size_t dst_step,
+                                                      size_t dst_depth_quad);
+}
@@ -0,0 +1,13 @@
+//
+//  Int8FunctionsAVX512VNNI.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+// The EVEX vpdpbusd of AVX512-VNNI in 256 / 128 bits by AVX512VL (Cascade Lake, Ice Lake)
+#define MNN_VNNI_FUNCTION(name) _AVX512_VNNI_##name
+#define MNN_VNNI_DPBUSD _mm256_dpbusd_epi32
+#define MNN_VNNI_DPBUSD_128 _mm_dpbusd_epi32
+#include "Int8FunctionsVNNI.hpp"
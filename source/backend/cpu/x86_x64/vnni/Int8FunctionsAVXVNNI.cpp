@@ -0,0 +1,13 @@
+//
+//  Int8FunctionsAVXVNNI.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+// The VEX vpdpbusd of AVX-VNNI (Alder Lake, Sapphire Rapids)
+#define MNN_VNNI_FUNCTION(name) _AVX_VNNI_##name
+#define MNN_VNNI_DPBUSD _mm256_dpbusd_avx_epi32
+#define MNN_VNNI_DPBUSD_128 _mm_dpbusd_avx_epi32
+#include "Int8FunctionsVNNI.hpp"
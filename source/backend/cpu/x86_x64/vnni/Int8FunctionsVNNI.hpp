@@ -0,0 +1,229 @@
+//
+//  Int8FunctionsVNNI.hpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+// The int8 kernels of vpdpbusd, included with
+//   MNN_VNNI_FUNCTION(name) : the name of the kernel
+//   MNN_VNNI_DPBUSD(z, u, s) : z + the sums of 4 uint8 of u x int8 of s of __m256i in int32
+//   MNN_VNNI_DPBUSD_128(z, u, s) : the same of __m128i
+
+#include <string.h>
+#include "FunctionSummary.hpp"
+#include "backend/cpu/x86_x64/sse/FunctionSummary.hpp"
+#include "core/Macro.h"
+
+// Taps of the depthwise kernel kept in registers by the line kernel, larger kernels use the SSE one
+#define MNN_VNNI_DEPTHWISE_TAPS 64
+
+// Clamped and rounded half away from zero to int32, exactly as roundf of MNNInt32ToInt8: t + trunc(2 * (f - t)) for
+// t = trunc(f), while trunc(f +- 0.5) rounds up 0.49999997
+static inline __m256i _vnniRound(__m256 f, __m256 minValue, __m256 maxValue) {
+    f      = _mm256_min_ps(f, maxValue);
+    f      = _mm256_max_ps(f, minValue);
+    auto t = _mm256_round_ps(f, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    auto d = _mm256_sub_ps(f, t);
+    d      = _mm256_round_ps(_mm256_add_ps(d, d), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    return _mm256_cvtps_epi32(_mm256_add_ps(t, d));
+}
+
+static inline __m128i _vnniRound128(__m128 f, __m128 minValue, __m128 maxValue) {
+    f      = _mm_min_ps(f, maxValue);
+    f      = _mm_max_ps(f, minValue);
+    auto t = _mm_round_ps(f, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    auto d = _mm_sub_ps(f, t);
+    d      = _mm_round_ps(_mm_add_ps(d, d), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    return _mm_cvtps_epi32(_mm_add_ps(t, d));
+}
+
+void MNN_VNNI_FUNCTION(MNNGemmInt8AddBiasScale_16x4_Unit)(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                          size_t src_depth_quad, size_t dst_step,
+                                                          size_t dst_depth_quad, const QuanPostTreatParameters* post) {
+    const auto offset   = _mm256_set1_epi8(-128);
+    const auto minValue = _mm256_set1_ps((float)post->minValue);
+    const auto maxValue = _mm256_set1_ps((float)post->maxValue);
+    for (int dz = 0; dz < dst_depth_quad; ++dz) {
+        const auto weight_dz = weight + dz * src_depth_quad * (GEMM_INT8_UNIT * GEMM_INT8_SRC_UNIT);
+        const auto bias_dz   = post->bias + dz * GEMM_INT8_UNIT;
+        const auto scale_dz  = post->scale + dz * GEMM_INT8_UNIT;
+        auto dst_z           = dst + dz * dst_step;
+        // d0j: x = 0, 1 of the output channel j, d1j: x = 2, 3, each is 4 int32 to sum
+        auto d00 = _mm256_setzero_si256();
+        auto d01 = _mm256_setzero_si256();
+        auto d02 = _mm256_setzero_si256();
+        auto d03 = _mm256_setzero_si256();
+        auto d10 = _mm256_setzero_si256();
+        auto d11 = _mm256_setzero_si256();
+        auto d12 = _mm256_setzero_si256();
+        auto d13 = _mm256_setzero_si256();
+        for (int sz = 0; sz < src_depth_quad; ++sz) {
+            const auto weight_sz = weight_dz + (GEMM_INT8_UNIT * GEMM_INT8_SRC_UNIT) * sz;
+            const auto src_z     = src + sz * GEMM_INT8_DST_XUNIT * GEMM_INT8_SRC_UNIT;
+            // int8 + 128 = uint8
+            auto s0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(src_z)), offset);
+            auto s1 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(src_z + 2 * GEMM_INT8_SRC_UNIT)), offset);
+            auto w0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(weight_sz + 0 * GEMM_INT8_SRC_UNIT)));
+            auto w1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(weight_sz + 1 * GEMM_INT8_SRC_UNIT)));
+            auto w2 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(weight_sz + 2 * GEMM_INT8_SRC_UNIT)));
+            auto w3 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(weight_sz + 3 * GEMM_INT8_SRC_UNIT)));
+            d00 = MNN_VNNI_DPBUSD(d00, s0, w0);
+            d01 = MNN_VNNI_DPBUSD(d01, s0, w1);
+            d02 = MNN_VNNI_DPBUSD(d02, s0, w2);
+            d03 = MNN_VNNI_DPBUSD(d03, s0, w3);
+            d10 = MNN_VNNI_DPBUSD(d10, s1, w0);
+            d11 = MNN_VNNI_DPBUSD(d11, s1, w1);
+            d12 = MNN_VNNI_DPBUSD(d12, s1, w2);
+            d13 = MNN_VNNI_DPBUSD(d13, s1, w3);
+        }
+        // Low 128 bits: x = 0 (2) of the 4 channels, high 128 bits: x = 1 (3)
+        auto d0 = _mm256_hadd_epi32(_mm256_hadd_epi32(d00, d01), _mm256_hadd_epi32(d02, d03));
+        auto d1 = _mm256_hadd_epi32(_mm256_hadd_epi32(d10, d11), _mm256_hadd_epi32(d12, d13));
+
+        auto biasValue  = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)bias_dz));
+        auto scaleValue = _mm256_broadcast_ps((const __m128*)scale_dz);
+        auto f0         = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(d0, biasValue)), scaleValue);
+        auto f1         = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(d1, biasValue)), scaleValue);
+        d0              = _vnniRound(f0, minValue, maxValue);
+        d1              = _vnniRound(f1, minValue, maxValue);
+
+        // Int32 -> Int8, the packs of AVX2 are in 128 bits: x = 0, 2, 1, 3
+        auto d01I16 = _mm256_packs_epi32(d0, d1);
+        auto d8     = _mm_packs_epi16(_mm256_castsi256_si128(d01I16), _mm256_extracti128_si256(d01I16, 1));
+        d8          = _mm_shuffle_epi32(d8, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128((__m128i*)dst_z, d8);
+    }
+}
+
+void MNN_VNNI_FUNCTION(MNNLineDepthWiseInt8AddBiasScaleUnit)(int8_t* dst, const int8_t* src, const int8_t* weight,
+                                                             const int32_t* bias_z, size_t width, size_t src_w_step,
+                                                             size_t fw, size_t fh, size_t dilateX_step,
+                                                             size_t dilateY_step, const float* scale_z, size_t mode) {
+    const int taps   = (int)(fw * fh);
+    const int groups = UP_DIV(taps, 4);
+    if (taps > MNN_VNNI_DEPTHWISE_TAPS) {
+        _SSE_MNNLineDepthWiseInt8AddBiasScaleUnit(dst, src, weight, bias_z, width, src_w_step, fw, fh, dilateX_step,
+                                                  dilateY_step, scale_z, mode);
+        return;
+    }
+    // The weights of the taps by groups of 4, [group, channel, tap], so that vpdpbusd sums the 4 taps of a channel.
+    // The padding taps read the first one with zero weight.
+    int8_t weightGroup[MNN_VNNI_DEPTHWISE_TAPS * 4];
+    int32_t offsets[MNN_VNNI_DEPTHWISE_TAPS];
+    int32_t biasValue[4];
+    ::memcpy(biasValue, bias_z, 4 * sizeof(int32_t));
+    for (int t = 0; t < groups * 4; ++t) {
+        auto weightT = weightGroup + (t / 4) * 16 + t % 4;
+        if (t >= taps) {
+            offsets[t] = 0;
+            for (int c = 0; c < 4; ++c) {
+                weightT[4 * c] = 0;
+            }
+            continue;
+        }
+        offsets[t] = (int32_t)((t / fw) * dilateY_step + (t % fw) * dilateX_step);
+        for (int c = 0; c < 4; ++c) {
+            weightT[4 * c] = weight[4 * t + c];
+            // The compensation of the source offset by 128
+            biasValue[c] -= 128 * (int32_t)weight[4 * t + c];
+        }
+    }
+    // [tap, channel] -> [channel, tap]
+    const auto transpose = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const auto offset    = _mm_set1_epi8(-128);
+    const auto bias      = _mm_loadu_si128((const __m128i*)biasValue);
+    const auto scale     = _mm_loadu_ps(scale_z);
+    const auto minValue  = _mm_set1_ps(-128.0f);
+    const auto maxValue  = _mm_set1_ps(127.0f);
+    for (int dx = 0; dx < width; ++dx) {
+        const auto src_x = src + dx * src_w_step;
+        auto d           = bias;
+        for (int g = 0; g < groups; ++g) {
+            const auto offsetG = offsets + 4 * g;
+            auto s = _mm_setr_epi32(*(const int32_t*)(src_x + offsetG[0]), *(const int32_t*)(src_x + offsetG[1]),
+                                    *(const int32_t*)(src_x + offsetG[2]), *(const int32_t*)(src_x + offsetG[3]));
+            s      = _mm_xor_si128(_mm_shuffle_epi8(s, transpose), offset);
+            d      = MNN_VNNI_DPBUSD_128(d, s, _mm_loadu_si128((const __m128i*)(weightGroup + 16 * g)));
+        }
+        auto r = _vnniRound128(_mm_mul_ps(_mm_cvtepi32_ps(d), scale), minValue, maxValue);
+        r      = _mm_packs_epi32(r, r);
+        r      = _mm_packs_epi16(r, r);
+        *(int32_t*)(dst + 4 * dx) = _mm_cvtsi128_si32(r);
+    }
+}
+
+// N rows of MNNGemmInt8toFloat32_8x4_Common, the 8 int8 of a row are broadcast to the 4 channels of the weight
+template <int N>
+static inline void _vnniGemmInt8toFloat32(float* dst, const int8_t* src, const int8_t* weight, size_t src_depth_quad,
+                                          size_t width, size_t dst_step, size_t dst_depth_quad) {
+    const auto offset = _mm256_set1_epi8(-128);
+    // The weight + 128 = uint8 adds 128 * (sum of the source) to the result, the initial value subtracts it
+    __m256i init[N];
+    for (int i = 0; i < N; ++i) {
+        init[i] = _mm256_setzero_si256();
+    }
+    for (int sz = 0; sz < src_depth_quad; ++sz) {
+        const auto src_z = src + sz * width * 8;
+        for (int i = 0; i < N; ++i) {
+            auto s  = _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i*)(src_z + 8 * i)));
+            init[i] = MNN_VNNI_DPBUSD(init[i], offset, s);
+        }
+    }
+    for (int i = 0; i < N; ++i) {
+        init[i] = _mm256_sub_epi32(_mm256_setzero_si256(), init[i]);
+    }
+    for (int dz = 0; dz < dst_depth_quad; ++dz) {
+        const auto weight_dz = weight + dz * src_depth_quad * 32;
+        auto dst_z           = dst + dz * dst_step;
+        // The sums of the 4 low and 4 high int8 of the channels: c0 c0 c1 c1 | c2 c2 c3 c3
+        __m256i d[N];
+        for (int i = 0; i < N; ++i) {
+            d[i] = init[i];
+        }
+        for (int sz = 0; sz < src_depth_quad; ++sz) {
+            const auto src_z = src + sz * width * 8;
+            auto w = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(weight_dz + 32 * sz)), offset);
+            for (int i = 0; i < N; ++i) {
+                auto s = _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i*)(src_z + 8 * i)));
+                d[i]   = MNN_VNNI_DPBUSD(d[i], w, s);
+            }
+        }
+        // c0 c1 of x, c0 c1 of x + 1 | c2 c3 of x, c2 c3 of x + 1 -> c0 c1 c2 c3 of x | c0 c1 c2 c3 of x + 1
+        for (int i = 0; i + 1 < N; i += 2) {
+            auto r = _mm256_permute4x64_epi64(_mm256_hadd_epi32(d[i], d[i + 1]), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_ps(dst_z + 4 * i, _mm256_cvtepi32_ps(r));
+        }
+        if (N % 2 == 1) {
+            auto r = _mm256_permute4x64_epi64(_mm256_hadd_epi32(d[N - 1], d[N - 1]), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_ps(dst_z + 4 * (N - 1), _mm_cvtepi32_ps(_mm256_castsi256_si128(r)));
+        }
+    }
+}
+
+// The int8 of the source and weight are exact, -128 too, unlike the uint8 source of MNNGemmInt8AddBiasScale_16x4_Unit
+void MNN_VNNI_FUNCTION(MNNGemmInt8toFloat32_8x4_Common)(float* dst, const int8_t* src, const int8_t* weight,
+                                                        size_t src_depth_quad, size_t width, size_t dst_step,
+                                                        size_t dst_depth_quad) {
+    int x = 0;
+    for (; x + 3 < width; x += 4) {
+        _vnniGemmInt8toFloat32<4>(dst + 4 * x, src + 8 * x, weight, src_depth_quad, width, dst_step, dst_depth_quad);
+    }
+    switch (width - x) {
+        case 3:
+            _vnniGemmInt8toFloat32<3>(dst + 4 * x, src + 8 * x, weight, src_depth_quad, width, dst_step,
+                                      dst_depth_quad);
+            break;
+        case 2:
+            _vnniGemmInt8toFloat32<2>(dst + 4 * x, src + 8 * x, weight, src_depth_quad, width, dst_step,
+                                      dst_depth_quad);
+            break;
+        case 1:
+            _vnniGemmInt8toFloat32<1>(dst + 4 * x, src + 8 * x, weight, src_depth_quad, width, dst_step,
+                                      dst_depth_quad);
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,36 @@
+//
+//  Int8FunctionsVNNIEmulate.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+// vpdpbusd of AVX2 to test the VNNI kernels on the machines without VNNI, only built by MNN_VNNI_EMULATE
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+static inline __m256i _emulateDpbusd(__m256i z, __m256i u, __m256i s) {
+    // The products of uint8 x int8 summed by pairs don't overflow int32, unlike the int16 of maddubs
+    auto lo = _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(u)),
+                                _mm256_cvtepi8_epi16(_mm256_castsi256_si128(s)));
+    auto hi = _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(u, 1)),
+                                _mm256_cvtepi8_epi16(_mm256_extracti128_si256(s, 1)));
+    // The sums of 4: 0, 1, 4, 5 | 2, 3, 6, 7
+    auto sum = _mm256_hadd_epi32(lo, hi);
+    return _mm256_add_epi32(z, _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+static inline __m128i _emulateDpbusd128(__m128i z, __m128i u, __m128i s) {
+    auto pair = _mm256_madd_epi16(_mm256_cvtepu8_epi16(u), _mm256_cvtepi8_epi16(s));
+    auto sum  = _mm_hadd_epi32(_mm256_castsi256_si128(pair), _mm256_extracti128_si256(pair, 1));
+    return _mm_add_epi32(z, sum);
+}
+
+#define MNN_VNNI_FUNCTION(name) _AVX_VNNIEmulate_##name
+#define MNN_VNNI_DPBUSD _emulateDpbusd
+#define MNN_VNNI_DPBUSD_128 _emulateDpbusd128
+#include "Int8FunctionsVNNI.hpp"
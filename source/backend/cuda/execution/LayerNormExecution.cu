@@ -341,6 +341,10 @@ class LayerNormCreator : public CUDABackend::Creator {
 public:
     virtual Execution* onCreate(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
                                 const MNN::Op* op, Backend* backend) const override {
+        if (inputs.size() > 1) {
+            // The fused residual add isn't supported, use cpu instead
+            return nullptr;
+        }
         auto param = op->main_as_LayerNorm();
         return new LayerNormExecution(param, backend);
     }
@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <MNN/ErrorCode.hpp>
 #include <MNN/Tensor.hpp>
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -154,6 +155,65 @@ public:
      */
     virtual bool onClearBuffer() = 0;
 
+    /** stage of offline planning for dynamic buffers */
+    enum MemoryPlanStage {
+        /** alloc dynamic buffers greedily and record their lifetime */
+        PLAN_RECORD = 0,
+        /** solve offsets by recorded lifetime, fail if the plan can't beat greedy alloc */
+        PLAN_SOLVE,
+        /** alloc dynamic buffers by the solved offsets */
+        PLAN_APPLY,
+        /** stop recording or applying, fail if the alloc sequence doesn't match the recorded one */
+        PLAN_END
+    };
+
+    /**
+     * @brief plan dynamic buffers ahead of time instead of greedy alloc / free.
+     * @param stage plan stage.
+     * @return success or not, false if the backend doesn't support memory plan.
+     */
+    virtual bool onPlanMemory(MemoryPlanStage stage) {
+        return false;
+    }
+
+    /**
+     * @brief query dynamic buffers size of greedy alloc and of the current alloc.
+     * @return std::make_pair(greedySizeInBytes, allocedSizeInBytes), greedy is the current one if not planned.
+     */
+    virtual std::pair<size_t, size_t> onGetMemoryPlan() const {
+        return std::make_pair(0, 0);
+    }
+
+    /** (chunk, size) of the dynamic buffers alloced, chunk is (pointer, offset) */
+    typedef std::vector<std::pair<std::pair<void*, int>, int>> BufferTrace;
+
+    /**
+     * @brief trace the dynamic buffers alloced, used to find out the memory touched by an execution.
+     * @param trace the alloced buffers are appended to it, nullptr to stop tracing.
+     * @return success or not, false if the backend doesn't support tracing.
+     */
+    virtual bool onTraceBuffer(BufferTrace* trace) {
+        return false;
+    }
+
+    /**
+     * @brief run task(0) ~ task(size - 1) concurrently, used to execute independent executions at the same time.
+     * @param task task to run.
+     * @param size number of the task.
+     * @return false if the backend can't run them concurrently, and none of them is run.
+     */
+    virtual bool onConcurrent(const std::function<void(int)>& task, int size) const {
+        return false;
+    }
+
+    /**
+     * @brief remove the Rasters whose consumers can read the source in place, called before memory alloc.
+     * @param buffer commands run by the backend.
+     */
+    virtual void onElideRasters(CommandBuffer& buffer) const {
+        // Do nothing
+    }
+
     /**
      * @brief copy buffer from tensor to tensor.
      * @param srcTensor source buffer provider.
@@ -211,6 +271,13 @@ public:
         return 0.0f;
     }
 
+    /**
+     @brief Measure the memory on huge pages in MB
+     */
+    virtual float onGetHugePageInMB() {
+        return 0.0f;
+    }
+
     // If buffer is not nullptr, try copy cache, else delete cache
     virtual bool onSetCache(const void* buffer, size_t size) {
         return false;
@@ -7,6 +7,8 @@
 //
 
 #include "core/BufferAllocator.hpp"
+#include <algorithm>
+#include <climits>
 #include "core/Macro.h"
 
 //#define DUMP_USAGE
@@ -67,6 +69,34 @@ std::pair<void*, int> BufferAllocator::alloc(int size, bool seperate) {
     auto memoryUsed = size / 1024.0f / 1024.0f;
     MNN_PRINT("Alloc: %f\n", memoryUsed);
 #endif
+    std::pair<void*, int> pointer;
+    if (seperate || PLAN_NONE == mPlan.state) {
+        pointer = allocGreedy(size, seperate);
+    } else if (PLAN_APPLY == mPlan.state) {
+        pointer = allocFromPlan(size);
+        if (nullptr == pointer.first) {
+            pointer = allocGreedy(size, seperate);
+        }
+    } else {
+        // Record the lifetime of the chunk
+        pointer = allocGreedy(size, seperate);
+        if (nullptr != pointer.first) {
+            Chunk chunk;
+            chunk.size   = UP_DIV(size, mAlign) * mAlign;
+            chunk.begin  = mPlan.time++;
+            chunk.end    = INT_MAX;
+            chunk.offset = 0;
+            mPlan.alive[pointer] = (int)mPlan.chunks.size();
+            mPlan.chunks.emplace_back(chunk);
+        }
+    }
+    if (nullptr != mTrace && nullptr != pointer.first) {
+        mTrace->emplace_back(std::make_pair(pointer, size));
+    }
+    return pointer;
+}
+
+std::pair<void*, int> BufferAllocator::allocGreedy(int size, bool seperate) {
     std::pair<void*, int> pointer;
     // reuse if possible
     if (!seperate) {
@@ -88,6 +118,9 @@ std::pair<void*, int> BufferAllocator::alloc(int size, bool seperate) {
         return pointer;
     }
     mTotalSize += size;
+    if (PLAN_RECORD == mPlan.state && (!seperate)) {
+        mPlan.greedySize += UP_DIV(size, mAlign) * mAlign;
+    }
 
     // save node
     std::shared_ptr<Node> node(new Node);
@@ -144,6 +177,22 @@ bool BufferAllocator::free(std::pair<void*, int> pointer) {
     // mark as reusable
     auto node = x->second;
     mUsedList.erase(x);
+    if (nullptr != mPlan.arena && node->parent == mPlan.arena) {
+        // The space of planned chunk is reserved by the plan
+        return true;
+    }
+    if (PLAN_RECORD == mPlan.state) {
+        auto iter = mPlan.alive.find(pointer);
+        if (iter != mPlan.alive.end()) {
+            if (mPlan.inBarrier) {
+                // Memory freed in group can't be used by other group until barrier end
+                mPlan.barrierFree.emplace_back(iter->second);
+            } else {
+                mPlan.chunks[iter->second].end = mPlan.time++;
+            }
+            mPlan.alive.erase(iter);
+        }
+    }
     if (nullptr != mCurrentFreeList) {
         returnMemory(mCurrentFreeList, node, false);
     } else {
@@ -161,6 +210,7 @@ void BufferAllocator::release(bool allRelease) {
     if (allRelease) {
         mUsedList.clear();
         mFreeList.clear();
+        mPlan.arena = nullptr;
         mTotalSize = 0;
         return;
     }
@@ -175,9 +225,18 @@ void BufferAllocator::release(bool allRelease) {
 
 void BufferAllocator::barrierBegin() {
     MNN_ASSERT(mGroups.empty());
+    mPlan.inBarrier = true;
 }
 
 void BufferAllocator::barrierEnd() {
+    if (PLAN_RECORD == mPlan.state) {
+        for (auto index : mPlan.barrierFree) {
+            mPlan.chunks[index].end = mPlan.time;
+        }
+        mPlan.time++;
+    }
+    mPlan.barrierFree.clear();
+    mPlan.inBarrier = false;
     for (auto& freeGroup : mGroups) {
         auto freeList = *freeGroup;
         for (auto& iter : freeList) {
@@ -241,4 +300,125 @@ std::pair<void*, int> BufferAllocator::getFromFreeList(FREELIST* list, int size,
     list->insert(std::make_pair(second->size, second));
     return pointer;
 }
+
+void BufferAllocator::beginRecord() {
+    mPlan.state       = PLAN_RECORD;
+    mPlan.chunks.clear();
+    mPlan.alive.clear();
+    mPlan.barrierFree.clear();
+    mPlan.time        = 0;
+    mPlan.cursor      = 0;
+    mPlan.match       = true;
+    mPlan.greedySize  = 0;
+    mPlan.plannedSize = 0;
+}
+
+bool BufferAllocator::plan() {
+    if (PLAN_RECORD != mPlan.state) {
+        return false;
+    }
+    mPlan.state = PLAN_NONE;
+    mPlan.alive.clear();
+    auto& chunks = mPlan.chunks;
+    if (chunks.empty()) {
+        return false;
+    }
+    // Best fit decreasing: place larger chunk first, choose the smallest gap among the chunks living at the same time
+    std::vector<int> order(chunks.size());
+    for (int i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&chunks](int a, int b) {
+        return chunks[a].size > chunks[b].size;
+    });
+    std::vector<int> placed;
+    std::vector<std::pair<size_t, size_t>> used;
+    size_t peak = 0;
+    for (auto index : order) {
+        auto& chunk = chunks[index];
+        used.clear();
+        for (auto p : placed) {
+            auto& other = chunks[p];
+            if (other.begin < chunk.end && chunk.begin < other.end) {
+                used.emplace_back(std::make_pair(other.offset, other.offset + other.size));
+            }
+        }
+        std::sort(used.begin(), used.end());
+        size_t bestOffset = 0;
+        size_t bestGap    = 0;
+        bool find         = false;
+        size_t current    = 0;
+        for (auto& u : used) {
+            if (u.first > current) {
+                auto gap = u.first - current;
+                if (gap >= chunk.size && ((!find) || gap < bestGap)) {
+                    bestOffset = current;
+                    bestGap    = gap;
+                    find       = true;
+                }
+            }
+            current = std::max(current, u.second);
+        }
+        if (!find) {
+            bestOffset = current;
+        }
+        chunk.offset = bestOffset;
+        peak         = std::max(peak, bestOffset + chunk.size);
+        placed.emplace_back(index);
+    }
+    mPlan.plannedSize = peak;
+#ifdef DUMP_USAGE
+    MNN_PRINT("Memory plan: greedy %f M, planned %f M\n", mPlan.greedySize / 1024.0f / 1024.0f,
+              mPlan.plannedSize / 1024.0f / 1024.0f);
+#endif
+    return mPlan.plannedSize < mPlan.greedySize;
+}
+
+void BufferAllocator::beginApply() {
+    mPlan.state  = PLAN_APPLY;
+    mPlan.cursor = 0;
+    mPlan.match  = true;
+}
+
+bool BufferAllocator::endPlan() {
+    bool res = true;
+    if (PLAN_APPLY == mPlan.state) {
+        res = mPlan.match && mPlan.cursor == mPlan.chunks.size();
+    }
+    mPlan.state = PLAN_NONE;
+    mPlan.alive.clear();
+    return res;
+}
+
+std::pair<void*, int> BufferAllocator::allocFromPlan(int size) {
+    auto index = mPlan.cursor++;
+    if ((!mPlan.match) || index >= mPlan.chunks.size() || mPlan.chunks[index].size != UP_DIV(size, mAlign) * mAlign) {
+        mPlan.match = false;
+        return std::make_pair(nullptr, 0);
+    }
+    if (nullptr == mPlan.arena) {
+        auto pointer = mAllocator->onAlloc(mPlan.plannedSize);
+        if (nullptr == pointer.first) {
+            mPlan.match = false;
+            return pointer;
+        }
+        mTotalSize += mPlan.plannedSize;
+        std::shared_ptr<Node> arena(new Node);
+        arena->size    = mPlan.plannedSize;
+        arena->pointer = pointer;
+        arena->outside = mAllocator.get();
+        mPlan.arena    = arena;
+    } else if (mPlan.arena->size < mPlan.plannedSize) {
+        mPlan.match = false;
+        return std::make_pair(nullptr, 0);
+    }
+    std::shared_ptr<Node> node(new Node);
+    node->parent          = mPlan.arena;
+    node->size            = size;
+    node->outside         = mAllocator.get();
+    node->pointer.first   = mPlan.arena->pointer.first;
+    node->pointer.second  = mPlan.arena->pointer.second + (int)mPlan.chunks[index].offset;
+    mUsedList[node->pointer] = node;
+    return node->pointer;
+}
 } // namespace MNN
@@ -91,6 +91,42 @@ public:
     void beginGroup();
     void endGroup();
 
+    /**
+     * @brief trace the chunks returned by alloc, used to find out the memory touched by an op.
+     * @param trace (chunk, size) is appended to it, nullptr to stop tracing.
+     */
+    void setTrace(std::vector<std::pair<std::pair<void*, int>, int>>* trace) {
+        mTrace = trace;
+    }
+
+    /*
+     Offline memory planning,
+     record mode: alloc greedily as usual and trace every reusable chunk's lifetime
+     plan: place the traced chunks by best-fit-decreasing, return false if it can't beat greedy
+     apply mode: the same alloc / free sequence is served from one arena with the planned offsets,
+     if the sequence doesn't match the trace, fallback to greedy alloc
+     */
+    void beginRecord();
+    bool plan();
+    void beginApply();
+    /**
+     * @brief stop recording / applying.
+     * @return false if applying but the alloc sequence doesn't match the trace.
+     */
+    bool endPlan();
+    /**
+     * @brief query memory needed by greedy alloc in last record.
+     */
+    size_t greedySize() const {
+        return mPlan.greedySize;
+    }
+    /**
+     * @brief query memory needed by the plan.
+     */
+    size_t plannedSize() const {
+        return mPlan.plannedSize;
+    }
+
 private:
     class Node {
     public:
@@ -106,6 +142,8 @@ private:
 
     static void returnMemory(FREELIST* list, std::shared_ptr<Node> node, bool permitMerge = true);
     std::pair<void*, int> getFromFreeList(FREELIST* list, int size, bool permiteSplit = true);
+    std::pair<void*, int> allocGreedy(int size, bool seperate);
+    std::pair<void*, int> allocFromPlan(int size);
 
     std::map<std::pair<void*, int>, std::shared_ptr<Node>> mUsedList;
     FREELIST mFreeList;
@@ -115,6 +153,29 @@ private:
     std::vector<std::shared_ptr<FREELIST>> mGroups;
     std::shared_ptr<Allocator> mAllocator;
     int mAlign;
+
+    enum PlanState { PLAN_NONE = 0, PLAN_RECORD, PLAN_APPLY };
+    struct Chunk {
+        size_t size;
+        int begin;
+        int end;
+        size_t offset;
+    };
+    struct Plan {
+        PlanState state = PLAN_NONE;
+        std::vector<Chunk> chunks;
+        std::map<std::pair<void*, int>, int> alive;
+        std::vector<int> barrierFree;
+        bool inBarrier    = false;
+        bool match        = true;
+        int time          = 0;
+        int cursor        = 0;
+        size_t greedySize = 0;
+        size_t plannedSize = 0;
+        std::shared_ptr<Node> arena;
+    };
+    Plan mPlan;
+    std::vector<std::pair<std::pair<void*, int>, int>>* mTrace = nullptr;
 };
 } // namespace MNN
 #endif
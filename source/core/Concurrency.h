@@ -22,11 +22,11 @@
         std::pair<std::function<void(int)>, int> task; \
         task.second = __num__;                         \
         task.first  = [&](int __iter__) {
-#define MNN_CONCURRENCY_END()                                      \
-    }                                                              \
-    ;                                                              \
-    auto cpuBn = (CPUBackend*)backend();                           \
-    MNN::ThreadPool::enqueue(std::move(task), cpuBn->taskIndex()); \
+#define MNN_CONCURRENCY_END()                                                         \
+    }                                                                                 \
+    ;                                                                                 \
+    auto cpuBn = (CPUBackend*)backend();                                              \
+    MNN::ThreadPool::enqueue(std::move(task), cpuBn->taskIndex(), cpuBn->numaNode()); \
     }
 
 #else
@@ -63,4 +63,68 @@ dispatch_apply(__num__, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH,
 
 #endif
 #endif
+
+#include <algorithm>
+#include <atomic>
+namespace MNN {
+/**
+ * Hands out chunks of [0, size) by guided scheduling: each chunk is the remaining size / (2 * threadNumber), but not
+ * less than grain, so threads finishing early take more work instead of idling on a static stride.
+ */
+class ConcurrencyCounter {
+public:
+    ConcurrencyCounter(int size, int threadNumber, int grain = 1) {
+        reset(size, threadNumber, grain);
+    }
+    void reset(int size, int threadNumber, int grain = 1) {
+        mSize         = size;
+        mThreadNumber = std::max(threadNumber, 1);
+        mGrain        = std::max(grain, 1);
+        mCurrent      = 0;
+    }
+    void reset() {
+        mCurrent = 0;
+    }
+    /** take next chunk [begin, end), return false if all chunks are taken */
+    bool next(int& begin, int& end) {
+        int current = mCurrent.load();
+        do {
+            if (current >= mSize) {
+                return false;
+            }
+            auto chunk = std::max(mGrain, (mSize - current) / (2 * mThreadNumber));
+            end        = std::min(current + chunk, mSize);
+        } while (!mCurrent.compare_exchange_weak(current, end));
+        begin = current;
+        return true;
+    }
+
+private:
+    std::atomic_int mCurrent = {0};
+    int mSize                = 0;
+    int mThreadNumber        = 1;
+    int mGrain               = 1;
+};
+} // namespace MNN
+
+/**
+ * Run body for __iter__ in [0, __num__) on __threadNumber__ threads, each thread takes chunks (not less than
+ * __grain__) by ConcurrencyCounter until none left. __tId__ is the thread index for per-thread buffers. Use continue
+ * to skip an index, don't use return or break in body.
+ */
+#define MNN_CONCURRENCY_DYNAMIC_BEGIN(__tId__, __iter__, __num__, __threadNumber__, __grain__)         \
+    {                                                                                                  \
+        MNN::ConcurrencyCounter __counter(__num__, __threadNumber__, __grain__);                       \
+        auto __counterPtr = &__counter;                                                                \
+        MNN_CONCURRENCY_BEGIN(__tId__, __threadNumber__) {                                             \
+            int __begin, __end;                                                                        \
+            while (__counterPtr->next(__begin, __end)) {                                               \
+                for (int __iter__ = __begin; __iter__ < __end; ++__iter__) {
+#define MNN_CONCURRENCY_DYNAMIC_END() \
+    }                                 \
+    }                                 \
+    }                                 \
+    MNN_CONCURRENCY_END();            \
+    }
+
 #endif /* concurrency_h */
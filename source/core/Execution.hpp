@@ -54,6 +54,17 @@ public:
      */
     virtual ErrorCode onExecute(const std::vector<Tensor *> &inputs, const std::vector<Tensor *> &outputs) = 0;
 
+    /**
+     * @brief clone execution, the new execution shares read-only resource (such as packed weight) with this one.
+     * @param bn        backend that the new execution will running on.
+     * @param op        op of this execution.
+     * @param dst       the new execution, if nullptr, just check whether the execution can be cloned.
+     * @return false if not support clone.
+     */
+    virtual bool onClone(Backend *bn, const Op *op, Execution **dst) {
+        return false;
+    }
+
 public:
     /**
      * @brief designed for plugin system. not ready yet.
@@ -8,7 +8,11 @@
 
 #include "core/FileLoader.hpp"
 #if defined(_MSC_VER)
+#include <io.h>
 #include "Windows.h"
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 namespace MNN {
 FileLoader::FileLoader(const char* file) {
@@ -32,6 +36,18 @@ FileLoader::FileLoader(const char* file) {
 }
 
 FileLoader::~FileLoader() {
+#if defined(_MSC_VER)
+    if (nullptr != mMapped) {
+        UnmapViewOfFile(mMapped);
+    }
+    if (nullptr != mMapHandle) {
+        CloseHandle(mMapHandle);
+    }
+#else
+    if (nullptr != mMapped) {
+        munmap(mMapped, mTotalSize);
+    }
+#endif
     if (nullptr != mFile) {
         fclose(mFile);
     }
@@ -87,4 +103,45 @@ bool FileLoader::merge(AutoStorage<uint8_t>& buffer) {
     return true;
 }
 
+uint8_t* FileLoader::map() {
+    if (nullptr != mMapped) {
+        return (uint8_t*)mMapped;
+    }
+    if (nullptr == mFile || !mBlocks.empty()) {
+        return nullptr;
+    }
+#if defined(_MSC_VER)
+    auto file = (HANDLE)_get_osfhandle(_fileno(mFile));
+    LARGE_INTEGER fileSize;
+    if (INVALID_HANDLE_VALUE == file || !GetFileSizeEx(file, &fileSize) || 0 == fileSize.QuadPart) {
+        return nullptr;
+    }
+    mMapHandle = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (nullptr == mMapHandle) {
+        return nullptr;
+    }
+    mMapped = MapViewOfFile(mMapHandle, FILE_MAP_COPY, 0, 0, 0);
+    if (nullptr == mMapped) {
+        CloseHandle(mMapHandle);
+        mMapHandle = nullptr;
+        return nullptr;
+    }
+    mTotalSize = (size_t)fileSize.QuadPart;
+#else
+    auto fd = fileno(mFile);
+    struct stat fileStat;
+    if (0 != fstat(fd, &fileStat) || !S_ISREG(fileStat.st_mode) || 0 == fileStat.st_size) {
+        return nullptr;
+    }
+    // Private mapping: writing (such as updateSessionToModel) only copy the touched pages
+    auto ptr = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED == ptr) {
+        return nullptr;
+    }
+    mMapped    = ptr;
+    mTotalSize = (size_t)fileStat.st_size;
+#endif
+    return (uint8_t*)mMapped;
+}
+
 } // namespace MNN
@@ -26,10 +26,21 @@ public:
 
     bool merge(AutoStorage<uint8_t>& buffer);
 
+    /**
+     * @brief map the whole file into memory with copy-on-write, the mapping is released when the loader deleted.
+     * pages not written are shared with other processes mapping the same file through page cache.
+     * @return mapped address, nullptr if mapping is not supported or failed.
+     */
+    uint8_t* map();
+
 private:
     std::vector<std::pair<size_t, void*>> mBlocks;
     FILE* mFile                 = nullptr;
     static const int gCacheSize = 4096;
     size_t mTotalSize           = 0;
+    void* mMapped               = nullptr;
+#if defined(_MSC_VER)
+    void* mMapHandle = nullptr;
+#endif
 };
 } // namespace MNN
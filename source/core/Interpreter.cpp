@@ -22,15 +22,40 @@ namespace MNN {
 
 struct Content {
     AutoStorage<uint8_t> buffer;
+    // The mapped model file, used instead of buffer if not null
+    std::shared_ptr<FileLoader> mappedFile;
+    uint8_t* modelBuffer() const {
+        return nullptr != mappedFile ? mappedFile->map() : buffer.get();
+    }
+    size_t modelSize() const {
+        return nullptr != mappedFile ? mappedFile->size() : buffer.size();
+    }
     const Net* net = nullptr;
     std::vector<std::unique_ptr<Session>> sessions;
     std::map<const Tensor*, const Session*> tensorMap;
     Interpreter::SessionMode callBackMode = Interpreter::Session_Debug;
     Interpreter::SessionMode inputMode    = Interpreter::Session_Input_Inside;
+    Interpreter::SessionMode memoryMode   = Interpreter::Session_Memory_Greedy;
+    Interpreter::SessionMode executeMode  = Interpreter::Session_Execute_Serial;
+    int resizeCacheNumber                 = 0;
     AutoStorage<uint8_t> cacheBuffer;
+    // The mapped cache file, used instead of cacheBuffer if not null
+    std::shared_ptr<FileLoader> mappedCache;
+    uint8_t* cacheData() const {
+        return nullptr != mappedCache ? mappedCache->map() : cacheBuffer.get();
+    }
+    size_t cacheSize() const {
+        return nullptr != mappedCache ? mappedCache->size() : cacheBuffer.size();
+    }
     size_t cacheOffset = 0;
     std::string cacheFile;
     std::mutex lock;
+    // Schedule configs of sessions, used to create replicas
+    struct SessionConfig {
+        std::vector<ScheduleConfig> configs;
+        std::vector<std::shared_ptr<BackendConfig>> backendConfigs;
+    };
+    std::map<const Session*, SessionConfig> sessionConfigs;
 };
 
 Interpreter* Interpreter::createFromFile(const char* file) {
@@ -38,11 +63,17 @@ Interpreter* Interpreter::createFromFile(const char* file) {
         MNN_PRINT("NULL file for create interpreter\n");
         return nullptr;
     }
-    std::unique_ptr<FileLoader> loader(new FileLoader(file));
+    std::shared_ptr<FileLoader> loader(new FileLoader(file));
     if (!loader->valid()) {
         MNN_PRINT("Create interpreter failed, open %s error\n", file);
         return nullptr;
     }
+    if (nullptr != loader->map()) {
+        // Use the file mapping directly, the weights are read from page cache without copy
+        auto net        = new Content;
+        net->mappedFile = loader;
+        return createFromBufferInternal(net);
+    }
     bool result = loader->read();
     if (!result) {
         MNN_PRINT("Read file error\n");
@@ -81,13 +112,13 @@ Interpreter* Interpreter::createFromBufferInternal(Content* net) {
         MNN_PRINT("Buffer is null for create interpreter\n");
         return nullptr;
     }
-    flatbuffers::Verifier verify((const uint8_t*)(net->buffer.get()), net->buffer.size());
+    flatbuffers::Verifier verify((const uint8_t*)(net->modelBuffer()), net->modelSize());
     if (false == VerifyNetBuffer(verify)) {
         MNN_PRINT("Invalidate buffer to create interpreter\n");
         delete net;
         return nullptr;
     }
-    net->net = GetNet(net->buffer.get());
+    net->net = GetNet(net->modelBuffer());
     if (nullptr == net->net->oplists()) {
         MNN_ERROR("Model has no oplist\n");
         delete net;
@@ -108,44 +139,75 @@ Interpreter* Interpreter::createFromBufferInternal(Content* net) {
 void Interpreter::setSessionMode(SessionMode mode) {
     if (mode == Session_Input_Inside || mode == Session_Input_User) {
         mNet->inputMode = mode;
+    } else if (mode == Session_Memory_Greedy || mode == Session_Memory_Plan) {
+        mNet->memoryMode = mode;
+    } else if (mode == Session_Execute_Serial || mode == Session_Execute_Parallel) {
+        mNet->executeMode = mode;
     } else {
         mNet->callBackMode = mode;
     }
 }
 
+void Interpreter::setSessionHint(HintMode mode, int value) {
+    switch (mode) {
+        case RESIZE_CACHE_NUMBER:
+            mNet->resizeCacheNumber = value;
+            break;
+        default:
+            break;
+    }
+}
+
 void Interpreter::setCacheFile(const char* cacheFile, size_t keySize) {
-    if (nullptr == cacheFile || nullptr == mNet->buffer.get()) {
+    if (nullptr == cacheFile || nullptr == mNet->modelBuffer()) {
         MNN_ERROR("Empty cacheFile or the interpreter invalid\n");
         return;
     }
     mNet->cacheFile   = std::string(cacheFile);
-    mNet->cacheOffset = mNet->buffer.size() > keySize ? keySize : mNet->buffer.size();
-    std::unique_ptr<FileLoader> loader(new FileLoader(cacheFile));
+    mNet->cacheOffset = mNet->modelSize() > keySize ? keySize : mNet->modelSize();
+    std::shared_ptr<FileLoader> loader(new FileLoader(cacheFile));
     if (!loader->valid()) {
         MNN_ERROR("Load Cache file error.\n");
         return;
     }
-    bool result = loader->read();
-    if (!result) {
-        MNN_ERROR("Load Cache file error.\n");
-        return;
-    }
-    if (loader->size() == 0) {
-        MNN_ERROR("Load Cache file error.\n");
-        return;
-    }
-    bool success = loader->merge(mNet->cacheBuffer);
-    if (!success) {
-        MNN_ERROR("Alloc memory for Cache error.\n");
-        return;
+    if (nullptr != loader->map()) {
+        // Read the cache from page cache directly
+        mNet->mappedCache = loader;
+    } else {
+        bool result = loader->read();
+        if (!result) {
+            MNN_ERROR("Load Cache file error.\n");
+            return;
+        }
+        if (loader->size() == 0) {
+            MNN_ERROR("Load Cache file error.\n");
+            return;
+        }
+        bool success = loader->merge(mNet->cacheBuffer);
+        if (!success) {
+            MNN_ERROR("Alloc memory for Cache error.\n");
+            return;
+        }
     }
-    if (0 != ::memcmp(mNet->cacheBuffer.get(), mNet->buffer.get(), mNet->cacheOffset)) {
+    if (mNet->cacheSize() < mNet->cacheOffset ||
+        0 != ::memcmp(mNet->cacheData(), mNet->modelBuffer(), mNet->cacheOffset)) {
         MNN_ERROR("Cache model file key does not match.\n");
         mNet->cacheBuffer.release();
+        mNet->mappedCache = nullptr;
         return;
     }
 }
 
+// The sessions created by createSession may share runtime, so they run one by one under the net's lock. A replica
+// owns its runtime, its run only excludes the other calls on itself
+static std::unique_lock<std::mutex> _lockReplica(const Session* session) {
+    auto lock = session->replicaLock();
+    if (nullptr == lock) {
+        return std::unique_lock<std::mutex>();
+    }
+    return std::unique_lock<std::mutex>(*lock);
+}
+
 Interpreter::Interpreter(Content* net) {
     MNN_ASSERT(nullptr != net);
     mNet = net;
@@ -153,8 +215,9 @@ Interpreter::Interpreter(Content* net) {
 
 Interpreter::~Interpreter() {
     {
-        // If the session is running, we must not delete session
+        // The sessions must not be running when interpreter is deleted
         std::unique_lock<std::mutex> _l(mNet->lock);
+        mNet->sessionConfigs.clear();
         mNet->sessions.clear();
         mNet->tensorMap.clear();
     }
@@ -171,7 +234,7 @@ Session* Interpreter::createMultiPathSession(const std::vector<ScheduleConfig>&
 }
 
 Session* Interpreter::createMultiPathSession(const std::vector<ScheduleConfig>& configs, const RuntimeInfo& runtime) {
-    if (nullptr == mNet->buffer.get()) {
+    if (nullptr == mNet->modelBuffer()) {
         MNN_ERROR("The model buffer has been released. Can't create session\n");
         return nullptr;
     }
@@ -182,18 +245,20 @@ Session* Interpreter::createMultiPathSession(const std::vector<ScheduleConfig>&
     std::unique_lock<std::mutex> _l(mNet->lock);
     auto info           = Schedule::schedule(mNet->net, configs);
     auto validForResize = info.validForResize;
+    info.modelHolder    = mNet->mappedFile;
     RuntimeInfo rt = runtime;
     auto newSession =
-        std::unique_ptr<Session>(new Session(std::move(info), mNet->callBackMode, mNet->inputMode, std::move(rt)));
+        std::unique_ptr<Session>(new Session(std::move(info), mNet->callBackMode, mNet->inputMode, mNet->memoryMode,
+                                             mNet->executeMode, std::move(rt)));
     if (!newSession->valid()) {
         MNN_PRINT("Invalide Session!!\n");
         return nullptr;
     }
     auto result = newSession.get();
+    result->setResizeCacheNumber(mNet->resizeCacheNumber);
     bool valid  = false;
-    if (mNet->cacheBuffer.get() != nullptr) {
-        valid = result->loadCache(mNet->cacheBuffer.get() + mNet->cacheOffset,
-                                  mNet->cacheBuffer.size() - mNet->cacheOffset);
+    if (mNet->cacheData() != nullptr) {
+        valid = result->loadCache(mNet->cacheData() + mNet->cacheOffset, mNet->cacheSize() - mNet->cacheOffset);
     }
     if (validForResize && mNet->inputMode == Session_Input_Inside) {
         result->resize(mNet->net->usage() == Usage_INFERENCE_STATIC);
@@ -203,6 +268,8 @@ Session* Interpreter::createMultiPathSession(const std::vector<ScheduleConfig>&
         auto res = result->getCache();
         if (res.first != nullptr && res.second > 0) {
             do {
+                // The file will be rewritten, don't use its mapping any more
+                mNet->mappedCache = nullptr;
                 MNN_PRINT("Write cache to %s, size = %lu\n", mNet->cacheFile.c_str(), res.second);
                 FILE* f = fopen(mNet->cacheFile.c_str(), "wb");
                 if (nullptr == f) {
@@ -210,7 +277,7 @@ Session* Interpreter::createMultiPathSession(const std::vector<ScheduleConfig>&
                     break;
                 }
                 // Write key
-                auto tsize = fwrite((const char*)mNet->buffer.get(), 1, mNet->cacheOffset, f);
+                auto tsize = fwrite((const char*)mNet->modelBuffer(), 1, mNet->cacheOffset, f);
                 if (tsize != mNet->cacheOffset) {
                     MNN_ERROR("Write %s error\n", mNet->cacheFile.c_str());
                     break;
@@ -237,6 +304,57 @@ Session* Interpreter::createMultiPathSession(const std::vector<ScheduleConfig>&
     // Reset cache
     result->loadCache(nullptr, 0);
 
+    // Record configs for cloneSession, backend config is provided by user, so copy it
+    Content::SessionConfig sessionConfig;
+    sessionConfig.configs = configs;
+    for (auto& config : sessionConfig.configs) {
+        if (nullptr != config.backendConfig) {
+            std::shared_ptr<BackendConfig> backendConfig(new BackendConfig(*config.backendConfig));
+            config.backendConfig = backendConfig.get();
+            sessionConfig.backendConfigs.emplace_back(backendConfig);
+        }
+    }
+    mNet->sessionConfigs.insert(std::make_pair(result, std::move(sessionConfig)));
+    mNet->sessions.emplace_back(std::move(newSession));
+    return result;
+}
+
+Session* Interpreter::cloneSession(const Session* session) {
+    if (nullptr == mNet->modelBuffer()) {
+        MNN_ERROR("The model buffer has been released. Can't clone session\n");
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> _l(mNet->lock);
+    auto configIter = mNet->sessionConfigs.find(session);
+    if (configIter == mNet->sessionConfigs.end()) {
+        MNN_ERROR("The session isn't created by this interpreter, can't clone\n");
+        return nullptr;
+    }
+    auto& configs = configIter->second.configs;
+    // Use new runtime, so that the replica can run concurrently with origin
+    RuntimeInfo runtime = createRuntime(configs);
+    if (runtime.first.empty()) {
+        MNN_ERROR("Runtime not valid for clone session\n");
+        return nullptr;
+    }
+    auto info           = Schedule::schedule(mNet->net, configs);
+    auto validForResize = info.validForResize;
+    auto newSession     = std::unique_ptr<Session>(new Session(std::move(info), session, std::move(runtime)));
+    if (!newSession->valid()) {
+        MNN_PRINT("Invalide Session!!\n");
+        return nullptr;
+    }
+    auto result = newSession.get();
+    result->setResizeCacheNumber(mNet->resizeCacheNumber);
+    if (mNet->cacheData() != nullptr) {
+        result->loadCache(mNet->cacheData() + mNet->cacheOffset, mNet->cacheSize() - mNet->cacheOffset);
+    }
+    if (validForResize && mNet->inputMode == Session_Input_Inside) {
+        result->resize(mNet->net->usage() == Usage_INFERENCE_STATIC);
+    }
+    result->loadCache(nullptr, 0);
+
+    mNet->sessionConfigs.insert(std::make_pair(result, configIter->second));
     mNet->sessions.emplace_back(std::move(newSession));
     return result;
 }
@@ -262,6 +380,9 @@ bool Interpreter::releaseSession(Session* session) {
         }
 
         if ((*iter).get() == session) {
+            // Wait for the running replica
+            _lockReplica(session);
+            mNet->sessionConfigs.erase(session);
             mNet->sessions.erase(iter);
             return true;
         }
@@ -270,6 +391,10 @@ bool Interpreter::releaseSession(Session* session) {
 }
 
 ErrorCode Interpreter::runSession(Session* session) const {
+    if (nullptr != session->replicaLock()) {
+        auto _r = _lockReplica(session);
+        return session->run();
+    }
     std::unique_lock<std::mutex> _l(mNet->lock);
     return session->run();
 }
@@ -314,7 +439,8 @@ const std::map<std::string, Tensor*>& Interpreter::getSessionOutputAll(const Ses
 
 void Interpreter::resizeSession(Session* session) {
     std::unique_lock<std::mutex> _l(mNet->lock);
-    if (mNet->buffer.get() == nullptr) {
+    auto _r = _lockReplica(session);
+    if (mNet->modelBuffer() == nullptr) {
         MNN_ERROR("The model buffer has been released. Can't resize session\n");
         return;
     }
@@ -336,6 +462,10 @@ ErrorCode Interpreter::runSessionWithCallBack(const Session* session, const Tens
 
 ErrorCode Interpreter::runSessionWithCallBackInfo(const Session* session, const TensorCallBackWithInfo& before,
                                                   const TensorCallBackWithInfo& callBack, bool sync) const {
+    if (nullptr != session->replicaLock()) {
+        auto _r = _lockReplica(session);
+        return session->runWithCallBack(before, callBack, sync);
+    }
     std::unique_lock<std::mutex> _l(mNet->lock);
     return session->runWithCallBack(before, callBack, sync);
 }
@@ -347,7 +477,9 @@ const Backend* Interpreter::getBackend(const Session* session, const Tensor* ten
 void Interpreter::releaseModel() {
     std::unique_lock<std::mutex> _l(mNet->lock);
     mNet->buffer.release();
+    mNet->mappedFile = nullptr;
     mNet->cacheBuffer.release();
+    mNet->mappedCache = nullptr;
     for (auto& iter : mNet->sessions) {
         iter->releaseCache();
     }
@@ -396,11 +528,12 @@ const char* Interpreter::bizCode() const {
 }
 
 std::pair<const void*, size_t> Interpreter::getModelBuffer() const {
-    return std::make_pair(mNet->buffer.get(), mNet->buffer.size());
+    return std::make_pair(mNet->modelBuffer(), mNet->modelSize());
 }
 ErrorCode Interpreter::updateSessionToModel(Session* session) {
     std::unique_lock<std::mutex> _l(mNet->lock);
-    if (mNet->buffer.get() == nullptr) {
+    auto _r = _lockReplica(session);
+    if (mNet->modelBuffer() == nullptr) {
         MNN_ERROR("Can't updateSessionToModel because you called releaseModel before\n");
         return INPUT_DATA_ERROR;
     }
@@ -412,6 +545,7 @@ bool Interpreter::getSessionInfo(const Session* session, SessionInfoCode code, v
     if (nullptr == session || nullptr == ptr) {
         return true;
     }
+    auto _r = _lockReplica(session);
     return session->getInfo(code, ptr);
 }
 
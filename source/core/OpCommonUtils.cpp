@@ -310,4 +310,76 @@ int OpCommonUtils::computeStride(int32_t* strides, const int* shape, int length)
     return stride;
 }
 
+const Tensor::InsideDescribe::Region* OpCommonUtils::getStridedView(const Tensor* tensor) {
+    auto des = TensorUtils::getDescribe(tensor);
+    if (des->memoryType != Tensor::InsideDescribe::MEMORY_VIRTUAL || des->regions.size() != 1 ||
+        des->dimensionFormat == MNN_DATA_FORMAT_NC4HW4) {
+        return nullptr;
+    }
+    auto& region = des->regions[0];
+    auto origin  = region.origin;
+    if (nullptr == origin || origin->getType() != tensor->getType()) {
+        return nullptr;
+    }
+    auto originDes = TensorUtils::getDescribe(origin);
+    if (originDes->memoryType == Tensor::InsideDescribe::MEMORY_VIRTUAL ||
+        originDes->dimensionFormat == MNN_DATA_FORMAT_NC4HW4) {
+        return nullptr;
+    }
+    if (0 != region.dst.offset) {
+        return nullptr;
+    }
+    int dense = 1;
+    for (int i = 2; i >= 0; --i) {
+        if (region.size[i] > 1 && region.dst.stride[i] != dense) {
+            return nullptr;
+        }
+        dense *= region.size[i];
+    }
+    if (dense != tensor->elementSize()) {
+        return nullptr;
+    }
+    return &region;
+}
+
+bool OpCommonUtils::getMatrixView(const Tensor::InsideDescribe::Region& region, int cols, int& rowStride,
+                                  int& colStride) {
+    // (size, stride) from the inner most, the adjacent dims contiguous in origin are merged
+    std::vector<std::pair<int, int>> dims;
+    for (int i = 2; i >= 0; --i) {
+        if (region.size[i] <= 1) {
+            continue;
+        }
+        if (!dims.empty() && dims.back().first * dims.back().second == region.src.stride[i]) {
+            dims.back().first *= region.size[i];
+            continue;
+        }
+        dims.emplace_back(std::make_pair(region.size[i], region.src.stride[i]));
+    }
+    colStride = 1;
+    rowStride = cols;
+    if (dims.empty()) {
+        return true;
+    }
+    auto& inner = dims[0];
+    if (inner.first % cols != 0) {
+        return false;
+    }
+    colStride = inner.second;
+    rowStride = cols * inner.second;
+    if (inner.first == cols && dims.size() == 2) {
+        rowStride = dims[1].second;
+        return true;
+    }
+    return dims.size() == 1;
+}
+
+uint8_t* OpCommonUtils::viewHost(const Tensor* tensor) {
+    auto des = TensorUtils::getDescribe(tensor);
+    if (des->memoryType == Tensor::InsideDescribe::MEMORY_VIRTUAL) {
+        auto& region = des->regions[0];
+        return region.origin->host<uint8_t>() + region.src.offset * region.origin->getType().bytes();
+    }
+    return tensor->host<uint8_t>();
+}
 } // namespace MNN
@@ -32,6 +32,18 @@ public:
                             const SPLITS& dstSplits, int pack = 4);
     static void turnToPackRegion(const Tensor::InsideDescribe::Region& region, Tensor::InsideDescribe::Region& c4Region,
                                  const SPLITS& srcSplits, const SPLITS& dstSplits, int pack = 4);
+
+    /**
+     * The single region of a virtual tensor which fills it densely from a linear origin, so that it can be read as a
+     * strided view of the origin without the copy of Raster: the element of the dense index
+     * (i0 * size[1] + i1) * size[2] + i2 is origin[src.offset + i0 * src.stride[0] + i1 * src.stride[1] + i2 *
+     * src.stride[2]]. Return nullptr if the tensor is not such a view.
+     */
+    static const Tensor::InsideDescribe::Region* getStridedView(const Tensor* tensor);
+    // Strides of the element (y, x) of the view as a matrix of cols columns, false if the strides are not uniform
+    static bool getMatrixView(const Tensor::InsideDescribe::Region& region, int cols, int& rowStride, int& colStride);
+    // Host of the first element of the tensor, or of the strided view
+    static uint8_t* viewHost(const Tensor* tensor);
 };
 } // namespace MNN
 
@@ -8,7 +8,9 @@
 
 #include "core/Pipeline.hpp"
 #include <string.h>
+#include <set>
 #include "core/Backend.hpp"
+#include "core/DirectedAcyclicGraph.hpp"
 #include "core/Macro.h"
 #include "core/TensorUtils.hpp"
 #include "core/WrapExecution.hpp"
@@ -68,6 +70,50 @@ static bool _needRelease(const Tensor* tensor, bool inputOutside) {
     return true;
 }
 
+class TraceGuard {
+public:
+    TraceGuard(Backend* backend, Backend::BufferTrace* trace) : mBackend(backend) {
+        if (nullptr != mBackend && !mBackend->onTraceBuffer(trace)) {
+            mBackend = nullptr;
+        }
+    }
+    ~TraceGuard() {
+        if (nullptr != mBackend) {
+            mBackend->onTraceBuffer(nullptr);
+        }
+    }
+    bool valid() const {
+        return nullptr != mBackend;
+    }
+
+private:
+    Backend* mBackend;
+};
+
+// Owns the memory of constant tensors, the replicas may still use it after the origin pipeline is released
+struct Pipeline::ConstMemory {
+    ConstMemory(std::shared_ptr<Backend> backend, const std::vector<Tensor*>& tensors) : backend(backend) {
+        for (auto t : tensors) {
+            if (TensorUtils::getDescribe(t)->memoryType == Tensor::InsideDescribe::MEMORY_OUTSIDE) {
+                // Use the model buffer directly
+                continue;
+            }
+            std::shared_ptr<Tensor> holder(new Tensor(t, t->getDimensionType(), false));
+            holder->buffer().host                              = t->buffer().host;
+            TensorUtils::getDescribe(holder.get())->extra.offset = TensorUtils::getDescribe(t)->extra.offset;
+            holders.emplace_back(holder);
+        }
+    }
+    ~ConstMemory() {
+        for (auto& t : holders) {
+            backend->onReleaseBuffer(t.get(), Backend::STATIC);
+            t->buffer().host = nullptr;
+        }
+    }
+    std::shared_ptr<Backend> backend;
+    std::vector<std::shared_ptr<Tensor>> holders;
+};
+
 void Pipeline::UnitInfo::setUp(const Command& command, int index) {
     if (nullptr != command.op->name()) {
         mContent->name = command.op->name()->str();
@@ -83,9 +129,10 @@ void Pipeline::UnitInfo::setUp(const Command& command, int index) {
 }
 
 Pipeline::Pipeline(std::vector<Schedule::PipelineInfo>&& infos, std::shared_ptr<Backend> backend,
-                   std::shared_ptr<Backend> cpuBackend, bool allocInput, bool geometry)
+                   std::shared_ptr<Backend> cpuBackend, bool allocInput, bool geometry, bool planMemory,
+                   bool parallel, std::shared_ptr<void> modelHolder)
 #ifndef MNN_BUILD_MINI
-    : mContext(cpuBackend, true), mUseGeometry(geometry) {
+    : mContext(cpuBackend, true, backend->type()), mUseGeometry(geometry) {
 #else
 {
 #endif
@@ -94,8 +141,53 @@ Pipeline::Pipeline(std::vector<Schedule::PipelineInfo>&& infos, std::shared_ptr<
     mBackupBackend = cpuBackend;
     mBackend       = backend;
     mAllocInput    = allocInput;
+    mPlanMemory    = planMemory;
+    mParallel      = parallel;
+    mMemoryPlan    = std::make_pair(0, 0);
     mInfo          = std::move(infos);
-    GeometryComputerUtils::buildConstantTensors(mInfo, mBackupBackend, !mAllocInput, mConstTensors, mMidConstTensors);
+    mModelHolder   = modelHolder;
+    GeometryComputerUtils::buildConstantTensors(mInfo, mBackupBackend, !mAllocInput || nullptr != mModelHolder,
+                                                mConstTensors, mMidConstTensors);
+    mConstMemory.reset(new ConstMemory(mBackupBackend, mConstTensors));
+    if (mConstMemory->holders.size() == mConstTensors.size()) {
+        // No constant tensor uses the model buffer, don't keep it after the model released
+        mModelHolder = nullptr;
+    }
+}
+
+Pipeline::Pipeline(std::vector<Schedule::PipelineInfo>&& infos, std::shared_ptr<Backend> backend,
+                   std::shared_ptr<Backend> cpuBackend, const Pipeline* origin)
+#ifndef MNN_BUILD_MINI
+    : mContext(cpuBackend, true, backend->type()), mUseGeometry(origin->mUseGeometry) {
+#else
+{
+#endif
+    MNN_ASSERT(nullptr != backend);
+    MNN_ASSERT(nullptr != cpuBackend);
+    MNN_ASSERT(infos.size() == origin->mInfo.size());
+    mBackupBackend = cpuBackend;
+    mBackend       = backend;
+    mAllocInput    = origin->mAllocInput;
+    mPlanMemory    = origin->mPlanMemory;
+    mParallel      = origin->mParallel;
+    mMemoryPlan    = std::make_pair(0, 0);
+    mInfo          = std::move(infos);
+    mModelHolder   = origin->mModelHolder;
+    GeometryComputerUtils::buildConstantTensors(mInfo, mBackupBackend, !mAllocInput || nullptr != mModelHolder,
+                                                mConstTensors, mMidConstTensors, &origin->mInfo);
+    mConstMemory    = origin->mConstMemory;
+    mOriginBackends = origin->mOriginBackends;
+    mOriginBackends.emplace_back(origin->mBackend);
+    mOriginBackends.emplace_back(origin->mBackupBackend);
+    // Clone the cached executions, the clones share the weight with origin's and have their own resize state
+    for (auto& iter : origin->mOriginExecution) {
+        auto originExe = iter.second.get();
+        auto bn        = originExe->backend() == origin->mBackend.get() ? mBackend.get() : mBackupBackend.get();
+        Execution* exe = nullptr;
+        if (originExe->onClone(bn, iter.first, &exe) && nullptr != exe) {
+            mOriginExecution.insert(std::make_pair(iter.first, std::shared_ptr<Execution>(exe)));
+        }
+    }
 }
 
 ErrorCode Pipeline::encode(bool isStatic) {
@@ -142,8 +234,48 @@ ErrorCode Pipeline::encode(bool isStatic) {
 }
 
 ErrorCode Pipeline::allocMemory(bool supportDebug) {
-    mExecutions.clear();
     mDebugInfos.clear();
+    if (!supportDebug) {
+        // The callbacks of debug read every input of the commands as a dense tensor
+        mBackend->onElideRasters(mBuffer);
+    }
+    ErrorCode code = NO_ERROR;
+    if (mPlanMemory && mBackend->onPlanMemory(Backend::PLAN_RECORD)) {
+        code        = _allocMemory();
+        auto solved = mBackend->onPlanMemory(Backend::PLAN_SOLVE);
+        if (NO_ERROR == code && solved) {
+            // Alloc again by the plan, the tensors alloced by greedy should be reset
+            for (auto t : mDynamicTensors) {
+                TensorUtils::getDescribe(t)->backend = nullptr;
+            }
+            mBackend->onPlanMemory(Backend::PLAN_APPLY);
+            code = _allocMemory();
+            if (!mBackend->onPlanMemory(Backend::PLAN_END)) {
+                MNN_PRINT("Memory plan mismatch, use greedy alloc for the rest\n");
+            }
+        }
+    } else {
+        code = _allocMemory();
+    }
+    mMemoryPlan = mBackend->onGetMemoryPlan();
+    mDynamicTensors.clear();
+    if (NO_ERROR != code) {
+        return code;
+    }
+
+    /** Prepare DebugInfo*/
+    if (supportDebug) {
+        mDebugInfos.resize(mBuffer.command.size());
+        for (int i = 0; i < mBuffer.command.size(); ++i) {
+            mDebugInfos[i].setUp(mBuffer.command[i], i);
+        }
+    }
+    return NO_ERROR;
+}
+
+ErrorCode Pipeline::_allocMemory() {
+    mExecutions.clear();
+    mDynamicTensors.clear();
     mBackend->onClearBuffer();
     mBackupBackend->onClearBuffer();
 
@@ -164,11 +296,20 @@ ErrorCode Pipeline::allocMemory(bool supportDebug) {
             }
         }
     }
+    // For parallel execute, trace the memory every command touches, including the buffer alloced in onResize
+    mLevels.clear();
+    Backend::BufferTrace trace;
+    std::vector<std::vector<MemoryRange>> ranges;
+    TraceGuard guard(mParallel ? mBackend.get() : nullptr, &trace);
+    if (guard.valid()) {
+        ranges.resize(mBuffer.command.size());
+    }
     // Create Execution and Alloc
     mBackend->onResizeBegin();
     mExecutions.resize(mBuffer.command.size());
     for (int i = 0; i < mBuffer.command.size(); ++i) {
         auto& iter = mBuffer.command[i];
+        trace.clear();
         // MNN_PRINT("%d - %s\n", i, EnumNameOpType(iter.op->type()));
         mExecutions[i] = nullptr;
         bool cached    = false;
@@ -204,6 +345,7 @@ ErrorCode Pipeline::allocMemory(bool supportDebug) {
                         if (nullptr == bn) {
                             TensorUtils::getDescribe(origin)->backend = curBackend;
                             TensorUtils::setLinearLayout(origin);
+                            mDynamicTensors.emplace_back(origin);
                             auto res = curBackend->onAcquireBuffer(origin, memoryType);
                             if (!res) {
                                 return OUT_OF_MEMORY;
@@ -216,6 +358,7 @@ ErrorCode Pipeline::allocMemory(bool supportDebug) {
                     if (nullptr == bn) {
                         TensorUtils::setLinearLayout(t);
                         des->backend = curBackend;
+                        mDynamicTensors.emplace_back(t);
                         auto res     = curBackend->onAcquireBuffer(t, memoryType);
                         if (!res) {
                             return OUT_OF_MEMORY;
@@ -276,6 +419,32 @@ ErrorCode Pipeline::allocMemory(bool supportDebug) {
         if (NO_ERROR != code) {
             return code;
         }
+        if (guard.valid()) {
+            auto& range = ranges[i];
+            for (auto& chunk : trace) {
+                auto ptr = (const uint8_t*)chunk.first.first + chunk.first.second;
+                range.emplace_back(MemoryRange{ptr, ptr + chunk.second, true});
+            }
+            auto addRange = [&range](const Tensor* t, bool write) {
+                auto ptr = t->host<uint8_t>();
+                if (nullptr != ptr) {
+                    range.emplace_back(MemoryRange{ptr, ptr + t->size(), write});
+                }
+            };
+            for (auto t : iter.inputs) {
+                auto des = TensorUtils::getDescribe(t);
+                if (des->memoryType == Tensor::InsideDescribe::MEMORY_VIRTUAL) {
+                    for (auto& r : des->regions) {
+                        addRange(r.origin, false);
+                    }
+                } else {
+                    addRange(t, false);
+                }
+            }
+            for (auto t : iter.outputs) {
+                addRange(t, true);
+            }
+        }
         // Free mid tensor
         for (auto t : iter.inputs) {
             auto des = TensorUtils::getDescribe(t);
@@ -309,12 +478,120 @@ ErrorCode Pipeline::allocMemory(bool supportDebug) {
         }
     }
     mBackend->onResizeEnd();
+    if (guard.valid()) {
+        _computeLevels(ranges);
+    }
+    return NO_ERROR;
+}
 
-    /** Prepare DebugInfo*/
-    if (supportDebug) {
-        mDebugInfos.resize(mBuffer.command.size());
-        for (int i = 0; i < mBuffer.command.size(); ++i) {
-            mDebugInfos[i].setUp(mBuffer.command[i], i);
+void Pipeline::_computeLevels(const std::vector<std::vector<MemoryRange>>& ranges) {
+    // Build the dependency graph, edge src -> dst means dst must run after src
+    auto size = (int)mBuffer.command.size();
+    DirectedAcyclicGraph<int> graph;
+    NodeDef<int> def;
+    std::vector<std::shared_ptr<Node<int>>> nodes(size);
+    for (int i = 0; i < size; ++i) {
+        nodes[i] = graph.AddNode(def);
+        nodes[i]->setData(i);
+    }
+    std::map<const Tensor*, int> producers;
+    for (int i = 0; i < size; ++i) {
+        auto& cmd = mBuffer.command[i];
+        std::set<int> srcs;
+        for (auto t : cmd.inputs) {
+            auto des = TensorUtils::getDescribe(t);
+            if (des->memoryType == Tensor::InsideDescribe::MEMORY_VIRTUAL) {
+                for (auto& r : des->regions) {
+                    auto iter = producers.find(r.origin);
+                    if (iter != producers.end()) {
+                        srcs.insert(iter->second);
+                    }
+                }
+            } else {
+                auto iter = producers.find(t);
+                if (iter != producers.end()) {
+                    srcs.insert(iter->second);
+                }
+            }
+        }
+        // Memory reused by allocMemory and the same execution shared by commands must keep the order
+        for (int j = 0; j < i; ++j) {
+            if (srcs.find(j) != srcs.end()) {
+                continue;
+            }
+            bool conflict = mExecutions[j].get() == mExecutions[i].get();
+            for (auto& a : ranges[j]) {
+                if (conflict) {
+                    break;
+                }
+                for (auto& b : ranges[i]) {
+                    if ((a.write || b.write) && a.begin < b.end && b.begin < a.end) {
+                        conflict = true;
+                        break;
+                    }
+                }
+            }
+            if (conflict) {
+                srcs.insert(j);
+            }
+        }
+        for (auto src : srcs) {
+            graph.AddEdge(nodes[src], nodes[i]);
+        }
+        for (auto t : cmd.outputs) {
+            producers[t] = i;
+        }
+    }
+    std::vector<std::shared_ptr<Node<int>>> order;
+    if (!graph.GetPostOrder(order)) {
+        MNN_ERROR("Invalid dependency for parallel execute, use serial execute\n");
+        return;
+    }
+    std::vector<int> levels(size, 0);
+    int levelNumber = 0;
+    for (auto& node : order) {
+        int level = 0;
+        for (auto& edge : node->getInEdges()) {
+            auto src = edge->getSrc().lock();
+            level    = std::max(level, levels[src->getData()] + 1);
+        }
+        levels[node->getData()] = level;
+        levelNumber             = std::max(levelNumber, level + 1);
+    }
+    if (levelNumber == size) {
+        // No command can run concurrently
+        return;
+    }
+    mLevels.resize(levelNumber);
+    for (int i = 0; i < size; ++i) {
+        mLevels[levels[i]].emplace_back(i);
+    }
+}
+
+ErrorCode Pipeline::_executeParallel() {
+    for (auto& level : mLevels) {
+        if (level.size() > 1) {
+            std::vector<ErrorCode> codes(level.size(), NO_ERROR);
+            auto task = [&](int k) {
+                auto& cmd = mBuffer.command[level[k]];
+                codes[k]  = mExecutions[level[k]]->onExecute(cmd.inputs, cmd.outputs);
+            };
+            if (mBackend->onConcurrent(task, (int)level.size())) {
+                for (auto code : codes) {
+                    if (NO_ERROR != code) {
+                        return code;
+                    }
+                }
+                continue;
+            }
+        }
+        // Single command use multi-thread inside
+        for (auto index : level) {
+            auto& cmd = mBuffer.command[index];
+            auto code = mExecutions[index]->onExecute(cmd.inputs, cmd.outputs);
+            if (NO_ERROR != code) {
+                return code;
+            }
         }
     }
     return NO_ERROR;
@@ -322,6 +599,11 @@ ErrorCode Pipeline::allocMemory(bool supportDebug) {
 
 ErrorCode Pipeline::execute() {
     mBackend->onExecuteBegin();
+    if (!mLevels.empty()) {
+        auto code = _executeParallel();
+        mBackend->onExecuteEnd();
+        return code;
+    }
     for (int i = 0; i < mBuffer.command.size(); ++i) {
         auto& cmd = mBuffer.command[i];
         auto code = mExecutions[i]->onExecute(cmd.inputs, cmd.outputs);
@@ -361,11 +643,14 @@ ErrorCode Pipeline::executeCallBack(const TensorCallBackWithInfo& before, const
     return NO_ERROR;
 }
 
+std::vector<Schedule::PipelineInfo>& Pipeline::getPipelineInfo() {
+    return mInfo;
+}
+
 Pipeline::~Pipeline() {
     mExecutions.clear();
-    for (auto t : mConstTensors) {
-        mBackupBackend->onReleaseBuffer(t, Backend::STATIC);
-    }
+    mOriginExecution.clear();
+    mConstMemory = nullptr;
     if (mInit) {
         for (auto t : mMidConstTensors) {
             if (t->elementSize() > 0) {
@@ -24,7 +24,11 @@ class SizeComputer;
 class Pipeline : public NonCopyable {
 public:
     Pipeline(std::vector<Schedule::PipelineInfo>&& info, std::shared_ptr<Backend> major,
-             std::shared_ptr<Backend> backup, bool allocInput, bool useGeometry);
+             std::shared_ptr<Backend> backup, bool allocInput, bool useGeometry, bool planMemory = false,
+             bool parallel = false, std::shared_ptr<void> modelHolder = nullptr);
+    /** replica of origin: shares origin's constant tensors and the read-only resource of origin's executions */
+    Pipeline(std::vector<Schedule::PipelineInfo>&& info, std::shared_ptr<Backend> major,
+             std::shared_ptr<Backend> backup, const Pipeline* origin);
     ~Pipeline();
     class UnitInfo : public OperatorInfo {
     public:
@@ -41,14 +45,31 @@ public:
        static_model:  3; dynamic_model: 1,2,3
     */
     ErrorCode encode(bool isStatic = false);
-    /** allocMemory: create Execution and alloc memory for every op */
+    /** allocMemory: create Execution and alloc memory for every op
+        with memory plan, alloc twice: record tensors' lifetime by greedy alloc, then alloc by the solved plan
+    */
     ErrorCode allocMemory(bool supportDebug = true);
-    /** execute this pipline */
+    /** execute this pipline
+        with parallel, the commands are divided into levels by dependency and memory reuse,
+        the commands in the same level run concurrently
+    */
     ErrorCode execute();
     ErrorCode executeCallBack(const TensorCallBackWithInfo& before, const TensorCallBackWithInfo& after);
     std::vector<Schedule::PipelineInfo>& getPipelineInfo();
+    /** dynamic memory size of (greedy alloc, alloced indeed) in bytes */
+    std::pair<size_t, size_t> getMemoryPlan() const {
+        return mMemoryPlan;
+    }
 
 private:
+    struct MemoryRange {
+        const uint8_t* begin;
+        const uint8_t* end;
+        bool write;
+    };
+    ErrorCode _allocMemory();
+    void _computeLevels(const std::vector<std::vector<MemoryRange>>& ranges);
+    ErrorCode _executeParallel();
     std::shared_ptr<Backend> mBackend;
     std::shared_ptr<Backend> mBackupBackend;
     std::vector<std::shared_ptr<Execution>> mExecutions;
@@ -57,8 +78,19 @@ private:
     std::vector<Schedule::PipelineInfo> mInfo;
     std::vector<Tensor*> mMidConstTensors;
     std::vector<Tensor*> mConstTensors;
+    struct ConstMemory;
+    std::shared_ptr<ConstMemory> mConstMemory;
+    // Backends of the origin pipelines, the cloned executions' resource is released by them
+    std::vector<std::shared_ptr<Backend>> mOriginBackends;
+    // Keep the model buffer alive while the constant tensors use it directly
+    std::shared_ptr<void> mModelHolder;
     bool mAllocInput;
     bool mInit = false;
+    bool mPlanMemory = false;
+    std::pair<size_t, size_t> mMemoryPlan;
+    std::vector<Tensor*> mDynamicTensors;
+    bool mParallel = false;
+    std::vector<std::vector<int>> mLevels;
     std::map<const Op*, std::shared_ptr<Execution>> mOriginExecution;
 #ifndef MNN_BUILD_MINI
     GeometryComputer::Context mContext;
@@ -56,6 +56,8 @@ public:
         std::vector<std::pair<int, std::shared_ptr<Tensor>>> allTensors;
         /** input valid for resize*/
         bool validForResize;
+        /** holder of model buffer, if not null, constant tensors can directly use the model buffer */
+        std::shared_ptr<void> modelHolder;
     };
 
     /**
@@ -21,7 +21,8 @@ using namespace std;
 
 namespace MNN {
 Session::Session(Schedule::ScheduleInfo&& info, Interpreter::SessionMode callBackMode,
-                 Interpreter::SessionMode inputMode, RuntimeInfo&& runtime) {
+                 Interpreter::SessionMode inputMode, Interpreter::SessionMode memoryMode,
+                 Interpreter::SessionMode executeMode, RuntimeInfo&& runtime) {
     mRuntime = std::move(runtime);
     if (info.pipelineInfo.empty()) {
         mValid = false;
@@ -32,28 +33,71 @@ Session::Session(Schedule::ScheduleInfo&& info, Interpreter::SessionMode callBac
     defaultInfo.numThread = 1;
     mTensors              = std::move(info.allTensors);
     for (auto& iter : info.pipelineInfo) {
-        auto rt    = mRuntime.first.find(iter.first.type)->second.get();
-        auto cpuRuntime = mRuntime.second;
-        std::shared_ptr<Backend> first(rt->onCreate());
-        std::shared_ptr<Backend> second;
-        if (first->type() == MNN_FORWARD_CPU) {
-            second = first;
-        } else {
-            second.reset(cpuRuntime->onCreate());
-        }
-        std::shared_ptr<Pipeline> newPipeline(new Pipeline(std::move(iter.second), first, second, inputMode == Interpreter::Session_Input_Inside, rt->onGetCompilerType() == Runtime::Compiler_Geometry));
+        auto rt       = mRuntime.first.find(iter.first.type)->second.get();
+        auto backends = _createBackends(iter.first.type);
+        std::shared_ptr<Pipeline> newPipeline(new Pipeline(std::move(iter.second), backends.first, backends.second, inputMode == Interpreter::Session_Input_Inside, rt->onGetCompilerType() == Runtime::Compiler_Geometry, memoryMode == Interpreter::Session_Memory_Plan, executeMode == Interpreter::Session_Execute_Parallel, info.modelHolder));
         mPipelines.emplace_back(std::move(newPipeline));
+        mPipelineTypes.emplace_back(iter.first.type);
     }
     mInputs       = std::move(info.inputTensors);
     mOutputs      = std::move(info.outputTensor);
     mCallBackMode = callBackMode;
 }
 
+Session::Session(Schedule::ScheduleInfo&& info, const Session* origin, RuntimeInfo&& runtime) {
+    mRuntime = std::move(runtime);
+    mReplicaLock.reset(new std::mutex);
+    if (info.pipelineInfo.size() != origin->mPipelines.size()) {
+        mValid = false;
+        return;
+    }
+    mTensors = std::move(info.allTensors);
+    for (int i = 0; i < info.pipelineInfo.size(); ++i) {
+        auto& iter    = info.pipelineInfo[i];
+        auto backends = _createBackends(iter.first.type);
+        std::shared_ptr<Pipeline> newPipeline(
+            new Pipeline(std::move(iter.second), backends.first, backends.second, origin->mPipelines[i].get()));
+        mPipelines.emplace_back(std::move(newPipeline));
+        mPipelineTypes.emplace_back(iter.first.type);
+    }
+    mInputs       = std::move(info.inputTensors);
+    mOutputs      = std::move(info.outputTensor);
+    mCallBackMode = origin->mCallBackMode;
+    // Keep the input shape of origin
+    for (auto& iter : mInputs) {
+        auto originInput = origin->mInputs.find(iter.first);
+        if (originInput != origin->mInputs.end()) {
+            TensorUtils::copyShape(originInput->second, iter.second, true);
+        }
+    }
+}
+
+std::pair<std::shared_ptr<Backend>, std::shared_ptr<Backend>> Session::_createBackends(MNNForwardType type) const {
+    auto rt = mRuntime.first.find(type)->second.get();
+    std::shared_ptr<Backend> first(rt->onCreate());
+    std::shared_ptr<Backend> second;
+    if (first->type() == MNN_FORWARD_CPU) {
+        second = first;
+    } else {
+        second.reset(mRuntime.second->onCreate());
+    }
+    return std::make_pair(first, second);
+}
+
 Session::~Session() {
+    mPipelines.clear();
+    // The pipelines release the memory of mid const tensors, so restore the tensors before release them
+    for (auto& cache : mResizeCache) {
+        _restoreState(cache.tensors);
+        for (auto& t : mTensors) {
+            TensorUtils::clearHandleData(t.second.get());
+        }
+        cache.pipelines.clear();
+    }
+    mResizeCache.clear();
     for (auto& t : mTensors) {
         TensorUtils::clearHandleData(t.second.get());
     }
-    mPipelines.clear();
     mRuntime.first.clear();
     mTensors.clear();
     mRuntime.second = nullptr;
@@ -118,7 +162,89 @@ void Session::_clearCache() {
     }
 }
 
+void Session::_saveState(TensorState& state) const {
+    state.resize(mTensors.size());
+    for (int i = 0; i < mTensors.size(); ++i) {
+        auto t          = mTensors[i].second.get();
+        state[i].first  = t->buffer();
+        state[i].second = *TensorUtils::getDescribe(t);
+    }
+}
+
+void Session::_restoreState(const TensorState& state) {
+    for (int i = 0; i < mTensors.size(); ++i) {
+        auto t          = mTensors[i].second.get();
+        auto dim        = t->buffer().dim;
+        t->buffer()     = state[i].first;
+        t->buffer().dim = dim;
+        *TensorUtils::getDescribe(t) = state[i].second;
+    }
+}
+
 ErrorCode Session::resize(bool isStatic) {
+    if (isStatic || mResizeCacheNumber <= 0) {
+        return _resize(isStatic);
+    }
+    std::vector<std::vector<int>> shapes;
+    for (auto& iter : mInputs) {
+        shapes.emplace_back(iter.second->shape());
+    }
+    for (auto iter = mResizeCache.begin(); iter != mResizeCache.end(); ++iter) {
+        if (iter->shapes != shapes) {
+            continue;
+        }
+        // Hit: switch to the cached pipelines and tensors
+        mResizeCacheHit++;
+        mPipelines.clear();
+        _restoreState(iter->tensors);
+        mPipelines = iter->pipelines;
+        mResizeCache.splice(mResizeCache.begin(), mResizeCache, iter);
+        mNeedResize = false;
+        return NO_ERROR;
+    }
+    mResizeCacheMiss++;
+    // The tensors' state always belongs to mPipelines, if mPipelines is not cached (such as resize failed), reuse it
+    if (!mResizeCache.empty() && mResizeCache.front().pipelines == mPipelines) {
+        if (mResizeCache.size() < mResizeCacheNumber) {
+            // The current pipelines is cached, use new pipelines sharing the weight of them
+            std::vector<std::shared_ptr<Pipeline>> pipelines;
+            for (int i = 0; i < mPipelines.size(); ++i) {
+                auto backends = _createBackends(mPipelineTypes[i]);
+                auto info     = mPipelines[i]->getPipelineInfo();
+                pipelines.emplace_back(
+                    new Pipeline(std::move(info), backends.first, backends.second, mPipelines[i].get()));
+            }
+            mPipelines = std::move(pipelines);
+        } else {
+            // Reuse the least recently used pipelines, keep the input shapes
+            std::vector<std::shared_ptr<Tensor>> inputShapes;
+            for (auto& iter : mInputs) {
+                std::shared_ptr<Tensor> shape(new Tensor(iter.second->dimensions()));
+                TensorUtils::copyShape(iter.second, shape.get(), true);
+                inputShapes.emplace_back(shape);
+            }
+            _restoreState(mResizeCache.back().tensors);
+            int index = 0;
+            for (auto& iter : mInputs) {
+                TensorUtils::copyShape(inputShapes[index++].get(), iter.second, true);
+            }
+            mPipelines = mResizeCache.back().pipelines;
+            mResizeCache.pop_back();
+        }
+    }
+    auto code = _resize(false);
+    if (NO_ERROR != code) {
+        return code;
+    }
+    ResizeCache cache;
+    cache.shapes    = std::move(shapes);
+    cache.pipelines = mPipelines;
+    _saveState(cache.tensors);
+    mResizeCache.emplace_front(std::move(cache));
+    return NO_ERROR;
+}
+
+ErrorCode Session::_resize(bool isStatic) {
     for (auto& iter : mRuntime.first) {
         iter.second->onGabageCollect(100);
     }
@@ -155,6 +281,34 @@ bool Session::getInfo(Interpreter::SessionInfoCode code, void* ptr) const {
             *dst = summer;
             return true;
         } break;
+        case Interpreter::MEMORY_PLAN: {
+            auto dst = (float*)ptr;
+            size_t greedy  = 0;
+            size_t planned = 0;
+            for (auto& iter : mPipelines) {
+                auto plan = iter->getMemoryPlan();
+                greedy += plan.first;
+                planned += plan.second;
+            }
+            dst[0] = greedy / 1024.0f / 1024.0f;
+            dst[1] = planned / 1024.0f / 1024.0f;
+            return true;
+        } break;
+        case Interpreter::HUGE_PAGE: {
+            auto dst     = (float*)ptr;
+            float summer = mRuntime.second->onGetHugePageInMB();
+            for (auto& r : mRuntime.first) {
+                summer += r.second->onGetHugePageInMB();
+            }
+            *dst = summer;
+            return true;
+        } break;
+        case Interpreter::RESIZE_CACHE: {
+            auto dst = (int*)ptr;
+            dst[0]   = mResizeCacheHit;
+            dst[1]   = mResizeCacheMiss;
+            return true;
+        } break;
         // TODO: Support other debug info
         default:
             break;
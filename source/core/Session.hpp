@@ -10,13 +10,16 @@
 #define Session_hpp
 
 #include <MNN/Tensor.hpp>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "Pipeline.hpp"
 #include "Schedule.hpp"
 #include "core/Backend.hpp"
 #include "core/Macro.h"
+#include "core/TensorUtils.hpp"
 #include "shape/SizeComputer.hpp"
 
 namespace MNN {
@@ -25,7 +28,12 @@ struct Net;
 class MNN_PUBLIC Session {
 public:
     Session(Schedule::ScheduleInfo&& info, Interpreter::SessionMode callBackMode, Interpreter::SessionMode inputMode,
-            RuntimeInfo&& runtime);
+            Interpreter::SessionMode memoryMode, Interpreter::SessionMode executeMode, RuntimeInfo&& runtime);
+    /**
+     * @brief create replica of origin, info must be scheduled by the same net and configs as origin.
+     * the replica shares constant tensors and executions' weight with origin, but owns its dynamic memory.
+     */
+    Session(Schedule::ScheduleInfo&& info, const Session* origin, RuntimeInfo&& runtime);
     ~Session();
 
 public:
@@ -66,6 +74,13 @@ public:
     void setNeedResize(bool flag = true) {
         mNeedResize = flag;
     }
+    /**
+     * @brief set max number of input shapes whose resize result is cached.
+     * @param number    max number, 0 means no cache.
+     */
+    void setResizeCacheNumber(int number) {
+        mResizeCacheNumber = number;
+    }
 
 public:
     /**
@@ -119,24 +134,52 @@ public:
     bool loadCache(const void* buffer, size_t size);
     std::pair<const void*, size_t> getCache();
 
+    /**
+     * @brief lock of the replica, which owns its runtime and doesn't need to run one by one with other sessions.
+     * @return nullptr if the session isn't a replica.
+     */
+    std::mutex* replicaLock() const {
+        return mReplicaLock.get();
+    }
+
 protected:
     const std::vector<std::shared_ptr<Pipeline>>& getPipelines() const {
         return this->mPipelines;
     }
 
 private:
+    /** tensors' state after resize, shape / memory / regions */
+    typedef std::vector<std::pair<halide_buffer_t, Tensor::InsideDescribe>> TensorState;
+    /** resize result of one group of input shapes */
+    struct ResizeCache {
+        std::vector<std::vector<int>> shapes;
+        std::vector<std::shared_ptr<Pipeline>> pipelines;
+        TensorState tensors;
+    };
     void _clearCache();
     void _setUpTensorInfo(const Schedule::ScheduleInfo& info);
+    void _saveState(TensorState& state) const;
+    void _restoreState(const TensorState& state);
+    /** create (major, backup) backend for pipeline of given type */
+    std::pair<std::shared_ptr<Backend>, std::shared_ptr<Backend>> _createBackends(MNNForwardType type) const;
+    ErrorCode _resize(bool isStatic);
 
 private:
     RuntimeInfo mRuntime;
     std::vector<std::shared_ptr<Pipeline>> mPipelines;
+    std::vector<MNNForwardType> mPipelineTypes;
+    // Most recently used first, the first one's pipelines are mPipelines
+    std::list<ResizeCache> mResizeCache;
+    int mResizeCacheNumber = 0;
+    int mResizeCacheHit    = 0;
+    int mResizeCacheMiss   = 0;
     std::vector<std::pair<int, std::shared_ptr<Tensor>>> mTensors;
     std::map<std::string, Tensor*> mInputs;
     std::map<std::string, Tensor*> mOutputs;
     bool mNeedResize = true;
     bool mValid      = true;
     Interpreter::SessionMode mCallBackMode;
+    std::unique_ptr<std::mutex> mReplicaLock;
 };
 } // namespace MNN
 
@@ -23,8 +23,10 @@ GeometryComputer::Context::~Context() {
     }
 }
 
-GeometryComputer::Context::Context(std::shared_ptr<Backend> allocBackend, bool permitVirtual) {
+GeometryComputer::Context::Context(std::shared_ptr<Backend> allocBackend, bool permitVirtual,
+                                   MNNForwardType type) {
     mPermitVirtual = permitVirtual;
+    mForwardType   = type;
     mBackend       = allocBackend;
     flatbuffers::FlatBufferBuilder builder;
     OpBuilder opBuilder(builder);
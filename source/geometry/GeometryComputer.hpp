@@ -10,6 +10,7 @@
 #define GeometryComputer_hpp
 #include <map>
 #include <vector>
+#include <MNN/MNNForwardType.h>
 #include "MNN_generated.h"
 #include "core/Command.hpp"
 #include "core/TensorUtils.hpp"
@@ -22,7 +23,8 @@ public:
     }
     class MNN_PUBLIC Context {
     public:
-        Context(std::shared_ptr<Backend> allocBackend, bool permitVirtual = true);
+        Context(std::shared_ptr<Backend> allocBackend, bool permitVirtual = true,
+                MNNForwardType type = MNN_FORWARD_CPU);
         ~Context();
 
         void clear();
@@ -30,6 +32,10 @@ public:
         bool supportVirtual() const {
             return mPermitVirtual;
         }
+        // Type of the backend running the commands, the ops only implemented by CPU are emitted for it only
+        MNNForwardType forwardType() const {
+            return mForwardType;
+        }
         Tensor* getRasterCacheCreateRecurrse(Tensor* src, CommandBuffer& cmd);
         const std::vector<std::shared_ptr<Tensor>>& searchConst(const Op* op) const;
         std::shared_ptr<Tensor> allocConst(const Op* key, const std::vector<int>& shape, halide_type_t type,
@@ -42,6 +48,7 @@ public:
         std::map<const Op*, std::vector<std::shared_ptr<Tensor>>> mConstTensors;
         std::vector<std::shared_ptr<Tensor>> mEmpty;
         bool mPermitVirtual;
+        MNNForwardType mForwardType;
         std::shared_ptr<Backend> mBackend;
         std::vector<uint8_t> mRasterOp;
     };
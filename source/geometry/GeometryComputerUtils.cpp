@@ -24,9 +24,11 @@ static bool _hasZeroShapeOutput(const Schedule::PipelineInfo& info) {
 void GeometryComputerUtils::buildConstantTensors(std::vector<Schedule::PipelineInfo>& infos,
                                                  std::shared_ptr<Backend> backupBackend, bool netBufferHold,
                                                  std::vector<Tensor*>& constTensors,
-                                                 std::vector<Tensor*>& midConstTensors) {
+                                                 std::vector<Tensor*>& midConstTensors,
+                                                 const std::vector<Schedule::PipelineInfo>* sharedInfos) {
     // Create Const Tensors
-    for (auto& info : infos) {
+    for (int i = 0; i < infos.size(); ++i) {
+        auto& info = infos[i];
         if (info.op->type() != OpType_Const) {
             continue;
         }
@@ -45,6 +47,15 @@ void GeometryComputerUtils::buildConstantTensors(std::vector<Schedule::PipelineI
         if (netBufferHold && (parameter->dataType() != DataType_DT_HALF)) {
             // The net buffer will be hold by user, we can directly use it
             info.outputs[0]->buffer().host = (uint8_t*)OpCommonUtils::blobData(info.op);
+            TensorUtils::getDescribe(info.outputs[0])->memoryType = Tensor::InsideDescribe::MEMORY_OUTSIDE;
+            constTensors.emplace_back(info.outputs[0]);
+        } else if (nullptr != sharedInfos) {
+            // Share the memory of the const tensor computed by the origin pipeline
+            auto origin = (*sharedInfos)[i].outputs[0];
+            MNN_ASSERT((*sharedInfos)[i].op == info.op);
+            info.outputs[0]->buffer().host = origin->buffer().host;
+            TensorUtils::getDescribe(info.outputs[0])->extra.offset = TensorUtils::getDescribe(origin)->extra.offset;
+            constTensors.emplace_back(info.outputs[0]);
         } else {
             // The net buffer may be released later, or we can't directly use it (for half we need cast to float)
             auto res = backupBackend->onAcquireBuffer(info.outputs[0], Backend::STATIC);
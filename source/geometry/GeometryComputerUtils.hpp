@@ -30,7 +30,8 @@ public:
     static void makeRawAddressRef(Tensor* dst, Tensor* src, int srcOffset, int size, int dstOffset = 0);
     static void buildConstantTensors(std::vector<Schedule::PipelineInfo>& infos, std::shared_ptr<Backend> backupBackend,
                                      bool netHold, std::vector<Tensor*>& constTensors,
-                                     std::vector<Tensor*>& midConstTensors);
+                                     std::vector<Tensor*>& midConstTensors,
+                                     const std::vector<Schedule::PipelineInfo>* sharedInfos = nullptr);
     static ErrorCode shapeComputeAndGeometryTransform(std::vector<Schedule::PipelineInfo>& infos, CommandBuffer& buffer,
                                                       GeometryComputer::Context& geoContext,
                                                       std::shared_ptr<Backend> backupBackend, bool geometry = true);
@@ -76,7 +76,6 @@ public:
             res.extras.emplace_back(tmpInput);
         }
         
-        std::shared_ptr<Tensor> tmpOutput(new Tensor);
         std::shared_ptr<Tensor> C(new Tensor);
         auto& constTensors = context.searchConst(op);
         Tensor* weight = nullptr;
@@ -89,7 +88,8 @@ public:
             auto weightTensor = context.allocConst(op, {outputCount, srcCount}, halide_type_of<float>());
             ::memcpy(weightTensor.get()->host<float>(), parameter->weight()->data(), parameter->weight()->size()*sizeof(float));
             weight = weightTensor.get();
-            auto biasTensor = context.allocConst(op, {batch, outputCount}, halide_type_of<float>());
+            // The bias is added by MatMul for every batch, so that it doesn't depend on the batch
+            auto biasTensor = context.allocConst(op, {outputCount}, halide_type_of<float>());
             ::memcpy(biasTensor.get()->host<float>(), parameter->bias()->data(), parameter->bias()->size()*sizeof(float));
             bias = biasTensor.get();
         }
@@ -101,22 +101,11 @@ public:
             C->setLength(0, batch);
             C->setLength(1, outputCount);
 
-            auto cmd = GeometryComputerUtils::makeMatMul(A, B, C.get(), nullptr, false, true);
+            auto cmd = GeometryComputerUtils::makeMatMul(A, B, C.get(), bias, false, true);
             res.extras.emplace_back(C);
             res.command.emplace_back(std::move(cmd));
         }
 
-        {
-            tmpOutput->buffer().type = halide_type_of<float>();
-            tmpOutput->buffer().dimensions = 2;
-            tmpOutput->setLength(0, batch);
-            tmpOutput->setLength(1, outputCount);
-            
-            auto cmd = GeometryComputerUtils::makeBinary(BinaryOpOperation_ADD, C.get(), bias, tmpOutput.get());
-            res.extras.emplace_back(tmpOutput);
-            res.command.emplace_back(std::move(cmd));
-        }
-        
         {
             auto des = TensorUtils::getDescribe(output);
             des->memoryType = Tensor::InsideDescribe::MEMORY_VIRTUAL;
@@ -124,7 +113,7 @@ public:
             des->regions.reserve(1);
 
             Tensor::InsideDescribe::Region region;
-            region.origin = tmpOutput.get();
+            region.origin = C.get();
             region.size[0] = 1;
             region.size[1] = batch;
             region.size[2] = outputCount;
@@ -12,50 +12,9 @@
 namespace MNN {
 class GeometryLSTM : public GeometryComputer {
 public:
-    void _ComputeLSTMOnnx(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs, Context& context,
-                          CommandBuffer& res, const LSTM* lstm) const {
-        /* inputs:
-        X: T The input sequences packed (and potentially padded) into one 3-D tensor with the shape of [seq_length,
-        batch_size, input_size].
-
-        W: T
-        The weight tensor for the gates. Concatenation of W[iofc] and WB[iofc] (if bidirectional) along dimension 0. The
-        tensor has shape [num_directions, 4*hidden_size, input_size].
-
-        R: T
-        The recurrence weight tensor. Concatenation of R[iofc] and RB[iofc] (if bidirectional) along dimension 0. This
-        tensor has shape [num_directions, 4*hidden_size, hidden_size].
-
-        B: T (optional)
-        The bias tensor for input gate. [Wb[iofc] + Rb[iofc]], and [WBb[iofc] + RBb[iofc]] (if bidirectional) along
-        dimension 0. This tensor has shape [num_directions, 4*hidden_size]. Optional: If not specified - assumed to be
-        0.
-         */
-        MNN_ASSERT(inputs.size() >= 4);
-        auto X_Input      = inputs[0];
-        auto W            = inputs[1];
-        auto R            = inputs[2];
-        auto B            = inputs[3];
-        Tensor* O_Init    = nullptr;
-        Tensor* Cell_Init = nullptr;
-        if (inputs.size() >= 5) {
-            O_Init = inputs[4];
-        }
-        if (inputs.size() >= 6) {
-            Cell_Init = inputs[5];
-        }
-
-        /** Outputs:
-         Y: T (optional)
-         A tensor that concats all the intermediate output values of the hidden. It has shape [seq_length,
-         num_directions, batch_size, hidden_size].
-
-         Y_h: T (optional)
-         The last output value of the hidden. It has shape [num_directions, batch_size, hidden_size].
-
-         Y_c: T (optional)
-         The last output value of the cell. It has shape [num_directions, batch_size, hidden_size].
-         */
+    // Lowering of other backends, each step is MatMul, Unary and Binary commands
+    void _ComputeLSTMSteps(Tensor* X_Input, Tensor* W, Tensor* R, Tensor* B, Tensor* O_Init, Tensor* Cell_Init,
+                           const std::vector<Tensor*>& outputs, CommandBuffer& res) const {
         auto Y = outputs[0];
         if (outputs.size() >= 2) {
             TensorUtils::getDescribe(outputs[1])->regions.clear();
@@ -71,6 +30,41 @@ public:
         auto batchSize     = X_Input->length(1);
         auto hiddenSize    = Y->length(3);
         auto numDirections = Y->length(1);
+        // The states are [hidden, batch] here, and [numDirections, batch, hidden] in inputs and outputs
+        auto makeStateRef = [&](Tensor* state, Tensor* init, int direction) {
+            auto des        = TensorUtils::getDescribe(state);
+            des->memoryType = Tensor::InsideDescribe::MEMORY_VIRTUAL;
+            des->regions.resize(1);
+            auto& reg         = des->regions[0];
+            reg.origin        = init;
+            reg.size[0]       = 1;
+            reg.size[1]       = hiddenSize;
+            reg.size[2]       = batchSize;
+            reg.src.offset    = direction * batchSize * hiddenSize;
+            reg.src.stride[0] = 0;
+            reg.src.stride[1] = 1;
+            reg.src.stride[2] = hiddenSize;
+            reg.dst.offset    = 0;
+            reg.dst.stride[0] = 0;
+            reg.dst.stride[1] = batchSize;
+            reg.dst.stride[2] = 1;
+        };
+        auto makeFinalState = [&](Tensor* state, int direction) {
+            Tensor::InsideDescribe::Region reg;
+            reg.origin        = state;
+            reg.size[0]       = 1;
+            reg.size[1]       = batchSize;
+            reg.size[2]       = hiddenSize;
+            reg.src.offset    = 0;
+            reg.src.stride[0] = 0;
+            reg.src.stride[1] = 1;
+            reg.src.stride[2] = batchSize;
+            reg.dst.offset    = direction * batchSize * hiddenSize;
+            reg.dst.stride[0] = 0;
+            reg.dst.stride[1] = hiddenSize;
+            reg.dst.stride[2] = 1;
+            return reg;
+        };
         // Output contain seqLength * numDirection's region
         auto outputDes        = TensorUtils::getDescribe(Y);
         outputDes->memoryType = Tensor::InsideDescribe::MEMORY_VIRTUAL;
@@ -166,8 +160,8 @@ public:
             }
             for (int t = seqStart; t < seqLength; ++t) {
                 if (0 == t) {
-                    GeometryComputerUtils::makeRawAddressRef(O.get(), O_Init, O->elementSize() * direction, O->elementSize());
-                    GeometryComputerUtils::makeRawAddressRef(Cell.get(), Cell_Init, Cell->elementSize() * direction, Cell->elementSize());
+                    makeStateRef(O.get(), O_Init, direction);
+                    makeStateRef(Cell.get(), Cell_Init, direction);
                 }
                 std::shared_ptr<Tensor> HRTotal(Tensor::createDevice<float>({4 * hiddenSize, batchSize}));
                 std::shared_ptr<Tensor> HRI(Tensor::createDevice<float>({hiddenSize, batchSize}));
@@ -262,10 +256,10 @@ public:
                 O = newO;
             }
             if (outputs.size() >= 2) {
-                TensorUtils::getDescribe(outputs[1])->regions.emplace_back(GeometryComputerUtils::makeRawAddressRef(O.get(), 0, O->elementSize(), O->elementSize() * direction));
+                TensorUtils::getDescribe(outputs[1])->regions.emplace_back(makeFinalState(O.get(), direction));
             }
             if (outputs.size() >= 3) {
-                TensorUtils::getDescribe(outputs[2])->regions.emplace_back(GeometryComputerUtils::makeRawAddressRef(Cell.get(), 0, Cell->elementSize(), Cell->elementSize() * direction));
+                TensorUtils::getDescribe(outputs[2])->regions.emplace_back(makeFinalState(Cell.get(), direction));
             }
         };
         std::shared_ptr<Tensor> XWrap(Tensor::createDevice<float>({seqLength * batchSize, inputSize}));
@@ -296,12 +290,112 @@ public:
             encode(XReverse.get(), 1);
         }
     }
+    bool _ComputeLSTMOnnx(const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs, Context& context,
+                          CommandBuffer& res, const Op* op) const {
+        /* inputs:
+        X: T The input sequences packed (and potentially padded) into one 3-D tensor with the shape of [seq_length,
+        batch_size, input_size].
+
+        W: T
+        The weight tensor for the gates. Concatenation of W[iofc] and WB[iofc] (if bidirectional) along dimension 0. The
+        tensor has shape [num_directions, 4*hidden_size, input_size].
+
+        R: T
+        The recurrence weight tensor. Concatenation of R[iofc] and RB[iofc] (if bidirectional) along dimension 0. This
+        tensor has shape [num_directions, 4*hidden_size, hidden_size].
+
+        B: T (optional)
+        The bias tensor for input gate. [Wb[iofc] + Rb[iofc]], and [WBb[iofc] + RBb[iofc]] (if bidirectional) along
+        dimension 0. This tensor has shape [num_directions, 4*hidden_size]. Optional: If not specified - assumed to be
+        0.
+         */
+        MNN_ASSERT(inputs.size() >= 4);
+        auto X_Input      = inputs[0];
+        auto W            = inputs[1];
+        auto R            = inputs[2];
+        auto B            = inputs[3];
+        Tensor* O_Init    = nullptr;
+        Tensor* Cell_Init = nullptr;
+        if (inputs.size() >= 5) {
+            O_Init = inputs[4];
+        }
+        if (inputs.size() >= 6) {
+            Cell_Init = inputs[5];
+        }
+
+        /** Outputs:
+         Y: T (optional)
+         A tensor that concats all the intermediate output values of the hidden. It has shape [seq_length,
+         num_directions, batch_size, hidden_size].
+
+         Y_h: T (optional)
+         The last output value of the hidden. It has shape [num_directions, batch_size, hidden_size].
+
+         Y_c: T (optional)
+         The last output value of the cell. It has shape [num_directions, batch_size, hidden_size].
+         */
+        auto Y             = outputs[0];
+        auto seqLength     = X_Input->length(0);
+        auto inputSize     = X_Input->length(2);
+        auto batchSize     = X_Input->length(1);
+        auto hiddenSize    = Y->length(3);
+        auto numDirections = Y->length(1);
+
+        if ((nullptr == O_Init) != (nullptr == Cell_Init)) {
+            // A missing one of the initial states is zero
+            std::shared_ptr<Tensor> zero;
+            auto& tensors = context.searchConst(op);
+            if (!tensors.empty() && tensors[0]->elementSize() == numDirections * batchSize * hiddenSize) {
+                zero = tensors[0];
+            } else {
+                zero = context.allocConst(op, {numDirections, batchSize, hiddenSize}, halide_type_of<float>());
+                if (nullptr == zero) {
+                    return false;
+                }
+                ::memset(zero->host<float>(), 0, zero->size());
+            }
+            O_Init    = nullptr != O_Init ? O_Init : zero.get();
+            Cell_Init = nullptr != Cell_Init ? Cell_Init : zero.get();
+        }
+        // LSTMRecurrence is only implemented by CPU
+        if (MNN_FORWARD_CPU != context.forwardType()) {
+            _ComputeLSTMSteps(X_Input, W, R, B, O_Init, Cell_Init, outputs, res);
+            return true;
+        }
+
+        // FirstPart: Gate = MatMul(X, W, B) of all time steps: seqLength * batchSize, 4 * hiddenSize
+        std::shared_ptr<Tensor> XWrap(Tensor::createDevice<float>({seqLength * batchSize, inputSize}));
+        GeometryComputerUtils::makeRawAddressRef(XWrap.get(), X_Input, 0, seqLength * batchSize * inputSize);
+        res.extras.emplace_back(XWrap);
+        std::vector<Tensor*> recurrentInputs = {R};
+        for (int direction = 0; direction < numDirections; ++direction) {
+            std::shared_ptr<Tensor> Bias(Tensor::createDevice<float>({4 * hiddenSize}));
+            std::shared_ptr<Tensor> WWrap(Tensor::createDevice<float>({4 * hiddenSize, inputSize}));
+            std::shared_ptr<Tensor> GateWrap(Tensor::createDevice<float>({seqLength * batchSize, 4 * hiddenSize}));
+            GeometryComputerUtils::makeRawAddressRef(Bias.get(), B, direction * 4 * hiddenSize, 4 * hiddenSize);
+            GeometryComputerUtils::makeRawAddressRef(WWrap.get(), W, direction * 4 * hiddenSize * inputSize,
+                                                     4 * hiddenSize * inputSize);
+            res.command.emplace_back(
+                GeometryComputerUtils::makeMatMul(XWrap.get(), WWrap.get(), GateWrap.get(), Bias.get(), false, true));
+            res.extras.insert(res.extras.end(), {Bias, WWrap, GateWrap});
+            recurrentInputs.emplace_back(GateWrap.get());
+        }
+
+        // SecondPart: the recurrent steps of all directions in one op, it writes the outputs directly
+        if (nullptr != O_Init) {
+            recurrentInputs.emplace_back(O_Init);
+            recurrentInputs.emplace_back(Cell_Init);
+        }
+        std::unique_ptr<OpT> recurrence(new OpT);
+        recurrence->type = OpType_LSTMRecurrence;
+        res.command.emplace_back(GeometryComputerUtils::makeCommand(recurrence.get(), recurrentInputs, outputs));
+        return true;
+    }
     virtual bool onCompute(const Op* op, const std::vector<Tensor*>& inputs, const std::vector<Tensor*>& outputs,
                            Context& context, CommandBuffer& res) const override {
         if (2 < inputs.size()) {
             // Onnx 's LSTM, use origin way
-            _ComputeLSTMOnnx(inputs, outputs, context, res, op->main_as_LSTM());
-            return true;
+            return _ComputeLSTMOnnx(inputs, outputs, context, res, op);
         }
         // For Old version's Caffe LSTM compute
         MNN_ASSERT(1 == outputs.size());
@@ -468,7 +562,9 @@ public:
             reg.origin        = inputs[0];
         }
         std::shared_ptr<Tensor> tempOutput(Tensor::createDevice<float>({seqLength, 1, batchSize, hiddenSize}));
-        _ComputeLSTMOnnx({tempInput.get(), W, R, B}, {tempOutput.get()}, context, res, op->main_as_LSTM());
+        if (!_ComputeLSTMOnnx({tempInput.get(), W, R, B}, {tempOutput.get()}, context, res, op)) {
+            return false;
+        }
         res.extras.emplace_back(tempInput);
         res.extras.emplace_back(tempOutput);
         {
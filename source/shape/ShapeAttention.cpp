@@ -0,0 +1,64 @@
+//
+//  ShapeAttention.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "shape/SizeComputer.hpp"
+#include "core/Macro.h"
+#include "core/TensorUtils.hpp"
+
+namespace MNN {
+
+// inputs: Q [..., seqQ, depth], K [..., seqK, depth], V [..., seqK, depthV], optional mask broadcast to
+// [..., seqQ, seqK], output: [..., seqQ, depthV]
+class AttentionComputer : public SizeComputer {
+public:
+    virtual bool onComputeSize(const MNN::Op* op, const std::vector<Tensor*>& inputs,
+                               const std::vector<Tensor*>& outputs) const override {
+        MNN_ASSERT(3 == inputs.size() || 4 == inputs.size());
+        MNN_ASSERT(1 == outputs.size());
+        auto query = inputs[0];
+        auto key   = inputs[1];
+        auto value = inputs[2];
+        const int dimensions = query->dimensions();
+        if (dimensions < 2 || key->dimensions() != dimensions || value->dimensions() != dimensions) {
+            return false;
+        }
+        for (int i = 0; i < dimensions - 2; ++i) {
+            if (query->length(i) != key->length(i) || query->length(i) != value->length(i)) {
+                return false;
+            }
+        }
+        if (query->length(dimensions - 1) != key->length(dimensions - 1) ||
+            key->length(dimensions - 2) != value->length(dimensions - 2)) {
+            return false;
+        }
+        if (4 == inputs.size()) {
+            // The mask is broadcast to the scores except the last dimension
+            auto mask = inputs[3];
+            if (mask->dimensions() > dimensions || mask->dimensions() < 1 ||
+                mask->length(mask->dimensions() - 1) != key->length(dimensions - 2)) {
+                return false;
+            }
+            auto offset = dimensions - mask->dimensions();
+            for (int i = 0; i < mask->dimensions() - 1; ++i) {
+                // Dimensions of the scores before the last are the same as query
+                if (mask->length(i) != 1 && mask->length(i) != query->length(i + offset)) {
+                    return false;
+                }
+            }
+        }
+        auto output = outputs[0];
+        output->buffer().type = query->buffer().type;
+        TensorUtils::copyShape(query, output, true);
+        output->setLength(dimensions - 1, value->length(dimensions - 1));
+        return true;
+    }
+};
+
+REGISTER_SHAPE(AttentionComputer, OpType_Attention);
+
+} // namespace MNN
@@ -0,0 +1,51 @@
+//
+//  ShapeEmbeddingBag.cpp
+//  MNN
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "shape/SizeComputer.hpp"
+#include "core/Macro.h"
+#include "core/TensorUtils.hpp"
+
+namespace MNN {
+
+// inputs: weight [rows, ...], indices [bags, bagSize] or indices [N] with offsets [bags], output: [bags, ...]
+class EmbeddingBagComputer : public SizeComputer {
+public:
+    virtual bool onComputeSize(const MNN::Op* op, const std::vector<Tensor*>& inputs,
+                               const std::vector<Tensor*>& outputs) const override {
+        MNN_ASSERT(2 == inputs.size() || 3 == inputs.size());
+        MNN_ASSERT(1 == outputs.size());
+        auto weight  = inputs[0];
+        auto indices = inputs[1];
+        if (weight->dimensions() < 1 || indices->getType().code != halide_type_int) {
+            return false;
+        }
+        int bags = 0;
+        if (3 == inputs.size()) {
+            auto offsets = inputs[2];
+            if (1 != indices->dimensions() || 1 != offsets->dimensions() ||
+                offsets->getType().code != halide_type_int) {
+                return false;
+            }
+            bags = offsets->length(0);
+        } else {
+            if (2 != indices->dimensions()) {
+                return false;
+            }
+            bags = indices->length(0);
+        }
+        auto output = outputs[0];
+        output->buffer().type = weight->buffer().type;
+        TensorUtils::copyShape(weight, output, true);
+        output->setLength(0, bags);
+        return true;
+    }
+};
+
+REGISTER_SHAPE(EmbeddingBagComputer, OpType_EmbeddingBag);
+
+} // namespace MNN
@@ -87,6 +87,8 @@ extern void ___SpaceToBatchNDSizeComputer__OpType_SpaceToBatchND__();
 extern void ___PackComputer__OpType_Pack__();
 extern void ___DeconvolutionSizeComputer__OpType_Deconvolution__();
 extern void ___DeconvolutionSizeComputer__OpType_DeconvolutionDepthwise__();
+extern void ___AttentionComputer__OpType_Attention__();
+extern void ___EmbeddingBagComputer__OpType_EmbeddingBag__();
 
 void registerShapeOps() {
 ___ShapeSizeComputer__OpType_Shape__();
@@ -176,5 +178,7 @@ ___SpaceToBatchNDSizeComputer__OpType_SpaceToBatchND__();
 ___PackComputer__OpType_Pack__();
 ___DeconvolutionSizeComputer__OpType_Deconvolution__();
 ___DeconvolutionSizeComputer__OpType_DeconvolutionDepthwise__();
+___AttentionComputer__OpType_Attention__();
+___EmbeddingBagComputer__OpType_EmbeddingBag__();
 }
 }
@@ -30,7 +30,10 @@ class ShapeScatterNd : public SizeComputer {
         }
 
         const int dimension = shape->length(0);
-        MNN_CHECK(updates->dimensions() == dimension, "updates dimension should be equal to given shape");
+        // updates.shape = indices.shape[:-1] + shape[indices.shape[-1]:]
+        const int sliceDims = indices->length(indicesDimension - 1);
+        MNN_CHECK(updates->dimensions() == outerDims + dimension - sliceDims,
+                  "updates dimension should be indices.rank - 1 + shape.length - indices.shape[-1]");
 
         output->buffer().dimensions = dimension;
 
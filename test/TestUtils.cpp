@@ -48,3 +48,45 @@ void dispatch(std::function<void(MNNForwardType)> payload, MNNForwardType backen
             break;
     }
 }
+
+std::vector<float> makeTestData(int size, int seed) {
+    std::vector<float> data(size);
+    for (int i = 0; i < size; ++i) {
+        data[i] = (float)((i * 37 + seed * 101) % 97) / 97.0f - 0.5f;
+    }
+    return data;
+}
+
+std::vector<float> makeSinTestData(int size, float scale) {
+    std::vector<float> data(size);
+    for (int i = 0; i < size; ++i) {
+        data[i] = sinf(i * scale) * 0.5f;
+    }
+    return data;
+}
+
+std::vector<uint8_t> packTestModel(const MNN::NetT* net) {
+    flatbuffers::FlatBufferBuilder builder(1024);
+    auto offset = Net::Pack(builder, net);
+    builder.Finish(offset);
+    return std::vector<uint8_t>(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+}
+
+std::vector<uint8_t> saveTestModel(const std::vector<MNN::Express::VARP>& outputs) {
+    std::unique_ptr<NetT> net(new NetT);
+    MNN::Express::Variable::save(outputs, net.get());
+    return packTestModel(net.get());
+}
+
+std::vector<float> runTestSession(MNN::Interpreter* net, MNN::Session* session, float scale) {
+    auto input = net->getSessionInput(session, nullptr);
+    std::shared_ptr<Tensor> inputHost(new Tensor(input, Tensor::CAFFE));
+    auto data = makeSinTestData(inputHost->elementSize(), scale);
+    ::memcpy(inputHost->host<float>(), data.data(), data.size() * sizeof(float));
+    input->copyFromHostTensor(inputHost.get());
+    net->runSession(session);
+    auto output = net->getSessionOutput(session, nullptr);
+    std::shared_ptr<Tensor> outputHost(new Tensor(output, Tensor::CAFFE));
+    output->copyToHostTensor(outputHost.get());
+    return std::vector<float>(outputHost->host<float>(), outputHost->host<float>() + outputHost->elementSize());
+}
@@ -13,8 +13,11 @@
 #include <stdio.h>
 #include <functional>
 #include <string>
+#include <vector>
+#include <MNN/Interpreter.hpp>
 #include <MNN/MNNForwardType.h>
 #include <MNN/Tensor.hpp>
+#include <MNN/expr/Expr.hpp>
 #include <math.h>
 #include <iostream>
 #include "core/Backend.hpp"
@@ -31,6 +34,40 @@ void dispatch(std::function<void(MNNForwardType)> payload);
  */
 void dispatch(std::function<void(MNNForwardType)> payload, MNNForwardType backend);
 
+/**
+ * @brief make deterministic test data in [-0.5, 0.5)
+ * @param size      count of the data
+ * @param seed      different seeds make different data
+ */
+std::vector<float> makeTestData(int size, int seed);
+
+/**
+ * @brief make smooth test data of sin(i * scale) / 2
+ * @param size      count of the data
+ * @param scale     frequency of the data
+ */
+std::vector<float> makeSinTestData(int size, float scale);
+
+/**
+ * @brief pack the net to a model buffer
+ * @param net       net to pack
+ */
+std::vector<uint8_t> packTestModel(const MNN::NetT* net);
+
+/**
+ * @brief save the outputs to a model buffer
+ * @param outputs   outputs of the model
+ */
+std::vector<uint8_t> saveTestModel(const std::vector<MNN::Express::VARP>& outputs);
+
+/**
+ * @brief feed makeSinTestData to the only input, run the session and copy out the only output
+ * @param net       interpreter of the session
+ * @param session   session to run
+ * @param scale     scale of the input data
+ */
+std::vector<float> runTestSession(MNN::Interpreter* net, MNN::Session* session, float scale = 0.1f);
+
 /**
  @brief check the result with the ground truth
  @param result data
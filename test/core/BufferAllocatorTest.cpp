@@ -56,3 +56,49 @@ public:
     }
 };
 MNNTestSuiteRegister(BufferAllocatorTest, "core/buffer_allocator");
+
+class BufferAllocatorPlanTest : public MNNTestCase {
+public:
+    virtual ~BufferAllocatorPlanTest() = default;
+    virtual bool run() {
+        auto alignment = MNN_MEMORY_ALIGN_DEFAULT;
+        BufferAllocator allocator(BufferAllocator::Allocator::createDefault());
+        auto sequence = [&allocator](std::pair<void*, int>* res) {
+            res[0] = allocator.alloc(100);
+            res[1] = allocator.alloc(200);
+            allocator.free(res[0]);
+            res[2] = allocator.alloc(300);
+        };
+        std::pair<void*, int> p[3];
+
+        // record - greedy can't reuse the freed chunk
+        allocator.beginRecord();
+        sequence(p);
+        MNNTEST_ASSERT(allocator.plan());
+        MNNTEST_ASSERT(allocator.greedySize() == 128 + 256 + 320);
+        MNNTEST_ASSERT(allocator.plannedSize() == 256 + 320);
+        allocator.release();
+
+        // apply - same sequence alloced from one arena
+        allocator.beginApply();
+        sequence(p);
+        MNNTEST_ASSERT(allocator.endPlan());
+        MNNTEST_ASSERT(allocator.totalSize() == 256 + 320);
+        for (int i = 0; i < 3; ++i) {
+            MNNTEST_ASSERT(((size_t)p[i].first + p[i].second) % alignment == 0);
+        }
+        auto b = (uint8_t*)p[1].first + p[1].second;
+        auto c = (uint8_t*)p[2].first + p[2].second;
+        MNNTEST_ASSERT(b + 200 <= c || c + 300 <= b);
+        allocator.release();
+        MNNTEST_ASSERT(allocator.totalSize() == 0);
+
+        // apply with mismatched sequence fallback to greedy
+        allocator.beginApply();
+        auto p1 = allocator.alloc(400);
+        MNNTEST_ASSERT(nullptr != p1.first);
+        MNNTEST_ASSERT(!allocator.endPlan());
+        return true;
+    }
+};
+MNNTestSuiteRegister(BufferAllocatorPlanTest, "core/buffer_allocator_plan");
@@ -0,0 +1,74 @@
+//
+//  CloneSessionTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include <thread>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+class CloneSessionTest : public MNNTestCase {
+public:
+    virtual ~CloneSessionTest() = default;
+    virtual bool run() {
+        // Convolutions of winograd / strassen / depthwise and a matmul with const weight
+        const int channel = 8;
+        auto x = _Convert(_Input({1, channel, 12, 12}, NCHW), NC4HW4);
+        x      = _Conv(makeSinTestData(channel * channel * 9, 0.3f), makeSinTestData(channel, 0.7f), x,
+                       {channel, channel}, {3, 3}, SAME);
+        x      = _Conv(makeSinTestData(channel * channel, 0.2f), makeSinTestData(channel, 0.5f), x,
+                       {channel, channel}, {1, 1});
+        x      = _Conv(makeSinTestData(channel * 9, 0.4f), makeSinTestData(channel, 0.6f), x, {channel, channel},
+                       {3, 3}, SAME, {1, 1}, {1, 1}, channel);
+        x      = _Reshape(_Convert(x, NCHW), {channel, 144});
+        auto weightData = makeSinTestData(144 * 4, 0.9f);
+        auto y          = _MatMul(x, _Const(weightData.data(), {144, 4}, NCHW));
+        auto model      = saveTestModel({y});
+        std::shared_ptr<Interpreter> interp(Interpreter::createFromBuffer(model.data(), model.size()));
+
+        ScheduleConfig config;
+        config.numThread = 1;
+        auto origin      = interp->createSession(config);
+        auto expect      = runTestSession(interp.get(), origin);
+        auto first       = interp->cloneSession(origin);
+        auto second      = interp->cloneSession(first);
+        if (nullptr == first || nullptr == second) {
+            MNN_ERROR("Clone session failed\n");
+            return false;
+        }
+        // The replicas must keep working after origin released
+        interp->releaseSession(origin);
+        std::vector<float> results[2];
+        Session* sessions[2] = {first, second};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 2; ++i) {
+            threads.emplace_back([&, i]() { results[i] = runTestSession(interp.get(), sessions[i]); });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        for (int i = 0; i < 2; ++i) {
+            if (results[i].size() != expect.size()) {
+                MNN_ERROR("Clone session output size error\n");
+                return false;
+            }
+            for (int j = 0; j < expect.size(); ++j) {
+                if (fabsf(results[i][j] - expect[j]) > 1e-4f) {
+                    MNN_ERROR("Clone session %d result error at %d: %f - %f\n", i, j, results[i][j], expect[j]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(CloneSessionTest, "core/clone_session");
@@ -0,0 +1,72 @@
+//
+//  ConcurrencyTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <MNN/MNNDefine.h>
+#include "MNNTestSuite.h"
+#include "core/Concurrency.h"
+
+using namespace MNN;
+
+class ConcurrencyCounterTest : public MNNTestCase {
+public:
+    virtual ~ConcurrencyCounterTest() = default;
+    virtual bool run() {
+        const int sizes[]  = {0, 1, 7, 100, 1031};
+        const int grains[] = {1, 3, 64};
+        const int threadNumber = 4;
+        for (auto size : sizes) {
+            for (auto grain : grains) {
+                ConcurrencyCounter counter(size, threadNumber, grain);
+                std::vector<std::atomic_int> counts(size);
+                std::vector<std::thread> threads;
+                bool chunkValid[threadNumber];
+                for (int t = 0; t < threadNumber; ++t) {
+                    chunkValid[t] = true;
+                    threads.emplace_back([&, t]() {
+                        int begin, end;
+                        while (counter.next(begin, end)) {
+                            // Only the last chunk may be less than grain
+                            if (begin >= end || (end - begin < grain && end != size)) {
+                                chunkValid[t] = false;
+                            }
+                            for (int i = begin; i < end; ++i) {
+                                counts[i]++;
+                            }
+                        }
+                    });
+                }
+                for (auto& t : threads) {
+                    t.join();
+                }
+                for (int t = 0; t < threadNumber; ++t) {
+                    if (!chunkValid[t]) {
+                        MNN_ERROR("Invalid chunk for size %d, grain %d\n", size, grain);
+                        return false;
+                    }
+                }
+                for (int i = 0; i < size; ++i) {
+                    if (counts[i] != 1) {
+                        MNN_ERROR("Index %d is taken %d times for size %d, grain %d\n", i, (int)counts[i], size, grain);
+                        return false;
+                    }
+                }
+                int begin, end;
+                counter.reset();
+                if (size > 0 && (!counter.next(begin, end) || begin != 0)) {
+                    MNN_ERROR("Counter reset error for size %d\n", size);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(ConcurrencyCounterTest, "core/concurrency_counter");
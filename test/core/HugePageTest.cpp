@@ -0,0 +1,107 @@
+//
+//  HugePageTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <string.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+#include "backend/cpu/CPUMmapAllocator.hpp"
+using namespace MNN::Express;
+using namespace MNN;
+
+static std::vector<float> _runSession(Interpreter* net, BackendConfig::PageMode page, bool prefault) {
+    ScheduleConfig config;
+    config.numThread = 2;
+    BackendConfig backendConfig;
+    backendConfig.page     = page;
+    backendConfig.prefault = prefault;
+    config.backendConfig   = &backendConfig;
+    auto session           = net->createSession(config);
+    auto result            = runTestSession(net, session);
+    float hugePage = -1.0f;
+    if (!net->getSessionInfo(session, Interpreter::HUGE_PAGE, &hugePage) || hugePage < 0.0f) {
+        MNN_ERROR("Can't get huge page info\n");
+        result.clear();
+    }
+    net->releaseSession(session);
+    return result;
+}
+
+class HugePageTest : public MNNTestCase {
+public:
+    virtual ~HugePageTest() = default;
+    bool testAllocator() {
+        for (auto page : {BackendConfig::Page_Normal, BackendConfig::Page_Huge, BackendConfig::Page_HugeTLB}) {
+            for (auto prefault : {false, true}) {
+                std::shared_ptr<CPUMmapAllocator> outside(new CPUMmapAllocator(-1, page, prefault, 2));
+                BufferAllocator allocator(outside);
+                for (int size : {256, 128 * 1024, 8 * 1024 * 1024 + 100}) {
+                    auto ptr = allocator.alloc(size, true);
+                    if (nullptr == ptr.first) {
+                        MNN_ERROR("Mmap allocator of page %d failed for size %d\n", page, size);
+                        return false;
+                    }
+                    auto host = (uint8_t*)ptr.first + ptr.second;
+                    if (0 != ((size_t)host % MNN_MEMORY_ALIGN_DEFAULT)) {
+                        MNN_ERROR("Mmap allocator of page %d isn't aligned\n", page);
+                        return false;
+                    }
+                    ::memset(host, 1, size);
+                    if (BackendConfig::Page_Normal == page && outside->hugePageSize() > 0) {
+                        MNN_ERROR("Normal pages shouldn't be counted as huge pages\n");
+                        return false;
+                    }
+                    allocator.free(ptr);
+                }
+                allocator.release(true);
+                if (outside->hugePageSize() > 0) {
+                    MNN_ERROR("Huge pages should be released with the buffers\n");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        if (!testAllocator()) {
+            return false;
+        }
+        // Large enough for the buffers to be mapped
+        const int channel = 32;
+        auto x = _Convert(_Input({1, channel, 128, 128}, NCHW), NC4HW4);
+        x      = _Conv(makeSinTestData(channel * channel * 9, 0.3f), makeSinTestData(channel, 0.7f), x,
+                       {channel, channel}, {3, 3}, SAME);
+        x      = _Conv(makeSinTestData(channel * channel, 0.2f), makeSinTestData(channel, 0.5f), x,
+                       {channel, channel}, {1, 1});
+        auto y = _Convert(x, NCHW);
+        auto model = saveTestModel({y});
+        std::shared_ptr<Interpreter> interp(Interpreter::createFromBuffer(model.data(), model.size()));
+        auto expect = _runSession(interp.get(), BackendConfig::Page_Normal, false);
+        if (expect.empty()) {
+            return false;
+        }
+        for (auto page : {BackendConfig::Page_Normal, BackendConfig::Page_Huge, BackendConfig::Page_HugeTLB}) {
+            auto result = _runSession(interp.get(), page, true);
+            if (result.size() != expect.size()) {
+                MNN_ERROR("Huge page output size error for page %d\n", page);
+                return false;
+            }
+            for (int i = 0; i < expect.size(); ++i) {
+                if (fabsf(result[i] - expect[i]) > 1e-5f) {
+                    MNN_ERROR("Huge page result error for page %d at %d: %f - %f\n", page, i, result[i], expect[i]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(HugePageTest, "core/huge_page");
@@ -0,0 +1,76 @@
+//
+//  MapModelTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+class MapModelTest : public MNNTestCase {
+public:
+    virtual ~MapModelTest() = default;
+    virtual bool run() {
+        const int channel = 8;
+        auto x = _Convert(_Input({1, channel, 12, 12}, NCHW), NC4HW4);
+        x      = _Conv(makeSinTestData(channel * channel * 9, 0.3f), makeSinTestData(channel, 0.7f), x,
+                       {channel, channel}, {3, 3}, SAME);
+        x      = _Reshape(_Convert(x, NCHW), {channel, 144});
+        auto weightData = makeSinTestData(144 * 4, 0.9f);
+        auto y          = _MatMul(x, _Const(weightData.data(), {144, 4}, NCHW));
+        auto model      = saveTestModel({y});
+        const char* fileName = "MapModelTest.mnn";
+        auto file            = fopen(fileName, "wb");
+        if (nullptr == file) {
+            MNN_ERROR("Can't write %s\n", fileName);
+            return false;
+        }
+        fwrite(model.data(), 1, model.size(), file);
+        fclose(file);
+
+        ScheduleConfig config;
+        config.numThread = 1;
+        std::shared_ptr<Interpreter> reference(Interpreter::createFromBuffer(model.data(), model.size()));
+        auto expect = runTestSession(reference.get(), reference->createSession(config));
+        std::shared_ptr<Interpreter> interp(Interpreter::createFromFile(fileName));
+        if (nullptr == interp) {
+            MNN_ERROR("Create interpreter from file failed\n");
+            return false;
+        }
+        auto modelBuffer = interp->getModelBuffer();
+        if (modelBuffer.second != model.size() || 0 != ::memcmp(modelBuffer.first, model.data(), modelBuffer.second)) {
+            MNN_ERROR("Model buffer of file is not the same as origin\n");
+            return false;
+        }
+        auto session = interp->createSession(config);
+        auto clone   = interp->cloneSession(session);
+        // The constant tensors directly use the mapped model, it must be kept after releaseModel
+        interp->releaseModel();
+        std::vector<float> results[2] = {runTestSession(interp.get(), session), runTestSession(interp.get(), clone)};
+        for (auto& result : results) {
+            if (result.size() != expect.size()) {
+                MNN_ERROR("Map model output size error\n");
+                return false;
+            }
+            for (int i = 0; i < expect.size(); ++i) {
+                if (fabsf(result[i] - expect[i]) > 1e-5f) {
+                    MNN_ERROR("Map model result error at %d: %f - %f\n", i, result[i], expect[i]);
+                    return false;
+                }
+            }
+        }
+        interp.reset();
+        remove(fileName);
+        return true;
+    }
+};
+MNNTestSuiteRegister(MapModelTest, "core/map_model");
@@ -0,0 +1,67 @@
+//
+//  MemoryPlanTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+// The same model by greedy alloc and by memory plan, the two interpreters don't share the memory
+class MemoryPlanTest : public MNNTestCase {
+public:
+    virtual ~MemoryPlanTest() = default;
+    virtual bool run() {
+        // Growing tensors, the chunk freed by greedy alloc is too small for the next one
+        int channel = 8;
+        auto x      = _Convert(_Input({1, channel, 32, 32}, NCHW), NC4HW4);
+        for (int i = 0; i < 4; ++i) {
+            x = _Conv(makeSinTestData(channel * channel * 2, 0.1f * (i + 1)),
+                      makeSinTestData(channel * 2, 0.3f * (i + 1)), x, {channel, channel * 2}, {1, 1});
+            x = _Relu6(x);
+            channel *= 2;
+        }
+        auto output = _Convert(x, NCHW);
+        auto model  = saveTestModel({output});
+
+        ScheduleConfig config;
+        config.numThread = 1;
+        std::shared_ptr<Interpreter> greedyNet(Interpreter::createFromBuffer(model.data(), model.size()));
+        greedyNet->setSessionMode(Interpreter::Session_Memory_Greedy);
+        auto greedy = greedyNet->createSession(config);
+        std::shared_ptr<Interpreter> planNet(Interpreter::createFromBuffer(model.data(), model.size()));
+        planNet->setSessionMode(Interpreter::Session_Memory_Plan);
+        auto plan = planNet->createSession(config);
+
+        auto expect = runTestSession(greedyNet.get(), greedy);
+        auto result = runTestSession(planNet.get(), plan);
+        if (expect.size() != result.size()) {
+            MNN_ERROR("Memory plan output size error\n");
+            return false;
+        }
+        for (int i = 0; i < expect.size(); ++i) {
+            if (fabsf(expect[i] - result[i]) > 1e-5f) {
+                MNN_ERROR("Memory plan result error at %d: %f - %f\n", i, result[i], expect[i]);
+                return false;
+            }
+        }
+        float greedyMemory[2];
+        float planMemory[2];
+        greedyNet->getSessionInfo(greedy, Interpreter::MEMORY_PLAN, greedyMemory);
+        planNet->getSessionInfo(plan, Interpreter::MEMORY_PLAN, planMemory);
+        if (greedyMemory[1] <= 0.0f || planMemory[1] <= 0.0f || planMemory[1] >= greedyMemory[1]) {
+            MNN_ERROR("Memory plan peak memory error: greedy %f M, planned %f M\n", greedyMemory[1], planMemory[1]);
+            return false;
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(MemoryPlanTest, "core/memory_plan");
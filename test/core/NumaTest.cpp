@@ -0,0 +1,110 @@
+//
+//  NumaTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <string.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+#include "backend/cpu/CPUNuma.hpp"
+using namespace MNN::Express;
+using namespace MNN;
+
+static std::vector<float> _runSession(Interpreter* net, BackendConfig::NumaMode numa, int node) {
+    ScheduleConfig config;
+    config.numThread = 2;
+    BackendConfig backendConfig;
+    backendConfig.numa     = numa;
+    backendConfig.numaNode = node;
+    config.backendConfig   = &backendConfig;
+    auto session           = net->createSession(config);
+    auto result            = runTestSession(net, session);
+    net->releaseSession(session);
+    return result;
+}
+
+class NumaTest : public MNNTestCase {
+public:
+    virtual ~NumaTest() = default;
+    bool testCPUList() {
+        std::vector<int> expect = {0, 1, 2, 3, 8, 10, 11};
+        if (CPUNuma::parseCPUList("0-3,8,10-11\n") != expect) {
+            MNN_ERROR("Parse cpu list error\n");
+            return false;
+        }
+        if (!CPUNuma::parseCPUList("").empty() || CPUNuma::parseCPUList("5") != std::vector<int>{5}) {
+            MNN_ERROR("Parse cpu list error for single or empty list\n");
+            return false;
+        }
+        return true;
+    }
+    bool testAllocator() {
+        auto numa = CPUNuma::get();
+        auto nodes = numa->nodes();
+        // Both the allocator of a real node and the fallback one
+        std::vector<int> testNodes = {-1};
+        if (!nodes.empty()) {
+            testNodes.emplace_back(nodes[0]);
+        }
+        for (auto node : testNodes) {
+            BufferAllocator allocator(numa->createAllocator(node));
+            for (int size : {256, 4 * 1024 * 1024}) {
+                auto ptr = allocator.alloc(size, true);
+                if (nullptr == ptr.first) {
+                    MNN_ERROR("Numa allocator of node %d failed for size %d\n", node, size);
+                    return false;
+                }
+                auto host = (uint8_t*)ptr.first + ptr.second;
+                if (0 != ((size_t)host % MNN_MEMORY_ALIGN_DEFAULT)) {
+                    MNN_ERROR("Numa allocator of node %d isn't aligned\n", node);
+                    return false;
+                }
+                ::memset(host, 1, size);
+                allocator.free(ptr);
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        if (!testCPUList() || !testAllocator()) {
+            return false;
+        }
+        const int channel = 8;
+        auto x = _Convert(_Input({1, channel, 32, 32}, NCHW), NC4HW4);
+        x      = _Conv(makeSinTestData(channel * channel * 9, 0.3f), makeSinTestData(channel, 0.7f), x,
+                       {channel, channel}, {3, 3}, SAME);
+        x      = _Conv(makeSinTestData(channel * channel, 0.2f), makeSinTestData(channel, 0.5f), x,
+                       {channel, channel}, {1, 1});
+        auto y = _Convert(x, NCHW);
+        auto model = saveTestModel({y});
+        std::shared_ptr<Interpreter> interp(Interpreter::createFromBuffer(model.data(), model.size()));
+        auto expect = _runSession(interp.get(), BackendConfig::Numa_None, 0);
+        auto nodes  = CPUNuma::get()->nodes();
+        // Invalid node falls back to not bind
+        nodes.emplace_back(1 << 20);
+        for (auto node : nodes) {
+            for (auto mode : {BackendConfig::Numa_Bind, BackendConfig::Numa_Replicate}) {
+                auto result = _runSession(interp.get(), mode, node);
+                if (result.size() != expect.size()) {
+                    MNN_ERROR("Numa output size error for node %d\n", node);
+                    return false;
+                }
+                for (int i = 0; i < expect.size(); ++i) {
+                    if (fabsf(result[i] - expect[i]) > 1e-5f) {
+                        MNN_ERROR("Numa result error for node %d at %d: %f - %f\n", node, i, result[i], expect[i]);
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(NumaTest, "core/numa");
@@ -0,0 +1,66 @@
+//
+//  ParallelExecuteTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+// The same model executed serially and in parallel by two interpreters
+class ParallelExecuteTest : public MNNTestCase {
+public:
+    virtual ~ParallelExecuteTest() = default;
+    virtual bool run() {
+        // Independent branches of an inception block, the scratch buffers of convolutions must not be shared
+        const int channel = 8;
+        auto x = _Convert(_Input({1, channel, 16, 16}, NCHW), NC4HW4);
+        VARPS branches;
+        for (int i = 0; i < 4; ++i) {
+            int kernel = 2 * (i % 2) + 1;
+            auto y = _Conv(makeSinTestData(channel * channel * kernel * kernel, 0.1f * (i + 1)),
+                           makeSinTestData(channel, 0.3f * (i + 1)), x, {channel, channel}, {kernel, kernel}, SAME);
+            y      = _Conv(makeSinTestData(channel * channel * 9, 0.2f * (i + 1)),
+                           makeSinTestData(channel, 0.4f * (i + 1)), _Relu(y), {channel, channel}, {3, 3}, SAME);
+            branches.emplace_back(_Sigmoid(_Convert(y, NCHW)));
+        }
+        auto output = _Concat(branches, 1);
+        auto model  = saveTestModel({output});
+
+        ScheduleConfig config;
+        config.numThread = 4;
+        std::shared_ptr<Interpreter> serialNet(Interpreter::createFromBuffer(model.data(), model.size()));
+        serialNet->setSessionMode(Interpreter::Session_Execute_Serial);
+        auto serial = serialNet->createSession(config);
+        std::shared_ptr<Interpreter> parallelNet(Interpreter::createFromBuffer(model.data(), model.size()));
+        parallelNet->setSessionMode(Interpreter::Session_Execute_Parallel);
+        auto parallel = parallelNet->createSession(config);
+
+        // Run several times to catch the race of the branches
+        for (int t = 0; t < 5; ++t) {
+            auto scale  = 0.1f * (t + 1);
+            auto expect = runTestSession(serialNet.get(), serial, scale);
+            auto result = runTestSession(parallelNet.get(), parallel, scale);
+            if (expect.size() != result.size()) {
+                MNN_ERROR("Parallel execute output size error\n");
+                return false;
+            }
+            for (int i = 0; i < expect.size(); ++i) {
+                if (fabsf(expect[i] - result[i]) > 1e-5f) {
+                    MNN_ERROR("Parallel execute result error at %d: %f - %f\n", i, result[i], expect[i]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(ParallelExecuteTest, "core/parallel_execute");
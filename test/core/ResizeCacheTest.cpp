@@ -0,0 +1,71 @@
+//
+//  ResizeCacheTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+static std::vector<float> _resizeAndRun(Interpreter* net, Session* session, int size) {
+    auto input = net->getSessionInput(session, nullptr);
+    net->resizeTensor(input, {1, 8, size, size});
+    net->resizeSession(session);
+    return runTestSession(net, session);
+}
+
+class ResizeCacheTest : public MNNTestCase {
+public:
+    virtual ~ResizeCacheTest() = default;
+    virtual bool run() {
+        const int channel = 8;
+        auto x = _Convert(_Input({1, channel, 12, 12}, NCHW), NC4HW4);
+        x      = _Conv(makeSinTestData(channel * channel * 9, 0.3f), makeSinTestData(channel, 0.7f), x,
+                       {channel, channel}, {3, 3}, SAME);
+        x      = _Conv(makeSinTestData(channel * channel, 0.2f), makeSinTestData(channel, 0.5f), x,
+                       {channel, channel}, {1, 1});
+        auto y = _Softmax(_Convert(x, NCHW), 1);
+        auto model = saveTestModel({y});
+        std::shared_ptr<Interpreter> interp(Interpreter::createFromBuffer(model.data(), model.size()));
+        ScheduleConfig config;
+        config.numThread = 1;
+        auto reference   = interp->createSession(config);
+        interp->setSessionHint(Interpreter::RESIZE_CACHE_NUMBER, 2);
+        auto session = interp->createSession(config);
+
+        // 12 is resized when create session, cache capacity is 2, so 20 evicts 16 and then 16 evicts 12
+        const int sizes[]  = {12, 16, 12, 20, 16, 20};
+        const int hits[]   = {0, 0, 1, 1, 1, 2};
+        const int misses[] = {1, 2, 2, 3, 4, 4};
+        for (int i = 0; i < sizeof(sizes) / sizeof(int); ++i) {
+            auto expect = _resizeAndRun(interp.get(), reference, sizes[i]);
+            auto result = _resizeAndRun(interp.get(), session, sizes[i]);
+            int count[2];
+            interp->getSessionInfo(session, Interpreter::RESIZE_CACHE, count);
+            if (count[0] != hits[i] || count[1] != misses[i]) {
+                MNN_ERROR("Resize cache count error at %d: hit %d miss %d\n", i, count[0], count[1]);
+                return false;
+            }
+            if (expect.size() != result.size()) {
+                MNN_ERROR("Resize cache output size error at %d\n", i);
+                return false;
+            }
+            for (int j = 0; j < expect.size(); ++j) {
+                if (fabsf(expect[j] - result[j]) > 1e-5f) {
+                    MNN_ERROR("Resize cache result error at %d: %f - %f\n", i, result[j], expect[j]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(ResizeCacheTest, "core/resize_cache");
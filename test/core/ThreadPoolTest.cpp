@@ -7,6 +7,8 @@
 //
 
 #ifdef MNN_USE_THREAD_POOL
+#include <atomic>
+#include <thread>
 #include <MNN/MNNDefine.h>
 #include "MNNTestSuite.h"
 #include "backend/cpu/ThreadPool.hpp"
@@ -43,4 +45,103 @@ public:
 };
 
 MNNTestSuiteRegister(ThreadPoolTest, "core/threadpool");
+
+class ThreadPoolConcurrentTest : public MNNTestCase {
+public:
+    virtual ~ThreadPoolConcurrentTest() = default;
+    virtual bool run() {
+        // More sessions than threads, none of them should fall back to single thread
+        const int sessionNumber = 6;
+        const int workSize      = 37;
+        MNN::ThreadPool::init(4);
+        std::vector<std::vector<std::atomic_int>> counts(sessionNumber);
+        std::vector<std::thread> threads;
+        std::atomic_bool success = {true};
+        for (int i = 0; i < sessionNumber; ++i) {
+            counts[i] = std::vector<std::atomic_int>(workSize);
+            threads.emplace_back([i, workSize, &counts, &success]() {
+                auto workIndex = ThreadPool::acquireWorkIndex();
+                if (workIndex < 0) {
+                    MNN_ERROR("Session %d can't acquire work index\n", i);
+                    success = false;
+                    return;
+                }
+                ThreadPool::active();
+                for (int loop = 0; loop < 100; ++loop) {
+                    auto& count = counts[i];
+                    // Uneven task, the larger index runs longer
+                    auto func = [&count](int index) {
+                        volatile float sum = 0.0f;
+                        for (int k = 0; k < index * 100; ++k) {
+                            sum = sum + (float)k;
+                        }
+                        count[index]++;
+                    };
+                    ThreadPool::enqueue(std::make_pair(std::move(func), workSize), workIndex);
+                }
+                ThreadPool::deactive();
+                ThreadPool::releaseWorkIndex(workIndex);
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        MNN::ThreadPool::destroy();
+        for (int i = 0; i < sessionNumber; ++i) {
+            for (int j = 0; j < workSize; ++j) {
+                if (counts[i][j] != 100) {
+                    MNN_ERROR("Session %d runs index %d for %d times\n", i, j, (int)counts[i][j]);
+                    return false;
+                }
+            }
+        }
+        return success;
+    }
+};
+
+MNNTestSuiteRegister(ThreadPoolConcurrentTest, "core/threadpool_concurrent");
+
+class ThreadPoolNumaTest : public MNNTestCase {
+public:
+    virtual ~ThreadPoolNumaTest() = default;
+    static bool _run(int node) {
+        const int workSize = 23;
+        std::vector<std::atomic_int> count(workSize);
+        auto workIndex = ThreadPool::acquireWorkIndex();
+        ThreadPool::active(node);
+        for (int loop = 0; loop < 10; ++loop) {
+            auto func = [&count](int index) { count[index]++; };
+            ThreadPool::enqueue(std::make_pair(std::move(func), workSize), workIndex, node);
+        }
+        ThreadPool::deactive(node);
+        ThreadPool::releaseWorkIndex(workIndex);
+        for (int j = 0; j < workSize; ++j) {
+            if (count[j] != 10) {
+                MNN_ERROR("Node %d runs index %d for %d times\n", node, j, (int)count[j]);
+                return false;
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        // The pool of node is referenced by each runtime bound to it, and the shared pool is used after the last
+        MNN::ThreadPool::init(4);
+        auto number = ThreadPool::initNuma(0, 3);
+        if (3 != number || 3 != ThreadPool::initNuma(0, 4)) {
+            MNN_ERROR("Pool of node 0 should have 3 threads\n");
+            return false;
+        }
+        bool success = _run(0);
+        ThreadPool::releaseNuma(0);
+        success = success && _run(0);
+        ThreadPool::releaseNuma(0);
+        // Released too many times has no effect
+        ThreadPool::releaseNuma(0);
+        success = success && _run(0) && _run(-1);
+        MNN::ThreadPool::destroy();
+        return success;
+    }
+};
+
+MNNTestSuiteRegister(ThreadPoolNumaTest, "core/threadpool_numa");
 #endif
@@ -0,0 +1,112 @@
+//
+//  WeightCacheTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <MNN/Interpreter.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+// The same structure and op names for any scale, only the weights differ
+static std::vector<uint8_t> _buildModel(float scale) {
+    const int channel = 8;
+    auto x = _Convert(_Input({1, channel, 32, 32}, NCHW), NC4HW4);
+    // Winograd
+    x = _Conv(makeSinTestData(channel * channel * 9, 0.3f * scale), makeSinTestData(channel, 0.7f * scale), x,
+              {channel, channel}, {3, 3}, SAME);
+    // Strassen
+    x = _Conv(makeSinTestData(channel * channel, 0.2f * scale), makeSinTestData(channel, 0.5f * scale), x,
+              {channel, channel}, {1, 1});
+    // Tiled
+    x = _Conv(makeSinTestData(channel * channel * 9, 0.4f * scale), makeSinTestData(channel, 0.3f * scale), x,
+              {channel, channel}, {3, 3}, SAME, {2, 2});
+    // Group
+    x = _Conv(makeSinTestData(channel * channel / 2 * 9, 0.6f * scale), makeSinTestData(channel, 0.1f * scale), x,
+              {channel, channel}, {3, 3}, SAME, {1, 1}, {1, 1}, 2);
+    return saveTestModel({_Convert(x, NCHW)});
+}
+
+// Two 1x1 convolutions of the same shape and name, only the weights differ
+static std::vector<uint8_t> _buildSameNameModel() {
+    const int channel = 8;
+    auto x = _Convert(_Input({1, channel, 32, 32}, NCHW), NC4HW4);
+    x      = _Conv(makeSinTestData(channel * channel, 0.2f), makeSinTestData(channel, 0.5f), x,
+                   {channel, channel}, {1, 1});
+    x      = _Conv(makeSinTestData(channel * channel, 0.9f), makeSinTestData(channel, 0.4f), x,
+                   {channel, channel}, {1, 1});
+    auto y = _Convert(x, NCHW);
+    std::unique_ptr<NetT> net(new NetT);
+    Variable::save({y}, net.get());
+    for (auto& op : net->oplists) {
+        if (op->type == OpType_Convolution) {
+            op->name = "conv";
+        }
+    }
+    return packTestModel(net.get());
+}
+
+static std::vector<float> _run(const std::vector<uint8_t>& model, const char* cacheFile) {
+    std::shared_ptr<Interpreter> net(Interpreter::createFromBuffer(model.data(), model.size()));
+    if (nullptr != cacheFile) {
+        // No key, so that any model can load the cache
+        net->setCacheFile(cacheFile, 0);
+    }
+    ScheduleConfig config;
+    config.numThread = 1;
+    return runTestSession(net.get(), net->createSession(config));
+}
+
+static bool _compare(const std::vector<float>& result, const std::vector<float>& expect, const char* name) {
+    if (result.size() != expect.size()) {
+        MNN_ERROR("Weight cache %s output size error\n", name);
+        return false;
+    }
+    for (int i = 0; i < expect.size(); ++i) {
+        if (fabsf(result[i] - expect[i]) > 1e-4f) {
+            MNN_ERROR("Weight cache %s result error at %d: %f - %f\n", name, i, result[i], expect[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+class WeightCacheTest : public MNNTestCase {
+public:
+    virtual ~WeightCacheTest() = default;
+    virtual bool run() {
+        const char* cacheFile = "WeightCacheTest.cache";
+        remove(cacheFile);
+        auto modelA  = _buildModel(1.0f);
+        auto modelB  = _buildModel(1.5f);
+        auto expectA = _run(modelA, nullptr);
+        auto expectB = _run(modelB, nullptr);
+        if (expectA.size() == expectB.size() &&
+            0 == ::memcmp(expectA.data(), expectB.data(), expectA.size() * sizeof(float))) {
+            MNN_ERROR("Weight cache test models should have different output\n");
+            return false;
+        }
+        // Write the cache and then load it
+        bool res = _compare(_run(modelA, cacheFile), expectA, "save") &&
+                   _compare(_run(modelA, cacheFile), expectA, "load");
+        // Model B has the same op names but other weights, it must not use the packed weights of A
+        res = res && _compare(_run(modelB, cacheFile), expectB, "other weights");
+        remove(cacheFile);
+        // The ops of the same name must not share the packed weights
+        auto modelC  = _buildSameNameModel();
+        auto expectC = _run(modelC, nullptr);
+        res = res && _compare(_run(modelC, cacheFile), expectC, "same name save") &&
+              _compare(_run(modelC, cacheFile), expectC, "same name load");
+        remove(cacheFile);
+        return res;
+    }
+};
+MNNTestSuiteRegister(WeightCacheTest, "core/weight_cache");
@@ -6,6 +6,7 @@
 //  Copyright © 2018, Alibaba Group Holding Limited
 //
 
+#include <algorithm>
 #include <MNN/expr/Expr.hpp>
 #include <MNN/expr/ExprCreator.hpp>
 #include "MNNTestSuite.h"
@@ -71,6 +72,40 @@ public:
             MNN_ERROR("ArgMaxTest test axis_1_outVal failed!\n");
             return false;
         }
+        return testLarge();
+    }
+    // Large vocabulary with ties, reduced along the last axis and the first axis
+    bool testLarge() {
+        const int rows = 3, vocab = 50000;
+        std::vector<float> data(rows * vocab);
+        for (int i = 0; i < data.size(); ++i) {
+            data[i] = (float)((i * 7919) % 3001);
+        }
+        auto input = _Const(data.data(), {rows, vocab}, NHWC);
+        auto last     = _ArgMax(input, 1);
+        auto first    = _ArgMin(input, 0);
+        auto lastPtr  = last->readMap<int>();
+        auto firstPtr = first->readMap<int>();
+        for (int r = 0; r < rows; ++r) {
+            auto row = data.data() + r * vocab;
+            int expect = (int)(std::max_element(row, row + vocab) - row);
+            if (lastPtr[r] != expect) {
+                MNN_ERROR("ArgMaxTest test large vocab failed at %d: %d - %d\n", r, lastPtr[r], expect);
+                return false;
+            }
+        }
+        for (int k = 0; k < vocab; ++k) {
+            int expect = 0;
+            for (int r = 1; r < rows; ++r) {
+                if (data[r * vocab + k] < data[expect * vocab + k]) {
+                    expect = r;
+                }
+            }
+            if (firstPtr[k] != expect) {
+                MNN_ERROR("ArgMinTest test large axis_0 failed at %d: %d - %d\n", k, firstPtr[k], expect);
+                return false;
+            }
+        }
         return true;
     }
 };
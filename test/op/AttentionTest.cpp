@@ -0,0 +1,122 @@
+//
+//  AttentionTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+
+static VARP _makeInput(const std::vector<int>& shape, float scale, float offset) {
+    auto var  = _Input(shape, NCHW);
+    auto size = var->getInfo()->size;
+    auto ptr  = var->writeMap<float>();
+    for (int i = 0; i < size; ++i) {
+        ptr[i] = sinf(i * scale + offset);
+    }
+    return var;
+}
+
+class AttentionTest : public MNNTestCase {
+public:
+    virtual ~AttentionTest() = default;
+    // maskShape is empty if no mask
+    bool testShape(int batch, int head, int seqQ, int seqK, int depth, int depthV, std::vector<int> maskShape) {
+        auto query = _makeInput({batch, head, seqQ, depth}, 0.37f, 0.0f);
+        auto key   = _makeInput({batch, head, seqK, depth}, 0.23f, 1.0f);
+        auto value = _makeInput({batch, head, seqK, depthV}, 0.11f, 2.0f);
+        VARP mask;
+        if (!maskShape.empty()) {
+            mask      = _makeInput(maskShape, 0.7f, 3.0f);
+            auto size = mask->getInfo()->size;
+            auto ptr  = mask->writeMap<float>();
+            // Masked keys like the paddings of sentences
+            for (int i = 0; i < size; ++i) {
+                ptr[i] = (i % 7 == 3) ? -10000.0f : ptr[i];
+            }
+        }
+        const float scale = 1.0f / sqrtf((float)depth);
+        auto output       = _Attention(query, key, value, mask);
+        auto outputPtr    = output->readMap<float>();
+        if (nullptr == outputPtr) {
+            MNN_ERROR("AttentionTest compute failed\n");
+            return false;
+        }
+        auto q = query->readMap<float>();
+        auto k = key->readMap<float>();
+        auto v = value->readMap<float>();
+        const float* m = nullptr != mask ? mask->readMap<float>() : nullptr;
+        // Strides of mask broadcast to [batch, head, seqQ, seqK]
+        std::vector<int> maskStride(4, 0);
+        if (nullptr != m) {
+            int stride = 1;
+            for (int i = (int)maskShape.size() - 1; i >= 0; --i) {
+                maskStride[4 - maskShape.size() + i] = maskShape[i] == 1 ? 0 : stride;
+                stride *= maskShape[i];
+            }
+        }
+        std::vector<float> expect(batch * head * seqQ * depthV);
+        std::vector<double> scores(seqK);
+        for (int b = 0; b < batch; ++b) {
+            for (int h = 0; h < head; ++h) {
+                auto bh = b * head + h;
+                for (int y = 0; y < seqQ; ++y) {
+                    double maxValue = -1e30;
+                    for (int x = 0; x < seqK; ++x) {
+                        double sum = 0.0;
+                        for (int d = 0; d < depth; ++d) {
+                            sum += q[(bh * seqQ + y) * depth + d] * k[(bh * seqK + x) * depth + d];
+                        }
+                        sum *= scale;
+                        if (nullptr != m) {
+                            sum += m[b * maskStride[0] + h * maskStride[1] + y * maskStride[2] + x * maskStride[3]];
+                        }
+                        scores[x] = sum;
+                        maxValue  = std::max(maxValue, sum);
+                    }
+                    double total = 0.0;
+                    for (int x = 0; x < seqK; ++x) {
+                        scores[x] = exp(scores[x] - maxValue);
+                        total += scores[x];
+                    }
+                    for (int d = 0; d < depthV; ++d) {
+                        double sum = 0.0;
+                        for (int x = 0; x < seqK; ++x) {
+                            sum += scores[x] * v[(bh * seqK + x) * depthV + d];
+                        }
+                        expect[(bh * seqQ + y) * depthV + d] = (float)(sum / total);
+                    }
+                }
+            }
+        }
+        if (!checkVector<float>(outputPtr, expect.data(), (int)expect.size(), 0.002f)) {
+            MNN_ERROR("AttentionTest failed for seqQ %d, seqK %d, depth %d, depthV %d, mask rank %d\n", seqQ, seqK,
+                      depth, depthV, (int)maskShape.size());
+            return false;
+        }
+        return true;
+    }
+    virtual bool run() {
+        // Tails of query tiles, key blocks and C4
+        if (!testShape(1, 2, 37, 150, 20, 13, {})) {
+            return false;
+        }
+        if (!testShape(2, 3, 5, 9, 8, 8, {9})) {
+            return false;
+        }
+        if (!testShape(2, 3, 30, 300, 16, 17, {2, 1, 1, 300})) {
+            return false;
+        }
+        if (!testShape(2, 2, 17, 64, 64, 64, {2, 2, 17, 64})) {
+            return false;
+        }
+        return testShape(1, 4, 50, 50, 12, 12, {50, 50});
+    }
+};
+MNNTestSuiteRegister(AttentionTest, "op/attention");
@@ -136,5 +136,73 @@ public:
         return true;
     }
 };
+class ConvInt8DepthwiseTest : public MNNTestCase {
+public:
+    static bool testKernel(INTS inputShape, INTS kernel, int channel, INTS pad, INTS strides, INTS dilate) {
+        int iw = inputShape[0], ih = inputShape[1], kw = kernel[0], kh = kernel[1];
+        std::vector<int> bias(channel);
+        std::vector<float> scale(channel);
+        std::vector<int8_t> weight(channel * kw * kh);
+        VARP x     = _Input({1, channel, ih, iw}, NC4HW4, halide_type_of<int8_t>());
+        auto xInfo = x->getInfo();
+        auto xPtr  = x->writeMap<int8_t>();
+        for (int i = 0; i < xInfo->size; ++i) {
+            xPtr[i] = (i * 7 % 256) - 128;
+        }
+        for (int i = 0; i < channel; ++i) {
+            bias[i]  = (i * 997) % 5000 - 2500;
+            scale[i] = (1 + i % 7) / (200.0f * kw * kh);
+            for (int k = 0; k < kw * kh; ++k) {
+                weight[i * kw * kh + k] = ((i * 31 + k * k * 13) % 256) - 128;
+            }
+        }
+        auto y    = _Conv(std::vector<int8_t>(weight), std::vector<int>(bias), std::vector<float>(scale), x,
+                          {channel, channel}, kernel, PaddingMode::CAFFE, strides, dilate, channel, pad, false, 8);
+        auto yPtr = y->readMap<int8_t>();
+        if (nullptr == yPtr) {
+            MNN_ERROR("ConvInt8 depthwise compute failed\n");
+            return false;
+        }
+        auto ow = y->getInfo()->dim[3], oh = y->getInfo()->dim[2];
+        for (int z = 0; z < channel; ++z) {
+            for (int oy = 0; oy < oh; ++oy) {
+                for (int ox = 0; ox < ow; ++ox) {
+                    int32_t sum = 0;
+                    for (int ky = 0; ky < kh; ++ky) {
+                        for (int kx = 0; kx < kw; ++kx) {
+                            int ix = ox * strides[0] + kx * dilate[0] - pad[0];
+                            int iy = oy * strides[1] + ky * dilate[1] - pad[1];
+                            if (ix >= 0 && ix < iw && iy >= 0 && iy < ih) {
+                                sum += xPtr[(((z / 4) * ih + iy) * iw + ix) * 4 + z % 4] * weight[(z * kh + ky) * kw + kx];
+                            }
+                        }
+                    }
+                    int8_t target = int32ToInt8(sum, bias[z], scale[z]);
+                    int8_t result = yPtr[(((z / 4) * oh + oy) * ow + ox) * 4 + z % 4];
+                    if (target != result) {
+                        MNN_PRINT("ConvInt8 depthwise %dx%d result Error at %d, %d, %d: %d -> %d\n", kw, kh, z, oy, ox,
+                                  target, result);
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        // 9x9 has more taps than the VNNI line kernel keeps
+        std::vector<std::vector<int>> kernels = {{3, 3}, {5, 5}, {7, 7}, {1, 5}, {9, 9}};
+        for (auto& kernel : kernels) {
+            if (!testKernel({37, 29}, kernel, 13, {kernel[0] / 2, kernel[1] / 2}, {1, 1}, {1, 1}) ||
+                !testKernel({37, 29}, kernel, 8, {1, 2}, {2, 2}, {1, 1}) ||
+                !testKernel({37, 29}, kernel, 6, {kernel[0] - 1, kernel[1] - 1}, {1, 2}, {2, 2})) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
 MNNTestSuiteRegister(ConvInt8Im2colGemmTest, "op/ConvInt8/im2col_gemm");
 MNNTestSuiteRegister(ConvInt8WinogradTest, "op/ConvInt8/winograd");
+MNNTestSuiteRegister(ConvInt8DepthwiseTest, "op/ConvInt8/depthwise");
@@ -0,0 +1,90 @@
+//
+//  ConvolutionBF16Test.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Executor.hpp>
+#include <MNN/expr/ExecutorScope.hpp>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+// Convolution with the GEMM in bfloat16 by BackendConfig::bf16Convolution, checked against fp32 (the same as fp32
+// where the machine has no BF16 kernels)
+class ConvolutionBF16Test : public MNNTestCase {
+public:
+    virtual ~ConvolutionBF16Test() = default;
+    static bool test(int batch, int ic, int oc, int ih, int iw, int kernel, int stride, int pad, int dilate,
+                     bool relu6) {
+        auto weight = makeTestData(oc * ic * kernel * kernel, 1);
+        auto bias   = makeTestData(oc, 2);
+        auto data   = makeTestData(batch * ic * ih * iw, 3);
+        int oh      = (ih + 2 * pad - dilate * (kernel - 1) - 1) / stride + 1;
+        int ow      = (iw + 2 * pad - dilate * (kernel - 1) - 1) / stride + 1;
+        std::vector<float> expect(batch * oc * oh * ow);
+        float maxValue = 0.0f;
+        for (int b = 0; b < batch; ++b) {
+            for (int o = 0; o < oc; ++o) {
+                for (int y = 0; y < oh; ++y) {
+                    for (int x = 0; x < ow; ++x) {
+                        float sum = bias[o];
+                        for (int i = 0; i < ic; ++i) {
+                            for (int ky = 0; ky < kernel; ++ky) {
+                                for (int kx = 0; kx < kernel; ++kx) {
+                                    int sy = y * stride - pad + ky * dilate;
+                                    int sx = x * stride - pad + kx * dilate;
+                                    if (sy < 0 || sy >= ih || sx < 0 || sx >= iw) {
+                                        continue;
+                                    }
+                                    sum += weight[((o * ic + i) * kernel + ky) * kernel + kx] *
+                                           data[((b * ic + i) * ih + sy) * iw + sx];
+                                }
+                            }
+                        }
+                        if (relu6) {
+                            sum = std::min(std::max(sum, 0.0f), 6.0f);
+                        }
+                        expect[((b * oc + o) * oh + y) * ow + x] = sum;
+                        maxValue                                 = std::max(maxValue, fabsf(sum));
+                    }
+                }
+            }
+        }
+        auto input = _Input({batch, ic, ih, iw}, NCHW);
+        ::memcpy(input->writeMap<float>(), data.data(), data.size() * sizeof(float));
+        auto output = _Convert(_Conv(std::move(weight), std::move(bias), _Convert(input, NC4HW4), {ic, oc},
+                                     {kernel, kernel}, CAFFE, {stride, stride}, {dilate, dilate}, 1, {pad, pad},
+                                     false, relu6),
+                               NCHW);
+        auto ptr = output->readMap<float>();
+        if (nullptr == ptr || output->getInfo()->size != expect.size()) {
+            MNN_ERROR("BF16 convolution %d, %d -> %d, kernel %d compute failed\n", batch, ic, oc, kernel);
+            return false;
+        }
+        // The 8 bits mantissa of both the input and the weight
+        for (int i = 0; i < expect.size(); ++i) {
+            if (fabsf(expect[i] - ptr[i]) > 0.01f * maxValue) {
+                MNN_ERROR("BF16 convolution %d, %d -> %d, kernel %d, stride %d error at %d: %f - %f\n", batch, ic, oc,
+                          kernel, stride, i, ptr[i], expect[i]);
+                return false;
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        BackendConfig config;
+        config.bf16Convolution = true;
+        ExecutorScope scope(Executor::newExecutor(MNN_FORWARD_CPU, config, 2));
+        return test(1, 64, 40, 14, 14, 1, 1, 0, 1, false) && test(2, 13, 7, 9, 11, 1, 2, 0, 1, true) &&
+               test(1, 17, 33, 20, 19, 3, 1, 1, 1, false) && test(1, 8, 16, 15, 15, 3, 2, 1, 1, true) &&
+               test(1, 5, 9, 13, 13, 3, 1, 2, 2, false) && test(1, 3, 24, 31, 29, 7, 2, 3, 1, false);
+    }
+};
+MNNTestSuiteRegister(ConvolutionBF16Test, "op/convolution/bf16");
@@ -0,0 +1,96 @@
+//
+//  ConvolutionWeightInt8Test.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+// 1x1 convolution with the weight-only int8 quantization (IDSTQuan of type 4)
+class ConvolutionWeightInt8Test : public MNNTestCase {
+public:
+    virtual ~ConvolutionWeightInt8Test() = default;
+    static bool test(int batch, int ic, int oc, int height, int width, bool relu, bool relu6) {
+        std::vector<int8_t> quanWeight(oc * ic);
+        std::vector<float> minAndScale(2 * oc), weight(oc * ic), bias(oc);
+        for (int o = 0; o < oc; ++o) {
+            minAndScale[2 * o]     = -0.5f - (o % 7) * 0.05f;
+            minAndScale[2 * o + 1] = (1.0f + (o % 5) * 0.1f) / 255.0f;
+            bias[o]                = (o % 11) * 0.1f - 0.5f;
+            for (int i = 0; i < ic; ++i) {
+                auto q                = (int8_t)(((o * 131 + i * 71) % 256) - 128);
+                quanWeight[o * ic + i] = q;
+                weight[o * ic + i]     = ((float)q + 128.0f) * minAndScale[2 * o + 1] + minAndScale[2 * o];
+            }
+        }
+        std::unique_ptr<OpT> op(new OpT);
+        op->type       = OpType_Convolution;
+        op->main.type  = OpParameter_Convolution2D;
+        op->main.value = new Convolution2DT;
+        auto conv      = op->main.AsConvolution2D();
+        conv->common.reset(new Convolution2DCommonT);
+        conv->common->inputCount  = ic;
+        conv->common->outputCount = oc;
+        conv->common->relu        = relu;
+        conv->common->relu6       = relu6;
+        conv->bias                = bias;
+        conv->quanParameter.reset(new IDSTQuanT);
+        conv->quanParameter->type   = 4;
+        conv->quanParameter->aMax   = oc;
+        conv->quanParameter->buffer = quanWeight;
+        conv->quanParameter->alpha  = minAndScale;
+
+        const int plane = height * width;
+        std::vector<float> inputData(batch * ic * plane);
+        for (int i = 0; i < inputData.size(); ++i) {
+            inputData[i] = (float)((i * 37) % 101) / 101.0f - 0.5f;
+        }
+        auto input = _Input({batch, ic, height, width}, NCHW);
+        ::memcpy(input->writeMap<float>(), inputData.data(), inputData.size() * sizeof(float));
+        auto output = _Convert(Variable::create(Expr::create(op.get(), {_Convert(input, NC4HW4)})), NCHW);
+        auto ptr    = output->readMap<float>();
+        if (nullptr == ptr) {
+            MNN_ERROR("Weight int8 convolution compute failed\n");
+            return false;
+        }
+        for (int b = 0; b < batch; ++b) {
+            for (int o = 0; o < oc; ++o) {
+                for (int p = 0; p < plane; ++p) {
+                    float sum = bias[o];
+                    for (int i = 0; i < ic; ++i) {
+                        sum += weight[o * ic + i] * inputData[(b * ic + i) * plane + p];
+                    }
+                    if (relu || relu6) {
+                        sum = std::max(sum, 0.0f);
+                    }
+                    if (relu6) {
+                        sum = std::min(sum, 6.0f);
+                    }
+                    auto value = ptr[(b * oc + o) * plane + p];
+                    if (fabsf(value - sum) > 1e-3f * std::max(1.0f, fabsf(sum))) {
+                        MNN_ERROR("Weight int8 convolution %d, %d -> %d error at %d, %d, %d: %f - %f\n", batch, ic, oc,
+                                  b, o, p, value, sum);
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        // Tiles of one channel block, of several and the InnerProduct of plane 1
+        return test(2, 37, 45, 7, 9, false, false) && test(1, 256, 131, 5, 5, true, false) &&
+               test(1, 64, 1000, 3, 4, false, true) && test(3, 2048, 100, 1, 1, false, false) &&
+               test(1, 5, 3, 17, 3, true, false);
+    }
+};
+MNNTestSuiteRegister(ConvolutionWeightInt8Test, "op/convolution/weight_int8");
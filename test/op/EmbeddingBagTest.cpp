@@ -0,0 +1,91 @@
+//
+//  EmbeddingBagTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+
+static VARP _makeWeight(int rows, int width) {
+    auto var = _Input({rows, width}, NCHW);
+    auto ptr = var->writeMap<float>();
+    for (int i = 0; i < rows * width; ++i) {
+        ptr[i] = sinf(i * 0.37f);
+    }
+    return var;
+}
+
+class EmbeddingBagTest : public MNNTestCase {
+public:
+    virtual ~EmbeddingBagTest() = default;
+    // bag b is indices[begins[b], begins[b + 1])
+    bool check(VARP output, const float* weight, int width, const std::vector<int>& indices,
+               const std::vector<int>& begins, bool mean, const char* name) {
+        auto outputPtr = output->readMap<float>();
+        int bags       = (int)begins.size() - 1;
+        if (nullptr == outputPtr || output->getInfo()->size != bags * width) {
+            MNN_ERROR("EmbeddingBagTest %s compute failed\n", name);
+            return false;
+        }
+        for (int b = 0; b < bags; ++b) {
+            for (int x = 0; x < width; ++x) {
+                float expect = 0.0f;
+                for (int j = begins[b]; j < begins[b + 1]; ++j) {
+                    expect += weight[indices[j] * width + x];
+                }
+                if (mean && begins[b + 1] > begins[b]) {
+                    expect /= (float)(begins[b + 1] - begins[b]);
+                }
+                if (fabsf(outputPtr[b * width + x] - expect) > 1e-4f) {
+                    MNN_ERROR("EmbeddingBagTest %s error at bag %d, %d: %f - %f\n", name, b, x,
+                              outputPtr[b * width + x], expect);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    bool testShape(int rows, int width, int bags, int bagSize, bool mean) {
+        auto weight = _makeWeight(rows, width);
+        std::vector<int> indices(bags * bagSize);
+        for (int i = 0; i < indices.size(); ++i) {
+            indices[i] = (i * 7919 + 13) % rows;
+        }
+        auto weightPtr = weight->readMap<float>();
+        // Fixed bag size
+        std::vector<int> begins(bags + 1);
+        for (int b = 0; b <= bags; ++b) {
+            begins[b] = b * bagSize;
+        }
+        auto output = _EmbeddingBag(weight, _Const(indices.data(), {bags, bagSize}, NCHW, halide_type_of<int>()),
+                                    nullptr, mean);
+        if (!check(output, weightPtr, width, indices, begins, mean, "dense")) {
+            return false;
+        }
+        // Variable bag size with offsets, including empty bags
+        for (int b = 1; b < bags; ++b) {
+            begins[b] = (b % 3 == 1) ? begins[b - 1] : std::min(begins[b - 1] + (b % 5) * bagSize / 2, bags * bagSize);
+        }
+        std::vector<int> offsets(begins.begin(), begins.end() - 1);
+        output = _EmbeddingBag(weight, _Const(indices.data(), {bags * bagSize}, NCHW, halide_type_of<int>()),
+                               _Const(offsets.data(), {bags}, NCHW, halide_type_of<int>()), mean);
+        return check(output, weightPtr, width, indices, begins, mean, "offsets");
+    }
+    virtual bool run() {
+        for (auto mean : {false, true}) {
+            // Short rows of the Vec4 path, odd width and rows wider than a pooled block
+            if (!testShape(100, 16, 9, 5, mean) || !testShape(37, 7, 4, 3, mean) || !testShape(5, 2051, 3, 4, mean)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(EmbeddingBagTest, "op/embedding_bag");
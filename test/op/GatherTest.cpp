@@ -31,6 +31,30 @@ public:
             MNN_ERROR("GatherNDTest test failed!\n");
             return false;
         }
+        // Many slices of the Vec4 path and odd slices
+        for (int width : {8, 5}) {
+            const int rows = 30, number = 2000;
+            auto table     = _Input({2, rows, width}, NCHW);
+            auto tablePtr  = table->writeMap<float>();
+            for (int i = 0; i < 2 * rows * width; ++i) {
+                tablePtr[i] = (float)i;
+            }
+            std::vector<int> index(number * 2);
+            for (int i = 0; i < number; ++i) {
+                index[2 * i]     = i % 2;
+                index[2 * i + 1] = (i * 7) % rows;
+            }
+            auto gather    = _GatherND(table, _Const(index.data(), {number, 2}, NCHW, halide_type_of<int>()));
+            auto gatherPtr = gather->readMap<float>();
+            for (int i = 0; i < number; ++i) {
+                for (int x = 0; x < width; ++x) {
+                    if (gatherPtr[i * width + x] != (float)((index[2 * i] * rows + index[2 * i + 1]) * width + x)) {
+                        MNN_ERROR("GatherNDTest failed for width %d at %d, %d\n", width, i, x);
+                        return false;
+                    }
+                }
+            }
+        }
         return true;
     }
 };
@@ -33,6 +33,33 @@ public:
             MNN_ERROR("GatherV2Test test failed!\n");
             return false;
         }
+        // Many short rows and odd rows on the middle axis, so that the rows are split across outsides
+        for (int width : {16, 3}) {
+            const int outside = 3, rows = 50, number = 1000;
+            auto table        = _Input({outside, rows, width}, NCHW);
+            auto tablePtr     = table->writeMap<float>();
+            for (int i = 0; i < outside * rows * width; ++i) {
+                tablePtr[i] = (float)i;
+            }
+            std::vector<int> index(number);
+            for (int i = 0; i < number; ++i) {
+                index[i] = (i * 37 + 11) % rows;
+            }
+            auto gather    = _GatherV2(table, _Const(index.data(), {number}, NCHW, halide_type_of<int>()),
+                                       _Scalar<int>(1));
+            auto gatherPtr = gather->readMap<float>();
+            for (int o = 0; o < outside; ++o) {
+                for (int i = 0; i < number; ++i) {
+                    for (int x = 0; x < width; ++x) {
+                        auto expect = (float)((o * rows + index[i]) * width + x);
+                        if (gatherPtr[(o * number + i) * width + x] != expect) {
+                            MNN_ERROR("GatherV2Test failed for width %d at %d, %d, %d\n", width, o, i, x);
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
         return true;
     }
 };
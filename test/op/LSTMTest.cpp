@@ -0,0 +1,227 @@
+//
+//  LSTMTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+#include "core/Backend.hpp"
+#include "geometry/GeometryComputerUtils.hpp"
+#include "shape/SizeComputer.hpp"
+using namespace MNN::Express;
+using namespace MNN;
+
+static std::vector<float> _makeData(int size, int seed) {
+    std::vector<float> data(size);
+    for (int i = 0; i < size; ++i) {
+        data[i] = sinf((float)(i * 5 + seed * 11)) * 0.5f;
+    }
+    return data;
+}
+
+static float _sigmoid(float x) {
+    return 1.0f / (1.0f + expf(-x));
+}
+
+// ONNX LSTM with the gates in IOFC order, the bias is the sum of Wb and Rb
+static void _referenceLSTM(const float* x, const float* w, const float* r, const float* bias, const float* h0,
+                           const float* c0, int seq, int batch, int inputSize, int hidden, int directions, float* y,
+                           float* yh, float* yc) {
+    std::vector<float> gates(4 * hidden);
+    for (int d = 0; d < directions; ++d) {
+        auto wd = w + d * 4 * hidden * inputSize;
+        auto rd = r + d * 4 * hidden * hidden;
+        auto bd = bias + d * 4 * hidden;
+        for (int b = 0; b < batch; ++b) {
+            std::vector<float> h(hidden, 0.0f), c(hidden, 0.0f);
+            if (nullptr != h0) {
+                ::memcpy(h.data(), h0 + (d * batch + b) * hidden, hidden * sizeof(float));
+                ::memcpy(c.data(), c0 + (d * batch + b) * hidden, hidden * sizeof(float));
+            }
+            for (int s = 0; s < seq; ++s) {
+                int t   = d > 0 ? seq - 1 - s : s;
+                auto xt = x + (t * batch + b) * inputSize;
+                for (int j = 0; j < 4 * hidden; ++j) {
+                    float sum = bd[j];
+                    for (int i = 0; i < inputSize; ++i) {
+                        sum += wd[j * inputSize + i] * xt[i];
+                    }
+                    for (int i = 0; i < hidden; ++i) {
+                        sum += rd[j * hidden + i] * h[i];
+                    }
+                    gates[j] = sum;
+                }
+                for (int j = 0; j < hidden; ++j) {
+                    float in     = _sigmoid(gates[j]);
+                    float out    = _sigmoid(gates[hidden + j]);
+                    float forget = _sigmoid(gates[2 * hidden + j]);
+                    float cell   = tanhf(gates[3 * hidden + j]);
+                    c[j]         = forget * c[j] + in * cell;
+                    h[j]         = out * tanhf(c[j]);
+                }
+                ::memcpy(y + ((t * directions + d) * batch + b) * hidden, h.data(), hidden * sizeof(float));
+            }
+            ::memcpy(yh + (d * batch + b) * hidden, h.data(), hidden * sizeof(float));
+            ::memcpy(yc + (d * batch + b) * hidden, c.data(), hidden * sizeof(float));
+        }
+    }
+}
+
+class LSTMTest : public MNNTestCase {
+public:
+    virtual ~LSTMTest() = default;
+    bool testLSTM(int seq, int batch, int inputSize, int hidden, int directions, bool hasInit) {
+        std::unique_ptr<OpT> op(new OpT);
+        op->type           = OpType_LSTM;
+        op->main.type      = OpParameter_LSTM;
+        auto param         = new LSTMT;
+        op->main.value     = param;
+        param->outputCount = hidden;
+        auto x    = _makeData(seq * batch * inputSize, 0);
+        auto w    = _makeData(directions * 4 * hidden * inputSize, 1);
+        auto r    = _makeData(directions * 4 * hidden * hidden, 2);
+        auto bias = _makeData(directions * 4 * hidden, 3);
+        auto h0   = _makeData(directions * batch * hidden, 4);
+        auto c0   = _makeData(directions * batch * hidden, 5);
+        std::vector<VARP> inputs = {_Const(x.data(), {seq, batch, inputSize}, NCHW),
+                                    _Const(w.data(), {directions, 4 * hidden, inputSize}, NCHW),
+                                    _Const(r.data(), {directions, 4 * hidden, hidden}, NCHW),
+                                    _Const(bias.data(), {directions, 4 * hidden}, NCHW)};
+        if (hasInit) {
+            inputs.emplace_back(_Const(h0.data(), {directions, batch, hidden}, NCHW));
+            inputs.emplace_back(_Const(c0.data(), {directions, batch, hidden}, NCHW));
+        }
+        auto expr = Expr::create(op.get(), inputs, 3);
+        std::vector<VARP> outputs;
+        for (int i = 0; i < 3; ++i) {
+            outputs.emplace_back(Variable::create(expr, i));
+        }
+        const int stateSize = directions * batch * hidden;
+        std::vector<float> y(seq * stateSize), yh(stateSize), yc(stateSize);
+        _referenceLSTM(x.data(), w.data(), r.data(), bias.data(), hasInit ? h0.data() : nullptr,
+                       hasInit ? c0.data() : nullptr, seq, batch, inputSize, hidden, directions, y.data(), yh.data(),
+                       yc.data());
+        std::vector<std::vector<float>*> expects = {&y, &yh, &yc};
+        for (int i = 0; i < 3; ++i) {
+            auto result = outputs[i]->readMap<float>();
+            if (nullptr == result) {
+                MNN_ERROR("LSTM compute failed\n");
+                return false;
+            }
+            auto& expect = *expects[i];
+            for (int j = 0; j < expect.size(); ++j) {
+                if (fabsf(result[j] - expect[j]) > 2e-3f) {
+                    MNN_ERROR("LSTM error for seq = %d, batch = %d, input = %d, hidden = %d, directions = %d, output "
+                              "%d at %d: %f - %f\n",
+                              seq, batch, inputSize, hidden, directions, i, j, result[j], expect[j]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    // The per-step lowering for the backends other than CPU, run by CPU
+    bool testLSTMSteps(int seq, int batch, int inputSize, int hidden, int directions, bool hasInit) {
+        std::unique_ptr<OpT> opT(new OpT);
+        opT->type          = OpType_LSTM;
+        opT->main.type     = OpParameter_LSTM;
+        auto param         = new LSTMT;
+        opT->main.value    = param;
+        param->outputCount = hidden;
+        flatbuffers::FlatBufferBuilder builder;
+        builder.Finish(Op::Pack(builder, opT.get()));
+        auto op = flatbuffers::GetRoot<Op>(builder.GetBufferPointer());
+
+        auto x    = _makeData(seq * batch * inputSize, 0);
+        auto w    = _makeData(directions * 4 * hidden * inputSize, 1);
+        auto r    = _makeData(directions * 4 * hidden * hidden, 2);
+        auto bias = _makeData(directions * 4 * hidden, 3);
+        auto h0   = _makeData(directions * batch * hidden, 4);
+        auto c0   = _makeData(directions * batch * hidden, 5);
+        std::vector<std::shared_ptr<Tensor>> inputs = {
+            std::shared_ptr<Tensor>(Tensor::create<float>({seq, batch, inputSize}, x.data())),
+            std::shared_ptr<Tensor>(Tensor::create<float>({directions, 4 * hidden, inputSize}, w.data())),
+            std::shared_ptr<Tensor>(Tensor::create<float>({directions, 4 * hidden, hidden}, r.data())),
+            std::shared_ptr<Tensor>(Tensor::create<float>({directions, 4 * hidden}, bias.data()))};
+        if (hasInit) {
+            inputs.emplace_back(Tensor::create<float>({directions, batch, hidden}, h0.data()));
+            inputs.emplace_back(Tensor::create<float>({directions, batch, hidden}, c0.data()));
+        }
+        std::vector<std::shared_ptr<Tensor>> outputs;
+        std::vector<Tensor*> inputPtrs, outputPtrs;
+        for (auto& t : inputs) {
+            inputPtrs.emplace_back(t.get());
+        }
+        for (int i = 0; i < 3; ++i) {
+            outputs.emplace_back(new Tensor);
+            outputPtrs.emplace_back(outputs[i].get());
+        }
+        if (!SizeComputer::computeOutputSize(op, inputPtrs, outputPtrs)) {
+            return false;
+        }
+
+        Backend::Info info;
+        info.type      = MNN_FORWARD_CPU;
+        info.numThread = 1;
+        std::shared_ptr<Runtime> runtime(MNNGetExtraRuntimeCreator(MNN_FORWARD_CPU)->onCreate(info));
+        std::shared_ptr<Backend> backend(runtime->onCreate());
+        GeometryComputer::Context context(backend, false, MNN_FORWARD_OPENCL);
+        CommandBuffer srcBuffer, buffer;
+        if (!GeometryComputer::search(OpType_LSTM)->compute(op, inputPtrs, outputPtrs, context, srcBuffer)) {
+            return false;
+        }
+        GeometryComputerUtils::makeRaster(srcBuffer, buffer, context);
+        for (auto& cmd : buffer.command) {
+            if (OpType_LSTMRecurrence == cmd.op->type()) {
+                MNN_ERROR("LSTMRecurrence is emitted for the backends other than CPU\n");
+                return false;
+            }
+            for (auto t : cmd.outputs) {
+                auto des = TensorUtils::getDescribe(t);
+                if (nullptr == des->backend) {
+                    TensorUtils::setLinearLayout(t);
+                    backend->onAcquireBuffer(t, Backend::STATIC);
+                    des->backend = backend.get();
+                }
+            }
+            std::unique_ptr<Execution> exe(backend->onCreate(cmd.inputs, cmd.outputs, cmd.op));
+            if (nullptr == exe || NO_ERROR != exe->onResize(cmd.inputs, cmd.outputs) ||
+                NO_ERROR != exe->onExecute(cmd.inputs, cmd.outputs)) {
+                MNN_ERROR("LSTM steps can't run %s\n", EnumNameOpType(cmd.op->type()));
+                return false;
+            }
+        }
+
+        const int stateSize = directions * batch * hidden;
+        std::vector<float> y(seq * stateSize), yh(stateSize), yc(stateSize);
+        _referenceLSTM(x.data(), w.data(), r.data(), bias.data(), hasInit ? h0.data() : nullptr,
+                       hasInit ? c0.data() : nullptr, seq, batch, inputSize, hidden, directions, y.data(), yh.data(),
+                       yc.data());
+        std::vector<std::vector<float>*> expects = {&y, &yh, &yc};
+        for (int i = 0; i < 3; ++i) {
+            auto result  = outputs[i]->host<float>();
+            auto& expect = *expects[i];
+            for (int j = 0; j < expect.size(); ++j) {
+                if (fabsf(result[j] - expect[j]) > 2e-3f) {
+                    MNN_ERROR("LSTM steps error for seq = %d, batch = %d, directions = %d, output %d at %d: %f - %f\n",
+                              seq, batch, directions, i, j, result[j], expect[j]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        return testLSTM(6, 1, 5, 8, 1, false) && testLSTM(5, 3, 7, 6, 1, true) && testLSTM(4, 2, 3, 9, 2, false) &&
+               testLSTM(7, 5, 10, 4, 2, true) && testLSTMSteps(5, 3, 7, 6, 1, true) &&
+               testLSTMSteps(4, 2, 3, 9, 2, false) && testLSTMSteps(7, 5, 10, 4, 2, true);
+    }
+};
+MNNTestSuiteRegister(LSTMTest, "op/rnn/lstm");
@@ -0,0 +1,90 @@
+//
+//  LayerNormTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+
+static VARP _LayerNorm(std::vector<VARP> inputs, const std::vector<float>& gamma, const std::vector<float>& beta,
+                       float epsilon) {
+    using namespace MNN;
+    std::unique_ptr<OpT> op(new OpT);
+    op->type       = OpType_LayerNorm;
+    op->main.type  = OpParameter_LayerNorm;
+    op->main.value = new LayerNormT;
+    auto param     = op->main.AsLayerNorm();
+    param->axis    = {-1};
+    param->epsilon = epsilon;
+    param->gamma   = gamma;
+    param->beta    = beta;
+    return Variable::create(Expr::create(std::move(op), inputs));
+}
+
+class LayerNormTest : public MNNTestCase {
+public:
+    virtual ~LayerNormTest() = default;
+    bool testSize(int outside, int inside, float offset) {
+        const float epsilon = 1e-5f;
+        std::vector<float> x(outside * inside), y(outside * inside), gamma(inside), beta(inside);
+        for (int i = 0; i < outside * inside; ++i) {
+            x[i] = sinf(i * 0.37f) * 2.0f + offset;
+            y[i] = cosf(i * 0.11f);
+        }
+        for (int i = 0; i < inside; ++i) {
+            gamma[i] = 1.0f + 0.1f * (i % 5);
+            beta[i]  = 0.05f * (i % 3);
+        }
+        auto input = _Input({outside, inside}, NHWC);
+        ::memcpy(input->writeMap<float>(), x.data(), x.size() * sizeof(float));
+        auto residual = _Input({outside, inside}, NHWC);
+        ::memcpy(residual->writeMap<float>(), y.data(), y.size() * sizeof(float));
+        for (bool fuse : {false, true}) {
+            std::vector<float> expect(outside * inside);
+            for (int o = 0; o < outside; ++o) {
+                double sum = 0.0, square = 0.0;
+                for (int i = 0; i < inside; ++i) {
+                    double v = x[o * inside + i] + (fuse ? y[o * inside + i] : 0.0f);
+                    sum += v;
+                    square += v * v;
+                }
+                double mean  = sum / inside;
+                double scale = 1.0 / sqrt(square / inside - mean * mean + epsilon);
+                for (int i = 0; i < inside; ++i) {
+                    double v = x[o * inside + i] + (fuse ? y[o * inside + i] : 0.0f);
+                    expect[o * inside + i] = (float)((v - mean) * scale * gamma[i] + beta[i]);
+                }
+            }
+            std::vector<VARP> inputs = {input};
+            if (fuse) {
+                inputs.emplace_back(residual);
+            }
+            auto output = _LayerNorm(inputs, gamma, beta, epsilon);
+            auto result = output->readMap<float>();
+            if (nullptr == result || !checkVector<float>(result, expect.data(), outside * inside, 0.01f)) {
+                MNN_ERROR("LayerNormTest failed for %d x %d, offset %f, residual %d\n", outside, inside, offset, fuse);
+                return false;
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        // Sizes cover the vectorized and remained parts, large offset checks the precision of variance
+        for (int inside : {3, 4, 19, 768}) {
+            for (float offset : {0.0f, 1000.0f}) {
+                if (!testSize(7, inside, offset)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(LayerNormTest, "op/layernorm");
@@ -0,0 +1,128 @@
+//
+//  MatMulDynamicInt8Test.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Executor.hpp>
+#include <MNN/expr/ExecutorScope.hpp>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+#include "core/Macro.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+// MatMul and InnerProduct with the activations quantized to int8 at runtime by Precision_Low, checked against fp32
+class MatMulDynamicInt8Test : public MNNTestCase {
+public:
+    virtual ~MatMulDynamicInt8Test() = default;
+    static VARP _makeInput(const std::vector<int>& shape, const std::vector<float>& data) {
+        auto input = _Input(shape, NCHW);
+        ::memcpy(input->writeMap<float>(), data.data(), data.size() * sizeof(float));
+        return input;
+    }
+    // The error of the int8 is bounded relatively to the largest absolute value of the result. NEON and x86 builds
+    // quantize when the result isn't a vector, so the error must be above the fp32 one there to prove the int8 path
+    // ran, and fp32 like elsewhere
+    static bool _check(const char* name, VARP c, const std::vector<float>& expect, bool quantized) {
+        auto ptr = c->readMap<float>();
+        if (nullptr == ptr || c->getInfo()->size != expect.size()) {
+            MNN_ERROR("%s compute failed\n", name);
+            return false;
+        }
+        float maxValue = 0.0f;
+        for (auto v : expect) {
+            maxValue = std::max(maxValue, fabsf(v));
+        }
+        float maxError = 0.0f;
+        for (int i = 0; i < expect.size(); ++i) {
+            if (fabsf(expect[i] - ptr[i]) > 0.02f * maxValue) {
+                MNN_ERROR("%s error at %d: %f - %f\n", name, i, ptr[i], expect[i]);
+                return false;
+            }
+            maxError = std::max(maxError, fabsf(expect[i] - ptr[i]));
+        }
+#if defined(MNN_USE_NEON) || defined(MNN_USE_SSE)
+        if (quantized && maxError <= 1e-4f * maxValue) {
+            MNN_ERROR("%s isn't computed by int8, error %f\n", name, maxError);
+            return false;
+        }
+#else
+        quantized = false;
+#endif
+        if (!quantized && maxError > 1e-4f * maxValue) {
+            MNN_ERROR("%s isn't computed by fp32, error %f\n", name, maxError);
+            return false;
+        }
+        return true;
+    }
+    static bool testMatMul(int e, int l, int h, bool transA, bool transB, bool constB) {
+        auto da = makeTestData(e * l, 1);
+        auto db = makeTestData(l * h, 2);
+        // Some rows of A in a larger range
+        for (int i = 0; i < l; ++i) {
+            da[(e / 2) * l + i] *= 10.0f;
+        }
+        std::vector<float> expect(e * h, 0.0f);
+        for (int y = 0; y < e; ++y) {
+            for (int x = 0; x < h; ++x) {
+                float sum = 0.0f;
+                for (int k = 0; k < l; ++k) {
+                    sum += (transA ? da[k * e + y] : da[y * l + k]) * (transB ? db[x * l + k] : db[k * h + x]);
+                }
+                expect[y * h + x] = sum;
+            }
+        }
+        auto a = _makeInput(transA ? std::vector<int>{l, e} : std::vector<int>{e, l}, da);
+        auto bShape = transB ? std::vector<int>{h, l} : std::vector<int>{l, h};
+        auto b      = constB ? _Const(db.data(), bShape, NCHW) : _makeInput(bShape, db);
+        char name[128];
+        sprintf(name, "MatMul %d, %d, %d, transpose %d %d, const %d", e, l, h, transA, transB, constB);
+        return _check(name, _MatMul(a, b, transA, transB), expect, e > 1 && h > 1);
+    }
+    static bool testInnerProduct(int batch, int ic, int oc) {
+        auto weight = makeTestData(oc * ic, 3);
+        auto bias   = makeTestData(oc, 4);
+        auto data   = makeTestData(batch * ic, 5);
+        std::unique_ptr<OpT> op(new OpT);
+        op->type       = OpType_InnerProduct;
+        op->main.type  = OpParameter_InnerProduct;
+        op->main.value = new InnerProductT;
+        auto param         = op->main.AsInnerProduct();
+        param->outputCount = oc;
+        param->biasTerm    = 1;
+        param->weightSize  = oc * ic;
+        param->weight      = weight;
+        param->bias        = bias;
+        param->axis        = 1;
+        std::vector<float> expect(batch * oc);
+        for (int b = 0; b < batch; ++b) {
+            for (int o = 0; o < oc; ++o) {
+                float sum = bias[o];
+                for (int i = 0; i < ic; ++i) {
+                    sum += weight[o * ic + i] * data[b * ic + i];
+                }
+                expect[b * oc + o] = sum;
+            }
+        }
+        auto output = Variable::create(Expr::create(op.get(), {_makeInput({batch, ic}, data)}));
+        char name[128];
+        sprintf(name, "InnerProduct %d, %d -> %d", batch, ic, oc);
+        return _check(name, output, expect, batch > 1 && oc > 1);
+    }
+    virtual bool run() {
+        BackendConfig config;
+        config.precision = BackendConfig::Precision_Low;
+        ExecutorScope scope(Executor::newExecutor(MNN_FORWARD_CPU, config, 2));
+        return testMatMul(37, 45, 29, false, false, false) && testMatMul(37, 45, 29, true, true, false) &&
+               testMatMul(64, 512, 100, false, true, true) && testMatMul(5, 3, 7, true, false, true) &&
+               testInnerProduct(7, 300, 61) && testInnerProduct(1, 64, 1000);
+    }
+};
+MNNTestSuiteRegister(MatMulDynamicInt8Test, "op/matmul/dynamic_int8");
@@ -0,0 +1,200 @@
+//
+//  NonMaxSuppressionTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <algorithm>
+#include <numeric>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+// Boxes of [ymin, xmin, ymax, xmax] in clusters, so that many of them overlap
+static std::vector<float> _makeBoxes(int number) {
+    std::vector<float> boxes(number * 4);
+    for (int i = 0; i < number; ++i) {
+        float cy = (float)((i * 7) % 10) * 10.0f + sinf(i * 0.37f) * 3.0f;
+        float cx = (float)((i * 3) % 10) * 10.0f + cosf(i * 0.71f) * 3.0f;
+        float h  = 6.0f + sinf(i * 1.3f) * 2.0f;
+        float w  = 6.0f + cosf(i * 1.7f) * 2.0f;
+        boxes[4 * i + 0] = cy - h * 0.5f;
+        boxes[4 * i + 1] = cx - w * 0.5f;
+        boxes[4 * i + 2] = cy + h * 0.5f;
+        boxes[4 * i + 3] = cx + w * 0.5f;
+    }
+    return boxes;
+}
+
+static std::vector<float> _makeScores(int number, float offset) {
+    std::vector<float> scores(number);
+    for (int i = 0; i < number; ++i) {
+        scores[i] = fabsf(sinf(i * 0.113f + offset));
+    }
+    return scores;
+}
+
+// Plain greedy nms over all boxes sorted by score
+static std::vector<int> _referenceNMS(const std::vector<float>& boxes, const float* scores, int number,
+                                      int maxOutput, float iouThreshold, float scoreThreshold) {
+    std::vector<int> order(number);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [scores](int i, int j) { return scores[i] > scores[j]; });
+    std::vector<int> selected;
+    auto area = [&boxes](int i) {
+        return (boxes[4 * i + 2] - boxes[4 * i + 0]) * (boxes[4 * i + 3] - boxes[4 * i + 1]);
+    };
+    for (auto i : order) {
+        if ((int)selected.size() >= maxOutput || scores[i] <= scoreThreshold) {
+            break;
+        }
+        bool keep = true;
+        for (auto j : selected) {
+            float h     = std::max(std::min(boxes[4 * i + 2], boxes[4 * j + 2]) -
+                                   std::max(boxes[4 * i + 0], boxes[4 * j + 0]), 0.0f);
+            float w     = std::max(std::min(boxes[4 * i + 3], boxes[4 * j + 3]) -
+                                   std::max(boxes[4 * i + 1], boxes[4 * j + 1]), 0.0f);
+            float inter = h * w;
+            if (inter / (area(i) + area(j) - inter) > iouThreshold) {
+                keep = false;
+                break;
+            }
+        }
+        if (keep) {
+            selected.emplace_back(i);
+        }
+    }
+    return selected;
+}
+
+class NonMaxSuppressionTest : public MNNTestCase {
+public:
+    virtual ~NonMaxSuppressionTest() = default;
+    bool testSingleClass(int number, int maxOutput, float iouThreshold) {
+        auto boxes  = _makeBoxes(number);
+        auto scores = _makeScores(number, 0.0f);
+        std::unique_ptr<OpT> op(new OpT);
+        op->type       = OpType_NonMaxSuppressionV2;
+        op->main.type  = OpParameter_NonMaxSuppressionV2;
+        op->main.value = new NonMaxSuppressionV2T;
+        auto output    = Variable::create(Expr::create(
+            op.get(), {_Const(boxes.data(), {number, 4}, NHWC), _Const(scores.data(), {number}, NHWC),
+                       _Scalar<int>(maxOutput), _Scalar<float>(iouThreshold)}));
+        auto expect  = _referenceNMS(boxes, scores.data(), number, maxOutput, iouThreshold, -1.0f);
+        auto outputPtr = output->readMap<int>();
+        if (nullptr == outputPtr || output->getInfo()->size < expect.size()) {
+            MNN_ERROR("NonMaxSuppressionV2 compute failed\n");
+            return false;
+        }
+        for (int i = 0; i < expect.size(); ++i) {
+            if (outputPtr[i] != expect[i]) {
+                MNN_ERROR("NonMaxSuppressionV2 error for %d boxes at %d: %d - %d\n", number, i, outputPtr[i],
+                          expect[i]);
+                return false;
+            }
+        }
+        return true;
+    }
+    bool testDetectionPostProcess(bool regular) {
+        const int number = 500, numClasses = 3, maxDetections = 40, detectionsPerClass = 20;
+        const float iouThreshold = 0.4f, scoreThreshold = 0.3f;
+        auto boxes = _makeBoxes(number);
+        // Zero encodings decode to the anchors of [ycenter, xcenter, h, w]
+        std::vector<float> anchors(number * 4);
+        for (int i = 0; i < number; ++i) {
+            anchors[4 * i + 0] = (boxes[4 * i + 0] + boxes[4 * i + 2]) * 0.5f;
+            anchors[4 * i + 1] = (boxes[4 * i + 1] + boxes[4 * i + 3]) * 0.5f;
+            anchors[4 * i + 2] = boxes[4 * i + 2] - boxes[4 * i + 0];
+            anchors[4 * i + 3] = boxes[4 * i + 3] - boxes[4 * i + 1];
+        }
+        // Decode the boxes back, the same as the op
+        for (int i = 0; i < number; ++i) {
+            boxes[4 * i + 0] = anchors[4 * i + 0] - 0.5f * anchors[4 * i + 2];
+            boxes[4 * i + 1] = anchors[4 * i + 1] - 0.5f * anchors[4 * i + 3];
+            boxes[4 * i + 2] = anchors[4 * i + 0] + 0.5f * anchors[4 * i + 2];
+            boxes[4 * i + 3] = anchors[4 * i + 1] + 0.5f * anchors[4 * i + 3];
+        }
+        std::vector<float> encodings(number * 4, 0.0f);
+        // With the background class
+        std::vector<float> predictions(number * (numClasses + 1), 0.0f);
+        std::vector<std::vector<float>> classScores(numClasses);
+        for (int c = 0; c < numClasses; ++c) {
+            classScores[c] = _makeScores(number, (float)c);
+            for (int i = 0; i < number; ++i) {
+                predictions[i * (numClasses + 1) + c + 1] = classScores[c][i];
+            }
+        }
+        auto outputs = _DetectionPostProcess(
+            _Const(encodings.data(), {1, number, 4}, NHWC), _Const(predictions.data(), {1, number, numClasses + 1}, NHWC),
+            _Const(anchors.data(), {number, 4}, NHWC), numClasses, maxDetections, 1, detectionsPerClass,
+            scoreThreshold, iouThreshold, regular, {1.0f, 1.0f, 1.0f, 1.0f});
+        // (score, class, box)
+        std::vector<std::tuple<float, int, int>> expect;
+        if (regular) {
+            for (int c = 0; c < numClasses; ++c) {
+                for (auto i : _referenceNMS(boxes, classScores[c].data(), number, detectionsPerClass, iouThreshold,
+                                            scoreThreshold)) {
+                    expect.emplace_back(classScores[c][i], c, i);
+                }
+            }
+            std::stable_sort(expect.begin(), expect.end(),
+                             [](const std::tuple<float, int, int>& a, const std::tuple<float, int, int>& b) {
+                                 return std::get<0>(a) > std::get<0>(b);
+                             });
+            expect.resize(std::min((int)expect.size(), maxDetections));
+        } else {
+            std::vector<float> maxScores(number);
+            std::vector<int> maxClasses(number);
+            for (int i = 0; i < number; ++i) {
+                maxClasses[i] = 0;
+                for (int c = 1; c < numClasses; ++c) {
+                    if (classScores[c][i] > classScores[maxClasses[i]][i]) {
+                        maxClasses[i] = c;
+                    }
+                }
+                maxScores[i] = classScores[maxClasses[i]][i];
+            }
+            for (auto i : _referenceNMS(boxes, maxScores.data(), number, maxDetections, iouThreshold,
+                                        scoreThreshold)) {
+                expect.emplace_back(maxScores[i], maxClasses[i], i);
+            }
+        }
+        auto boxesPtr   = outputs[0]->readMap<float>();
+        auto classesPtr = outputs[1]->readMap<float>();
+        auto scoresPtr  = outputs[2]->readMap<float>();
+        auto countPtr   = outputs[3]->readMap<float>();
+        if (nullptr == boxesPtr || nullptr == countPtr || (int)countPtr[0] != expect.size()) {
+            MNN_ERROR("DetectionPostProcess of regular %d error for the number of detections\n", regular);
+            return false;
+        }
+        for (int i = 0; i < expect.size(); ++i) {
+            auto box = std::get<2>(expect[i]);
+            if (classesPtr[i] != std::get<1>(expect[i]) || fabsf(scoresPtr[i] - std::get<0>(expect[i])) > 1e-6f) {
+                MNN_ERROR("DetectionPostProcess of regular %d error at %d\n", regular, i);
+                return false;
+            }
+            for (int k = 0; k < 4; ++k) {
+                if (fabsf(boxesPtr[4 * i + k] - boxes[4 * box + k]) > 1e-4f) {
+                    MNN_ERROR("DetectionPostProcess of regular %d error for box at %d\n", regular, i);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        // Fewer outputs than candidates, more outputs than can be selected and iou threshold of 0
+        if (!testSingleClass(2000, 50, 0.5f) || !testSingleClass(300, 300, 0.3f) || !testSingleClass(100, 10, 0.0f)) {
+            return false;
+        }
+        return testDetectionPostProcess(false) && testDetectionPostProcess(true);
+    }
+};
+MNNTestSuiteRegister(NonMaxSuppressionTest, "op/non_max_suppression");
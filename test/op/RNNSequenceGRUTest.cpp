@@ -0,0 +1,136 @@
+//
+//  RNNSequenceGRUTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+static std::vector<float> _makeData(int size, int seed) {
+    std::vector<float> data(size);
+    for (int i = 0; i < size; ++i) {
+        data[i] = sinf((float)(i * 7 + seed * 13)) * 0.5f;
+    }
+    return data;
+}
+
+static std::unique_ptr<BlobT> _makeBlob(const std::vector<float>& data, std::vector<int> dims) {
+    std::unique_ptr<BlobT> blob(new BlobT);
+    blob->dims     = dims;
+    blob->float32s = data;
+    return blob;
+}
+
+static float _sigmoid(float x) {
+    return 1.0f / (1.0f + expf(-x));
+}
+
+// GRU of tensorflow, gateWeight: [input + units, 2 * units] of (r, z), candidateWeight: [input + units, units]
+static void _referenceGRU(const float* input, int batch, int seq, int inputSize, int units, const float* gateWeight,
+                          const float* gateBias, const float* candidateWeight, const float* candidateBias, bool reverse,
+                          bool keepAll, float* output) {
+    std::vector<float> concat(inputSize + units), gate(2 * units), hidden(units);
+    for (int b = 0; b < batch; ++b) {
+        std::fill(hidden.begin(), hidden.end(), 0.0f);
+        for (int s = 0; s < seq; ++s) {
+            int t = reverse ? seq - 1 - s : s;
+            ::memcpy(concat.data(), input + (b * seq + t) * inputSize, inputSize * sizeof(float));
+            ::memcpy(concat.data() + inputSize, hidden.data(), units * sizeof(float));
+            for (int j = 0; j < 2 * units; ++j) {
+                float sum = gateBias[j];
+                for (int i = 0; i < inputSize + units; ++i) {
+                    sum += concat[i] * gateWeight[i * 2 * units + j];
+                }
+                gate[j] = _sigmoid(sum);
+            }
+            for (int j = 0; j < units; ++j) {
+                concat[inputSize + j] = gate[j] * hidden[j];
+            }
+            for (int j = 0; j < units; ++j) {
+                float sum = candidateBias[j];
+                for (int i = 0; i < inputSize + units; ++i) {
+                    sum += concat[i] * candidateWeight[i * units + j];
+                }
+                hidden[j] = gate[units + j] * hidden[j] + (1.0f - gate[units + j]) * tanhf(sum);
+            }
+            if (keepAll) {
+                ::memcpy(output + (b * seq + s) * units, hidden.data(), units * sizeof(float));
+            }
+        }
+        if (!keepAll) {
+            ::memcpy(output + b * units, hidden.data(), units * sizeof(float));
+        }
+    }
+}
+
+class RNNSequenceGRUTest : public MNNTestCase {
+public:
+    virtual ~RNNSequenceGRUTest() = default;
+    bool testGRU(int batch, int seq, int inputSize, int units, bool bidirectional, bool keepAll) {
+        const int concat = inputSize + units;
+        std::unique_ptr<OpT> op(new OpT);
+        op->type                  = OpType_RNNSequenceGRU;
+        op->main.type             = OpParameter_RNNParam;
+        auto param                = new RNNParamT;
+        op->main.value            = param;
+        param->numUnits           = units;
+        param->isBidirectionalRNN = bidirectional;
+        param->keepAllOutputs     = keepAll;
+        std::vector<std::vector<float>> weights;
+        for (int d = 0; d < (bidirectional ? 2 : 1); ++d) {
+            weights.emplace_back(_makeData(concat * 2 * units, 4 * d + 1));
+            weights.emplace_back(_makeData(2 * units, 4 * d + 2));
+            weights.emplace_back(_makeData(concat * units, 4 * d + 3));
+            weights.emplace_back(_makeData(units, 4 * d + 4));
+        }
+        param->fwGateWeight      = _makeBlob(weights[0], {concat, 2 * units});
+        param->fwGateBias        = _makeBlob(weights[1], {2 * units});
+        param->fwCandidateWeight = _makeBlob(weights[2], {concat, units});
+        param->fwCandidateBias   = _makeBlob(weights[3], {units});
+        if (bidirectional) {
+            param->bwGateWeight      = _makeBlob(weights[4], {concat, 2 * units});
+            param->bwGateBias        = _makeBlob(weights[5], {2 * units});
+            param->bwCandidateWeight = _makeBlob(weights[6], {concat, units});
+            param->bwCandidateBias   = _makeBlob(weights[7], {units});
+        }
+        auto inputData       = _makeData(batch * seq * inputSize, 0);
+        auto input           = _Const(inputData.data(), {batch, seq, inputSize}, NCHW);
+        auto expr            = Expr::create(op.get(), {input}, bidirectional ? 2 : 1);
+        const int outputSize = batch * (keepAll ? seq : 1) * units;
+        for (int d = 0; d < (bidirectional ? 2 : 1); ++d) {
+            auto output = Variable::create(expr, d);
+            auto result = output->readMap<float>();
+            if (nullptr == result) {
+                MNN_ERROR("RNNSequenceGRU compute failed\n");
+                return false;
+            }
+            std::vector<float> expect(outputSize);
+            _referenceGRU(inputData.data(), batch, seq, inputSize, units, weights[4 * d].data(),
+                          weights[4 * d + 1].data(), weights[4 * d + 2].data(), weights[4 * d + 3].data(), d > 0,
+                          keepAll, expect.data());
+            for (int i = 0; i < outputSize; ++i) {
+                if (fabsf(result[i] - expect[i]) > 2e-3f) {
+                    MNN_ERROR("RNNSequenceGRU error for batch = %d, seq = %d, input = %d, units = %d, direction %d at "
+                              "%d: %f - %f\n",
+                              batch, seq, inputSize, units, d, i, result[i], expect[i]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        return testGRU(1, 5, 4, 8, false, true) && testGRU(3, 7, 9, 5, false, false) &&
+               testGRU(2, 6, 3, 13, true, true) && testGRU(17, 4, 6, 7, true, false);
+    }
+};
+MNNTestSuiteRegister(RNNSequenceGRUTest, "op/rnn/gru");
@@ -6,6 +6,8 @@
 //  Copyright © 2018, Alibaba Group Holding Limited
 //
 
+#include <math.h>
+#include <algorithm>
 #include <MNN/expr/Expr.hpp>
 #include <MNN/expr/ExprCreator.hpp>
 #include "MNNTestSuite.h"
@@ -41,4 +43,91 @@ public:
         return true;
     }
 };
+
+// Nearest, bilinear, cubic and nearest round of Interp on feature maps of several channel packs
+class InterpTest : public MNNTestCase {
+public:
+    virtual ~InterpTest() = default;
+    static int clamp(int v, int size) {
+        return std::min(std::max(v, 0), size - 1);
+    }
+    // Reference of one axis: source positions and weights of an output position
+    static void taps(int type, float src, int size, int* positions, float* weights) {
+        if (type == 1 || type == 4) {
+            positions[0] = clamp(type == 1 ? (int)floorf(src) : (int)roundf(src), size);
+            weights[0]   = 1.0f;
+        } else if (type == 2) {
+            int x0       = (int)floorf(src);
+            float t      = src - x0;
+            positions[0] = clamp(x0, size);
+            positions[1] = clamp(x0 + 1, size);
+            weights[0]   = 1.0f - t;
+            weights[1]   = t;
+        } else {
+            int x0 = (int)floorf(src);
+            float t = src - x0;
+            const float A = -0.75f;
+            float d[4] = {1.0f + t, t, 1.0f - t, 2.0f - t};
+            for (int i = 0; i < 4; ++i) {
+                positions[i] = clamp(x0 - 1 + i, size);
+                float x      = d[i];
+                weights[i]   = x <= 1.0f ? ((A + 2.0f) * x - (A + 3.0f)) * x * x + 1.0f
+                                         : ((A * x - 5.0f * A) * x + 8.0f * A) * x - 4.0f * A;
+            }
+        }
+    }
+    bool testInterp(int type, int batch, int channel, int inH, int inW, int outH, int outW) {
+        std::vector<float> data(batch * channel * inH * inW);
+        for (int i = 0; i < data.size(); ++i) {
+            data[i] = sinf(i * 0.37f) * 4.0f + (float)(i % 7);
+        }
+        auto input  = _Convert(_Const(data.data(), {batch, channel, inH, inW}, NCHW), NC4HW4);
+        auto output = _Convert(_Interp({input}, 0.0f, 0.0f, outW, outH, type, false), NCHW);
+        auto outputPtr = output->readMap<float>();
+        if (nullptr == outputPtr) {
+            MNN_ERROR("Interp type %d compute failed\n", type);
+            return false;
+        }
+        const int number = (type == 2) ? 2 : ((type == 3) ? 4 : 1);
+        for (int b = 0; b < batch; ++b) {
+            for (int c = 0; c < channel; ++c) {
+                auto src = data.data() + (b * channel + c) * inH * inW;
+                for (int y = 0; y < outH; ++y) {
+                    int yp[4];
+                    float yw[4];
+                    taps(type, y * (float)inH / (float)outH, inH, yp, yw);
+                    for (int x = 0; x < outW; ++x) {
+                        int xp[4];
+                        float xw[4];
+                        taps(type, x * (float)inW / (float)outW, inW, xp, xw);
+                        float expect = 0.0f;
+                        for (int i = 0; i < number; ++i) {
+                            for (int j = 0; j < number; ++j) {
+                                expect += yw[i] * xw[j] * src[yp[i] * inW + xp[j]];
+                            }
+                        }
+                        float got = outputPtr[((b * channel + c) * outH + y) * outW + x];
+                        if (fabsf(got - expect) > 1e-3f) {
+                            MNN_ERROR("Interp type %d error at (%d, %d, %d, %d): %f - %f\n", type, b, c, y, x, got,
+                                      expect);
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        for (int type = 1; type <= 4; ++type) {
+            // Sizes of no source position close to an integer or a half, whose floor or round could differ in float
+            if (!testInterp(type, 2, 5, 13, 17, 41, 29) || !testInterp(type, 1, 3, 31, 23, 11, 9) ||
+                !testInterp(type, 1, 1, 64, 64, 127, 127)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
 MNNTestSuiteRegister(ResizeTest, "op/resize");
+MNNTestSuiteRegister(InterpTest, "op/resize/interp");
@@ -55,6 +55,33 @@ class ScatterNdTest : public MNNTestCase {
             }
         }
 
+        // Many duplicated indices, with short slices and slices split by columns
+        for (int width : {3, 2048}) {
+            const int rows = 64, number = width > 1000 ? 100 : 8000;
+            std::vector<int> indicesData(number * 2);
+            std::vector<float> updatesData(number * width);
+            std::vector<float> expectedResult(2 * rows * width, 0.0f);
+            for (int i = 0; i < number; ++i) {
+                indicesData[2 * i]     = i % 2;
+                indicesData[2 * i + 1] = (i * 17) % rows;
+                for (int k = 0; k < width; ++k) {
+                    updatesData[i * width + k] = (float)((i + k) % 13);
+                    expectedResult[(indicesData[2 * i] * rows + indicesData[2 * i + 1]) * width + k] +=
+                        updatesData[i * width + k];
+                }
+            }
+            const int shapeData[] = {2, rows, width};
+            auto indices          = _Const(indicesData.data(), {number, 2}, NHWC, halide_type_of<int>());
+            auto updates          = _Const(updatesData.data(), {number, width}, NHWC, halide_type_of<float>());
+            auto shape            = _Const(shapeData, {3}, NHWC, halide_type_of<int>());
+            auto result           = _ScatterNd(indices, updates, shape);
+            auto resultData       = result->readMap<float>();
+            if (!checkVector<float>(resultData, expectedResult.data(), (int)expectedResult.size(), 0.001)) {
+                MNN_ERROR("ScatterNdTest failed for duplicated indices of width %d\n", width);
+                return false;
+            }
+        }
+
         return true;
     }
 };
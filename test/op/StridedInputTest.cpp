@@ -0,0 +1,159 @@
+//
+//  StridedInputTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <functional>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+
+// MatMul and Binary reading the Transpose / Slice before them as strided views instead of the copy of Raster
+class StridedInputTest : public MNNTestCase {
+public:
+    virtual ~StridedInputTest() = default;
+    static VARP _makeInput(const std::vector<int>& shape, int seed, std::vector<float>& data) {
+        int size = 1;
+        for (auto s : shape) {
+            size *= s;
+        }
+        data = makeTestData(size, seed);
+        auto input = _Input(shape, NCHW);
+        ::memcpy(input->writeMap<float>(), data.data(), size * sizeof(float));
+        return input;
+    }
+    // at(y, x) is the element (y, x) of the left matrix
+    static bool testMatMul(const char* name, VARP a, VARP b, int e, int l, int h,
+                           std::function<float(int, int)> aAt, std::function<float(int, int)> bAt, bool transB) {
+        auto c   = _MatMul(a, b, false, transB);
+        auto ptr = c->readMap<float>();
+        if (nullptr == ptr) {
+            MNN_ERROR("%s compute failed\n", name);
+            return false;
+        }
+        for (int y = 0; y < e; ++y) {
+            for (int x = 0; x < h; ++x) {
+                float sum = 0.0f;
+                for (int k = 0; k < l; ++k) {
+                    sum += aAt(y, k) * bAt(k, x);
+                }
+                if (fabsf(sum - ptr[y * h + x]) > 1e-3f) {
+                    MNN_ERROR("%s error at %d, %d: %f - %f\n", name, y, x, ptr[y * h + x], sum);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    static bool testBinary(const char* name, VARP c, const std::vector<float>& expect) {
+        auto ptr = c->readMap<float>();
+        if (nullptr == ptr || c->getInfo()->size != expect.size()) {
+            MNN_ERROR("%s compute failed\n", name);
+            return false;
+        }
+        for (int i = 0; i < expect.size(); ++i) {
+            if (fabsf(expect[i] - ptr[i]) > 1e-5f) {
+                MNN_ERROR("%s error at %d: %f - %f\n", name, i, ptr[i], expect[i]);
+                return false;
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        const int e = 37, l = 45, h = 29;
+        std::vector<float> da, db, dc;
+        // A = transpose of [l, e]
+        {
+            auto a = _makeInput({l, e}, 1, da);
+            auto b = _makeInput({l, h}, 2, db);
+            if (!testMatMul("MatMul of transposed A", _Transpose(a, {1, 0}), b, e, l, h,
+                            [&](int y, int k) { return da[k * e + y]; }, [&](int k, int x) { return db[k * h + x]; },
+                            false)) {
+                return false;
+            }
+        }
+        // B = transpose of [h, l], and B = transpose of [l, h] with transposeB
+        {
+            auto a = _makeInput({e, l}, 3, da);
+            auto b = _makeInput({h, l}, 4, db);
+            if (!testMatMul("MatMul of transposed B", a, _Transpose(b, {1, 0}), e, l, h,
+                            [&](int y, int k) { return da[y * l + k]; }, [&](int k, int x) { return db[x * l + k]; },
+                            false)) {
+                return false;
+            }
+            auto bt = _makeInput({l, h}, 5, dc);
+            if (!testMatMul("MatMul of transposed B with transposeB", a, _Transpose(bt, {1, 0}), e, l, h,
+                            [&](int y, int k) { return da[y * l + k]; }, [&](int k, int x) { return dc[k * h + x]; },
+                            true)) {
+                return false;
+            }
+        }
+        // A and B are columns sliced from wider matrices
+        {
+            const int offset = 3, width = l + 7;
+            auto a      = _makeInput({e, width}, 6, da);
+            auto b      = _makeInput({h, width}, 7, db);
+            auto sliceA = _Slice(a, _Const(std::vector<int>{0, offset}.data(), {2}, NCHW, halide_type_of<int>()),
+                                 _Const(std::vector<int>{e, l}.data(), {2}, NCHW, halide_type_of<int>()));
+            auto sliceB = _Slice(b, _Const(std::vector<int>{0, offset}.data(), {2}, NCHW, halide_type_of<int>()),
+                                 _Const(std::vector<int>{h, l}.data(), {2}, NCHW, halide_type_of<int>()));
+            if (!testMatMul("MatMul of sliced inputs", sliceA, sliceB, e, l, h,
+                            [&](int y, int k) { return da[y * width + offset + k]; },
+                            [&](int k, int x) { return db[x * width + offset + k]; }, true)) {
+                return false;
+            }
+        }
+        // Binary of [d0, d1, d2] with the transpose of [d0, d2, d1] and of [d1, d0, d2]
+        {
+            const int d0 = 5, d1 = 41, d2 = 19;
+            auto x = _makeInput({d0, d2, d1}, 8, da);
+            auto y = _makeInput({d0, d1, d2}, 9, db);
+            auto z = _makeInput({d1, d0, d2}, 10, dc);
+            const int size = d0 * d1 * d2;
+            std::vector<float> xt(size), zt(size);
+            for (int i = 0; i < d0; ++i) {
+                for (int j = 0; j < d1; ++j) {
+                    for (int k = 0; k < d2; ++k) {
+                        xt[(i * d1 + j) * d2 + k] = da[(i * d2 + k) * d1 + j];
+                        zt[(i * d1 + j) * d2 + k] = dc[(j * d0 + i) * d2 + k];
+                    }
+                }
+            }
+            auto xView = [&]() { return _Transpose(x, {0, 2, 1}); };
+            auto zView = [&]() { return _Transpose(z, {1, 0, 2}); };
+            std::vector<float> expect(size);
+            for (int i = 0; i < size; ++i) {
+                expect[i] = xt[i] + db[i];
+            }
+            if (!testBinary("Add of transposed input", _Add(xView(), y), expect)) {
+                return false;
+            }
+            for (int i = 0; i < size; ++i) {
+                expect[i] = db[i] - zt[i];
+            }
+            if (!testBinary("Sub of transposed input", _Subtract(y, zView()), expect)) {
+                return false;
+            }
+            for (int i = 0; i < size; ++i) {
+                expect[i] = xt[i] * zt[i];
+            }
+            if (!testBinary("Mul of transposed inputs", _Multiply(xView(), zView()), expect)) {
+                return false;
+            }
+            for (int i = 0; i < size; ++i) {
+                expect[i] = std::max(zt[i], db[i]);
+            }
+            if (!testBinary("Max of transposed input", _Maximum(zView(), y), expect)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+MNNTestSuiteRegister(StridedInputTest, "op/stridedinput");
@@ -0,0 +1,87 @@
+//
+//  TopKV2Test.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <algorithm>
+#include <numeric>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include "MNNTestSuite.h"
+#include "MNN_generated.h"
+#include "TestUtils.h"
+using namespace MNN::Express;
+using namespace MNN;
+
+class TopKV2Test : public MNNTestCase {
+public:
+    virtual ~TopKV2Test() = default;
+    template <typename T>
+    bool testTopK(const std::vector<T>& data, int numRows, int rowSize, int k) {
+        std::unique_ptr<OpT> op(new OpT);
+        op->type       = OpType_TopKV2;
+        op->main.type  = OpParameter_TopKV2;
+        op->main.value = new TopKV2T;
+        auto input     = _Const(data.data(), {numRows, rowSize}, NHWC, halide_type_of<T>());
+        auto expr      = Expr::create(op.get(), {input, _Scalar<int>(k)}, 2);
+        auto values    = Variable::create(expr, 0);
+        auto indices   = Variable::create(expr, 1);
+        auto valuesPtr = values->template readMap<T>();
+        auto indexPtr  = indices->template readMap<int>();
+        if (nullptr == valuesPtr || nullptr == indexPtr) {
+            MNN_ERROR("TopKV2 compute failed\n");
+            return false;
+        }
+        std::vector<int> order(rowSize);
+        for (int r = 0; r < numRows; ++r) {
+            auto row = data.data() + (size_t)r * rowSize;
+            std::iota(order.begin(), order.end(), 0);
+            std::partial_sort(order.begin(), order.begin() + k, order.end(), [row](int i, int j) {
+                return row[i] > row[j] || (row[i] == row[j] && i < j);
+            });
+            for (int i = 0; i < k; ++i) {
+                if (indexPtr[r * k + i] != order[i] || valuesPtr[r * k + i] != row[order[i]]) {
+                    MNN_ERROR("TopKV2 error for %d x %d, k = %d at row %d, %d: %d - %d\n", numRows, rowSize, k, r, i,
+                              indexPtr[r * k + i], order[i]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        // Few distinct values make many ties
+        auto makeFloat = [](int size, int distinct) {
+            std::vector<float> data(size);
+            for (int i = 0; i < size; ++i) {
+                data[i] = (float)(((int64_t)i * 7919) % distinct) - distinct * 0.5f + sinf(i) * (distinct > 100);
+            }
+            return data;
+        };
+        auto makeInt = [](int size, int distinct) {
+            std::vector<int> data(size);
+            for (int i = 0; i < size; ++i) {
+                data[i] = (int)(((int64_t)i * 104729) % distinct) - distinct / 2;
+            }
+            return data;
+        };
+        // k = 1, small k by the threshold filter and large k by the radix select
+        if (!testTopK(makeFloat(4 * 1000, 1000), 4, 1000, 1) || !testTopK(makeFloat(8 * 5003, 30), 8, 5003, 10) ||
+            !testTopK(makeFloat(3 * 2000, 100000), 3, 2000, 20) || !testTopK(makeFloat(5 * 777, 50), 5, 777, 300) ||
+            !testTopK(makeFloat(2 * 64, 1000000), 2, 64, 64)) {
+            return false;
+        }
+        if (!testTopK(makeInt(6 * 4099, 17), 6, 4099, 5) || !testTopK(makeInt(4 * 300, 1 << 30), 4, 300, 100)) {
+            return false;
+        }
+        // A single huge row split into parts
+        const int huge = 200000;
+        return testTopK(makeFloat(huge, 1000000), 1, huge, 1) && testTopK(makeFloat(huge, 500), 1, huge, 50) &&
+               testTopK(makeFloat(huge, 1000000), 1, huge, 20000) && testTopK(makeInt(huge, 1000), 1, huge, 8);
+    }
+};
+MNNTestSuiteRegister(TopKV2Test, "op/topkv2");
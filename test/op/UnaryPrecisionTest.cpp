@@ -0,0 +1,126 @@
+//
+//  UnaryPrecisionTest.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <MNN/expr/ExprCreator.hpp>
+#include <functional>
+#include "MNNTestSuite.h"
+
+using namespace MNN::Express;
+
+// The tests may be built with -ffast-math, check nan and infinity by bits
+static uint32_t _bits(float x) {
+    uint32_t bits;
+    ::memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+static bool _isFinite(float x) {
+    return (_bits(x) & 0x7f800000) != 0x7f800000;
+}
+static bool _isNan(float x) {
+    return (_bits(x) & 0x7fffffff) > 0x7f800000;
+}
+
+// Error of got in ulp of the float nearest to expect, see source/backend/cpu/compute/VectorMath.hpp
+static double _ulpError(float got, double expect) {
+    auto expectFloat = (float)expect;
+    if (_isNan(expectFloat)) {
+        return _isNan(got) ? 0.0 : INFINITY;
+    }
+    if (!_isFinite(expectFloat)) {
+        return _bits(got) == _bits(expectFloat) ? 0.0 : INFINITY;
+    }
+    // Results below FLT_MIN may be flushed to zero
+    if (fabs(expect) < FLT_MIN) {
+        return fabs(got - expect) <= FLT_MIN ? 0.0 : INFINITY;
+    }
+    int exponent;
+    frexp(expectFloat, &exponent);
+    return fabs((double)got - expect) / ldexp(1.0, exponent - 24);
+}
+
+class UnaryPrecisionTest : public MNNTestCase {
+public:
+    virtual ~UnaryPrecisionTest() = default;
+    // Finite inputs are sampled from all floats with the same stride of bits, special ones are checked by bits
+    bool check(const char* name, std::function<VARP(VARP)> func, std::function<double(double)> reference,
+               std::function<double(float)> maxError, std::vector<std::pair<float, float>> specials) {
+        const uint64_t stride = 4093;
+        std::vector<float> inputs;
+        for (uint64_t bits = 0; bits < (1ULL << 32); bits += stride) {
+            auto value = (uint32_t)bits;
+            float x;
+            ::memcpy(&x, &value, sizeof(float));
+            if (_isFinite(x)) {
+                inputs.emplace_back(x);
+            }
+        }
+        for (float x : {0.0f, -0.0f, 1.0f, -1.0f, 0.625f, -1.4f, 88.3f, -87.3f, FLT_MIN}) {
+            inputs.emplace_back(x);
+        }
+        for (auto& iter : specials) {
+            inputs.emplace_back(iter.first);
+        }
+        auto input = _Input({(int)inputs.size()}, NCHW);
+        ::memcpy(input->writeMap<float>(), inputs.data(), inputs.size() * sizeof(float));
+        auto output = func(input)->readMap<float>();
+        const int finiteSize = (int)(inputs.size() - specials.size());
+        for (int i = 0; i < finiteSize; ++i) {
+            auto error = _ulpError(output[i], reference(inputs[i]));
+            if (error > maxError(inputs[i])) {
+                MNN_ERROR("%s error of %.9g is %f ulp, result %.9g, expect %.9g\n", name, inputs[i], error, output[i],
+                          reference(inputs[i]));
+                return false;
+            }
+        }
+        for (int i = 0; i < specials.size(); ++i) {
+            auto got    = output[finiteSize + i];
+            auto expect = specials[i].second;
+            if (_isNan(expect) ? !_isNan(got) : _bits(got) != _bits(expect)) {
+                MNN_ERROR("%s of %f is %f, expect %f\n", name, specials[i].first, got, expect);
+                return false;
+            }
+        }
+        return true;
+    }
+    virtual bool run() {
+        auto ulp       = [](double value) { return [value](float) { return value; }; };
+        const float inf = INFINITY;
+        const float nan = NAN;
+        bool res        = true;
+        res = res && check("exp", [](VARP x) { return _Exp(x); },
+                           [](double x) { return x > 88.3762626647949 ? INFINITY : exp(x); }, ulp(2.0),
+                           {{inf, inf}, {-inf, 0.0f}, {nan, nan}});
+        res = res && check("log", [](VARP x) { return _Log(x); }, [](double x) { return log(x); }, ulp(1.0),
+                           {{inf, inf}, {-inf, nan}, {nan, nan}});
+        res = res && check("erf", [](VARP x) { return _Erf(x); }, [](double x) { return erf(x); }, ulp(3.0),
+                           {{inf, 1.0f}, {-inf, -1.0f}, {nan, nan}});
+        res = res && check("tanh", [](VARP x) { return _Tanh(x); }, [](double x) { return tanh(x); }, ulp(2.0),
+                           {{inf, 1.0f}, {-inf, -1.0f}, {nan, nan}});
+        res = res && check("sigmoid", [](VARP x) { return _Sigmoid(x); },
+                           [](double x) { return 1.0 / (1.0 + exp(-x)); }, ulp(3.0),
+                           {{inf, 1.0f}, {-inf, 0.0f}, {nan, nan}});
+        res = res && check("silu", [](VARP x) { return _Silu(x); },
+                           [](double x) { return x < -87.3365447505531 ? 0.0 : x / (1.0 + exp(-x)); }, ulp(4.0),
+                           {{inf, inf}, {nan, nan}});
+        res = res && check("gelu", [](VARP x) { return _Gelu(x); },
+                           [](double x) { return 0.5 * x * erfc(-x / sqrt(2.0)); }, ulp(16.0),
+                           {{inf, inf}, {nan, nan}});
+        auto geluTanhU = [](double x) { return sqrt(2.0 / M_PI) * (x + 0.044715 * x * x * x); };
+        res = res && check("gelu tanh", [](VARP x) { return _Gelu(x, true); },
+                           [geluTanhU](double x) {
+                               auto u = geluTanhU(x);
+                               return 2.0 * u < -87.3365447505531 ? 0.0 : x / (1.0 + exp(-2.0 * u));
+                           },
+                           [geluTanhU](float x) { return 3.0 + 5.0 * fabs(geluTanhU(x)); }, {{inf, inf}, {nan, nan}});
+        return res;
+    }
+};
+MNNTestSuiteRegister(UnaryPrecisionTest, "op/unary/precision");
@@ -0,0 +1,153 @@
+//
+//  ConcurrencySpeed.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <MNN/Interpreter.hpp>
+#include <MNN/AutoTime.hpp>
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include "MNNTestSuite.h"
+#include "backend/cpu/CPUBackend.hpp"
+#include "core/Concurrency.h"
+using namespace MNN;
+
+#define THREAD_NUMBER 4
+#define TIME 20
+
+/**
+ Tail idle of the static stride (tId, tId + threads, ...) and the chunks of MNN_CONCURRENCY_DYNAMIC for imbalanced
+ work. The idle of a run is the time threads wait for the last one, in ratio of threads * makespan:
+ - measured: by the finish time of each thread, only meaningful if the machine has THREAD_NUMBER free cores;
+ - ideal: by the cost of each item measured in one thread, as if every thread had its own core.
+ */
+class ConcurrencySpeed : public MNNTestCase {
+public:
+    Backend* backend() const {
+        return mBackend.get();
+    }
+    static float _work(int cost) {
+        float sum = 0.0f;
+        for (int i = 0; i < cost * 2000; ++i) {
+            sum = sum * 0.999f + 1.0f;
+        }
+        return sum;
+    }
+    static float _idle(const std::vector<float>& busy, float makespan) {
+        float sum = 0.0f;
+        for (auto b : busy) {
+            sum += b;
+        }
+        return makespan > 0.0f ? 1.0f - sum / (busy.size() * makespan) : 0.0f;
+    }
+    // Threads finishing time of one run by the clock of measure, from the start of the run
+    std::vector<float> _runStatic(const std::vector<int>& costs, std::vector<float>& output) {
+        std::vector<float> finish(THREAD_NUMBER, 0.0f);
+        int size = (int)costs.size();
+        Timer timer;
+        MNN_CONCURRENCY_BEGIN(tId, THREAD_NUMBER) {
+            for (int i = (int)tId; i < size; i += THREAD_NUMBER) {
+                output[i] = _work(costs[i]);
+            }
+            finish[tId] = timer.durationInUs();
+        }
+        MNN_CONCURRENCY_END();
+        return finish;
+    }
+    std::vector<float> _runDynamic(const std::vector<int>& costs, std::vector<float>& output) {
+        std::vector<float> finish(THREAD_NUMBER, 0.0f);
+        int size = (int)costs.size();
+        Timer timer;
+        MNN_CONCURRENCY_DYNAMIC_BEGIN(tId, i, size, THREAD_NUMBER, 1) {
+            output[i]   = _work(costs[i]);
+            finish[tId] = timer.durationInUs();
+        }
+        MNN_CONCURRENCY_DYNAMIC_END();
+        return finish;
+    }
+    void _test(const char* name, const std::vector<int>& costs) {
+        int size = (int)costs.size();
+        std::vector<float> output(size);
+        // Cost of each item in one thread
+        std::vector<float> itemTime(size);
+        for (int i = 0; i < size; ++i) {
+            Timer timer;
+            for (int t = 0; t < TIME; ++t) {
+                output[i] = _work(costs[i]);
+            }
+            itemTime[i] = timer.durationInUs() / (float)TIME;
+        }
+        // Ideal static: the sum of strided items, ideal dynamic: the thread free first takes next chunk
+        std::vector<float> staticBusy(THREAD_NUMBER, 0.0f);
+        for (int i = 0; i < size; ++i) {
+            staticBusy[i % THREAD_NUMBER] += itemTime[i];
+        }
+        std::vector<float> dynamicBusy(THREAD_NUMBER, 0.0f);
+        ConcurrencyCounter counter(size, THREAD_NUMBER, 1);
+        int begin, end;
+        while (counter.next(begin, end)) {
+            auto& thread = *std::min_element(dynamicBusy.begin(), dynamicBusy.end());
+            for (int i = begin; i < end; ++i) {
+                thread += itemTime[i];
+            }
+        }
+        auto idealStatic  = _idle(staticBusy, *std::max_element(staticBusy.begin(), staticBusy.end()));
+        auto idealDynamic = _idle(dynamicBusy, *std::max_element(dynamicBusy.begin(), dynamicBusy.end()));
+
+        float measuredStatic  = 0.0f;
+        float measuredDynamic = 0.0f;
+        float timeStatic      = 0.0f;
+        float timeDynamic     = 0.0f;
+        mBackend->onExecuteBegin();
+        for (int t = 0; t < TIME; ++t) {
+            auto finish = _runStatic(costs, output);
+            auto span   = *std::max_element(finish.begin(), finish.end());
+            measuredStatic += _idle(finish, span);
+            timeStatic += span;
+            finish = _runDynamic(costs, output);
+            span   = *std::max_element(finish.begin(), finish.end());
+            measuredDynamic += _idle(finish, span);
+            timeDynamic += span;
+        }
+        mBackend->onExecuteEnd();
+        MNN_PRINT("%s, %d items on %d threads, tail idle static / dynamic: ideal %.1f%% / %.1f%%, measured %.1f%% / "
+                  "%.1f%% (%.3f / %.3f ms)\n",
+                  name, size, THREAD_NUMBER, idealStatic * 100.0f, idealDynamic * 100.0f,
+                  measuredStatic * 100.0f / TIME, measuredDynamic * 100.0f / TIME, timeStatic / TIME / 1000.0f,
+                  timeDynamic / TIME / 1000.0f);
+    }
+    virtual bool run() {
+        BackendConfig backendConfig;
+        Backend::Info compute;
+        compute.type      = MNN_FORWARD_CPU;
+        compute.numThread = THREAD_NUMBER;
+        compute.user      = &backendConfig;
+        const RuntimeCreator* runtimeCreator(MNNGetExtraRuntimeCreator(compute.type));
+        std::unique_ptr<Runtime> runtime(runtimeCreator->onCreate(compute));
+        mBackend.reset(runtime->onCreate());
+
+        // Equal items, the remainder is on the first threads, such as 9 tiles of a small convolution
+        _test("remainder", std::vector<int>(9, 4));
+        // Linearly growing cost, such as rows of a triangular region
+        std::vector<int> costs(64);
+        for (int i = 0; i < costs.size(); ++i) {
+            costs[i] = i / 8 + 1;
+        }
+        _test("growing", costs);
+        // Every THREAD_NUMBER-th item is heavy, such as a broadcast of period 4, static stride puts all on thread 0
+        for (int i = 0; i < costs.size(); ++i) {
+            costs[i] = (i % THREAD_NUMBER == 0) ? 8 : 1;
+        }
+        _test("periodic", costs);
+        mBackend.reset();
+        return true;
+    }
+
+private:
+    std::unique_ptr<Backend> mBackend;
+};
+MNNTestSuiteRegister(ConcurrencySpeed, "speed/Concurrency");
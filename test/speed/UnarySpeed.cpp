@@ -0,0 +1,50 @@
+//
+//  UnarySpeed.cpp
+//  MNNTests
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include <math.h>
+#include <MNN/expr/Expr.hpp>
+#include <MNN/expr/ExprCreator.hpp>
+#include <functional>
+#include <MNN/AutoTime.hpp>
+#include "MNNTestSuite.h"
+using namespace MNN::Express;
+#define SIZE (1024 * 1024)
+#define TIME 100
+class UnarySpeed : public MNNTestCase {
+public:
+    void run(const char* name, std::function<VARP(VARP)> func) {
+        auto x   = _Input({SIZE}, NCHW);
+        auto ptr = x->writeMap<float>();
+        for (int i = 0; i < SIZE; ++i) {
+            ptr[i] = ((i % 2001) - 1000) / 100.0f;
+        }
+        auto y = func(x);
+        y->readMap<float>();
+        MNN::Timer _t;
+        for (int i = 0; i < TIME; ++i) {
+            x->writeMap<float>();
+            y->readMap<float>();
+        }
+        auto time = (float)_t.durationInUs() / 1000.0f;
+        MNN_PRINT("%s for %d, avg time = %f ms, %f ns per element\n", name, SIZE, time / TIME,
+                  time * 1000000.0f / TIME / SIZE);
+    }
+    virtual bool run() {
+        run("Exp", [](VARP x) { return _Exp(x); });
+        run("Log", [](VARP x) { return _Log(_Abs(x)); });
+        run("Erf", [](VARP x) { return _Erf(x); });
+        run("Tanh", [](VARP x) { return _Tanh(x); });
+        run("Sigmoid", [](VARP x) { return _Sigmoid(x); });
+        run("Silu", [](VARP x) { return _Silu(x); });
+        run("Gelu", [](VARP x) { return _Gelu(x); });
+        run("GeluTanh", [](VARP x) { return _Gelu(x, true); });
+        run("Softmax", [](VARP x) { return _Softmax(_Reshape(x, {SIZE / 1024, 1024}), -1); });
+        return true;
+    }
+};
+MNNTestSuiteRegister(UnarySpeed, "speed/Unary");
@@ -0,0 +1,192 @@
+//
+//  FuseAttention.cpp
+//  MNNConverter
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "../TemplateMerge.hpp"
+#include "MNN/expr/ExprCreator.hpp"
+#include "MNN_generated.h"
+#include "MergeHelpers.hpp"
+
+namespace MNN {
+namespace Express {
+
+// Fuse BatchMatMul(Softmax([BatchMatMul(Q, K^T) * scale] [+ mask]), V) into Attention, so that the scores of
+// [..., seqQ, seqK] are not written to memory
+class FuseAttention {
+public:
+    FuseAttention();
+
+private:
+    VARP query_;
+    VARP key_;
+    VARP value_;
+    VARP mask_;
+    float scale_;
+};
+
+static bool _IsBatchMatMul(EXPRP expr, bool adjY) {
+    const Op* op = expr->get();
+    if (!op || op->type() != OpType_BatchMatMul || nullptr == op->main_as_BatchMatMulParam()) {
+        return false;
+    }
+    auto param = op->main_as_BatchMatMulParam();
+    return !param->adjX() && param->adjY() == adjY;
+}
+
+// The intermediate results are only used in the pattern
+static bool _IsUsedOnce(EXPRP expr) {
+    int useCount = 0;
+    for (auto& w : expr->outputs()) {
+        if (nullptr != w.lock()) {
+            useCount++;
+        }
+    }
+    return 1 == useCount;
+}
+
+static bool _ReadScalar(VARP var, float* value) {
+    auto info = var->getInfo();
+    if (nullptr == info || 1 != info->size || halide_type_float != info->type.code) {
+        return false;
+    }
+    auto ptr = var->readMap<float>();
+    if (nullptr == ptr) {
+        return false;
+    }
+    *value = ptr[0];
+    return true;
+}
+
+FuseAttention::FuseAttention() {
+    auto match = [this](EXPRP expr) -> bool {
+        if (!_IsBatchMatMul(expr, false)) {
+            return false;
+        }
+        EXPRP softmax = expr->inputs().at(0)->expr().first;
+        if (!softmax->get() || softmax->get()->type() != OpType_Softmax || !_IsUsedOnce(softmax)) {
+            return false;
+        }
+        VARP scores = softmax->inputs().at(0);
+        auto scoresInfo = scores->getInfo();
+        if (nullptr == scoresInfo || scoresInfo->dim.size() < 2) {
+            return false;
+        }
+        const int rank = scoresInfo->dim.size();
+        auto axis      = softmax->get()->main_as_Axis();
+        if (nullptr == axis || (axis->axis() != -1 && axis->axis() != rank - 1)) {
+            return false;
+        }
+
+        VARP mask;
+        EXPRP current = scores->expr().first;
+        if (helpers::IsBinaryAdd(current) && _IsUsedOnce(current)) {
+            // The scores side comes from BatchMatMul, possibly scaled
+            int scoresIndex = 0;
+            for (int i = 0; i < 2; ++i) {
+                auto input = current->inputs().at(i)->expr().first;
+                if (_IsBatchMatMul(input, true) || helpers::IsBinaryMul(input) || helpers::IsBinaryRealDiv(input)) {
+                    scoresIndex = i;
+                    break;
+                }
+            }
+            mask    = current->inputs().at(1 - scoresIndex);
+            current = current->inputs().at(scoresIndex)->expr().first;
+        }
+
+        float scale = 1.0f;
+        if ((helpers::IsBinaryMul(current) || helpers::IsBinaryRealDiv(current)) && _IsUsedOnce(current)) {
+            float value      = 0.0f;
+            int scoresIndex  = 0;
+            if (_ReadScalar(current->inputs().at(1), &value)) {
+                scoresIndex = 0;
+            } else if (helpers::IsBinaryMul(current) && _ReadScalar(current->inputs().at(0), &value)) {
+                scoresIndex = 1;
+            } else {
+                return false;
+            }
+            if (helpers::IsBinaryRealDiv(current)) {
+                if (0.0f == value) {
+                    return false;
+                }
+                value = 1.0f / value;
+            }
+            scale   = value;
+            current = current->inputs().at(scoresIndex)->expr().first;
+        }
+        if (!_IsBatchMatMul(current, true) || !_IsUsedOnce(current)) {
+            return false;
+        }
+        // 0 is kept for 1 / sqrt(depth) of Attention
+        if (0.0f == scale) {
+            return false;
+        }
+
+        // Attention doesn't broadcast Q, K and V
+        VARP query = current->inputs().at(0);
+        VARP key   = current->inputs().at(1);
+        VARP value = expr->inputs().at(1);
+        auto queryInfo = query->getInfo();
+        auto keyInfo   = key->getInfo();
+        auto valueInfo = value->getInfo();
+        if (nullptr == queryInfo || nullptr == keyInfo || nullptr == valueInfo) {
+            return false;
+        }
+        if (queryInfo->dim.size() != rank || keyInfo->dim.size() != rank || valueInfo->dim.size() != rank) {
+            return false;
+        }
+        for (int i = 0; i < rank - 2; ++i) {
+            if (queryInfo->dim[i] != keyInfo->dim[i] || queryInfo->dim[i] != valueInfo->dim[i]) {
+                return false;
+            }
+        }
+        if (nullptr != mask) {
+            auto maskInfo = mask->getInfo();
+            if (nullptr == maskInfo || maskInfo->dim.empty() || maskInfo->dim.size() > rank ||
+                halide_type_float != maskInfo->type.code) {
+                return false;
+            }
+            // Broadcast to the scores except the last dimension
+            const int offset = rank - maskInfo->dim.size();
+            for (int i = 0; i < maskInfo->dim.size(); ++i) {
+                auto length = maskInfo->dim[i];
+                auto target = scoresInfo->dim[i + offset];
+                if (length != target && (length != 1 || i == maskInfo->dim.size() - 1)) {
+                    return false;
+                }
+            }
+        }
+        query_ = query;
+        key_   = key;
+        value_ = value;
+        mask_  = mask;
+        scale_ = scale;
+        return true;
+    };
+
+    auto fold = [this](EXPRP expr) -> bool {
+        std::unique_ptr<OpT> attention(new OpT);
+        attention->name       = expr->name();
+        attention->type       = OpType_Attention;
+        attention->main.type  = OpParameter_AttentionParam;
+        attention->main.value = new AttentionParamT;
+        attention->main.AsAttentionParam()->scale = scale_;
+        std::vector<VARP> inputs = {query_, key_, value_};
+        if (nullptr != mask_) {
+            inputs.emplace_back(mask_);
+        }
+        auto attentionExpr = Expr::create(attention.get(), inputs, 1);
+        attentionExpr->setName(expr->name());
+        Expr::replace(expr, attentionExpr);
+        return true /*modified*/;
+    };
+    TemplateMerge::getInstance("Merge").insertTemplate("FuseAttention", match, fold);
+}
+
+static FuseAttention g_fuse_attention;
+
+} // namespace Express
+} // namespace MNN
@@ -0,0 +1,64 @@
+//
+//  FuseLayerNormResidual.cpp
+//  MNNConverter
+//
+//  Created by MNN on 2026/10/17.
+//  Copyright © 2018, Alibaba Group Holding Limited
+//
+
+#include "../TemplateMerge.hpp"
+#include "MNN/expr/ExprCreator.hpp"
+#include "MNN_generated.h"
+#include "MergeHelpers.hpp"
+
+namespace MNN {
+namespace Express {
+
+// Fuse the residual add before LayerNorm (produced by FuseLayerNorm / FuseLayerNormV2) into LayerNorm with two
+// inputs, so that the sum isn't written and read again by a separate op
+static auto gRegister = []() {
+    auto match = [](EXPRP expr) -> bool {
+        if (nullptr == expr->get() || expr->get()->type() != OpType_LayerNorm || expr->inputs().size() != 1) {
+            return false;
+        }
+        EXPRP add = expr->inputs().at(0)->expr().first;
+        if (!helpers::IsBinaryAdd(add) || add->outputSize() != 1) {
+            return false;
+        }
+        // The sum shouldn't be used by other ops
+        int useCount = 0;
+        for (auto& w : add->outputs()) {
+            if (nullptr != w.lock()) {
+                useCount++;
+            }
+        }
+        if (useCount != 1) {
+            return false;
+        }
+        auto x = add->inputs().at(0);
+        auto y = add->inputs().at(1);
+        if (helpers::IsConstant(x->expr().first) || helpers::IsConstant(y->expr().first)) {
+            return false;
+        }
+        // LayerNorm doesn't broadcast the residual
+        auto xInfo = x->getInfo();
+        auto yInfo = y->getInfo();
+        if (nullptr == xInfo || nullptr == yInfo || xInfo->dim != yInfo->dim || xInfo->order != yInfo->order) {
+            return false;
+        }
+        return true;
+    };
+    auto fold = [](EXPRP expr) -> bool {
+        auto add = expr->inputs().at(0)->expr().first;
+        std::unique_ptr<OpT> layerNormOp(expr->get()->UnPack());
+        auto fuseExpr = Expr::create(layerNormOp.get(), {add->inputs().at(0), add->inputs().at(1)}, 1);
+        fuseExpr->setName(expr->name());
+        Expr::replace(expr, fuseExpr);
+        return true /*modified*/;
+    };
+    TemplateMerge::getInstance("Merge").insertTemplate("FuseLayerNormResidual", match, fold);
+    return true;
+}();
+
+} // namespace Express
+} // namespace MNN
@@ -54,6 +54,10 @@ bool IsBinaryMul(EXPRP expr) {
     IS_BINARY_OP_TYPE(BinaryOpOperation_MUL);
 }
 
+bool IsBinaryRealDiv(EXPRP expr) {
+    IS_BINARY_OP_TYPE(BinaryOpOperation_REALDIV);
+}
+
 bool IsBinarySquaredDifference(Express::EXPRP expr) {
     IS_BINARY_OP_TYPE(BinaryOpOperation_SquaredDifference);
 }
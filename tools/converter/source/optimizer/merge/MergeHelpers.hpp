@@ -15,6 +15,7 @@ bool IsUnaryOp(Express::EXPRP expr);
 bool IsBinaryAdd(Express::EXPRP expr);
 bool IsBinarySub(Express::EXPRP expr);
 bool IsBinaryMul(Express::EXPRP expr);
+bool IsBinaryRealDiv(Express::EXPRP expr);
 
 bool IsBinarySquaredDifference(Express::EXPRP expr);
 